@@ -6,12 +6,27 @@
 #define WTK_TYPE_BACKEND_H_
 
 #include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
 
 #include <wtk/indexes.h>
 #include <wtk/circuit/Data.h>
 
 namespace wtk {
 
+/**
+ * A record of the side effects (e.g. gate counts) of a function call, for
+ * a TypeBackend which supports memoization. Each backend derives its own.
+ */
+struct MemoRecord
+{
+  // Approximate bytes held by the record, for bounding the memo cache.
+  virtual size_t bytes() const { return sizeof(MemoRecord); }
+
+  virtual ~MemoRecord() = default;
+};
+
 /**
  * A type erasing parent class for all TypeBackends. The Wire_T template
  * gets erased, and all actions non-sepcific to the Wire_T may be performed
@@ -57,6 +72,44 @@ public:
    */
   virtual void finish() { }
 
+  /**
+   * Indicates if the backend's callbacks may be called concurrently from
+   * multiple threads, e.g. by the iter_v0 map plugin's parallel iterations
+   * (see wtk::nails::MapOperation). Concurrent callbacks never share an
+   * output wire. The lineNum attribute is not set by concurrent callers.
+   */
+  virtual bool threadSafe() const { return false; }
+
+  /**
+   * Optional hooks for constants which are used repeatedly, such as those of
+   * addc, mulc and assign gates within a function.
+   *
+   * prepareConstant() is called once for each such constant, and returns an
+   * opaque handle which is given to the prepared callbacks each time the
+   * constant is used, and eventually to releaseConstant(). A backend may
+   * override these to keep constants in its own representation (e.g. already
+   * converted to Wire_T, or in Montgomery form). A backend which overrides
+   * prepareConstant() must also override releaseConstant() and all of the
+   * *Prepared callbacks of its TypeBackend.
+   *
+   * The defaults hold a copy of the Number_T. These are type-erased so that
+   * a handle's holder may release it without the interpreter which prepared
+   * it.
+   *
+   * prepareConstant() may be called while other gates of the type are being
+   * evaluated on another thread (see wtk::nails::Interpreter's parallel
+   * mode), so it should not modify the backend.
+   */
+  virtual void* prepareConstant(Number_T const& value)
+  {
+    return new Number_T(value);
+  }
+
+  virtual void releaseConstant(void* constant)
+  {
+    delete (Number_T*) constant;
+  }
+
   virtual ~TypeBackendEraser() = default;
 };
 
@@ -129,6 +182,85 @@ public:
    */
   virtual void assertZero(Wire_T const* left) = 0;
 
+  /**
+   * Prepared variants of the assign, addc and mulc callbacks, given handles
+   * from prepareConstant() (see TypeBackendEraser). The defaults forward to
+   * the unprepared callbacks.
+   */
+  virtual void assignPrepared(Wire_T* wire, void const* value)
+  {
+    Number_T copy(*(Number_T const*) value);
+    this->assign(wire, std::move(copy));
+  }
+
+  virtual void addcPrepared(
+      Wire_T* out, Wire_T const* left, void const* right)
+  {
+    Number_T copy(*(Number_T const*) right);
+    this->addcGate(out, left, std::move(copy));
+  }
+
+  virtual void mulcPrepared(
+      Wire_T* out, Wire_T const* left, void const* right)
+  {
+    Number_T copy(*(Number_T const*) right);
+    this->mulcGate(out, left, std::move(copy));
+  }
+
+  /**
+   * Optional batch callbacks. Each performs n many independent gates of the
+   * same kind, where the i'th gate's operands are the i'th elements of each
+   * array. No gate in a batch uses another gate's output of the same batch.
+   *
+   * The default implementations loop over the single gate callbacks, so a
+   * backend need only override these if it can process gates in bulk.
+   * Out wires are constructed before the call, as with single gates.
+   */
+  virtual void addGates(Wire_T* const* outs,
+      Wire_T const* const* lefts, Wire_T const* const* rights, size_t const n)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->addGate(outs[i], lefts[i], rights[i]);
+    }
+  }
+
+  virtual void mulGates(Wire_T* const* outs,
+      Wire_T const* const* lefts, Wire_T const* const* rights, size_t const n)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->mulGate(outs[i], lefts[i], rights[i]);
+    }
+  }
+
+  /**
+   * The rights of addcGates and mulcGates are prepared constants (see
+   * prepareConstant()).
+   */
+  virtual void addcGates(Wire_T* const* outs,
+      Wire_T const* const* lefts, void const* const* rights, size_t const n)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->addcPrepared(outs[i], lefts[i], rights[i]);
+    }
+  }
+
+  virtual void mulcGates(Wire_T* const* outs,
+      Wire_T const* const* lefts, void const* const* rights, size_t const n)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->mulcPrepared(outs[i], lefts[i], rights[i]);
+    }
+  }
+
+  virtual void assertZeros(Wire_T const* const* lefts, size_t const n)
+  {
+    for(size_t i = 0; i < n; i++) { this->assertZero(lefts[i]); }
+  }
+
   /**
    * Callback for assigning a public stream input.
    */
@@ -139,6 +271,13 @@ public:
    */
   virtual void privateIn(Wire_T* wire, Number_T&& value) = 0;
 
+  /**
+   * Bound (exclusive) on values read from the input streams, checked
+   * before publicIn() and privateIn(). It is the type's maximum value,
+   * unless the backend's streams pack several elements into each value.
+   */
+  virtual Number_T maxInputValue() const { return this->type->maxValue(); }
+
   /**
    * Indicates whether or not extended witness retrieval is supported.
    *
@@ -174,6 +313,51 @@ public:
     return 0;
   }
 
+  /**
+   * Indicates whether or not memoization of pure function calls is supported
+   * (see wtk::nails::Memoizer). This requires plaintext wires, so that a
+   * call's outputs may be reused for a later call with the same inputs, and
+   * that the backend may replay the call's side effects.
+   */
+  virtual bool supportsMemoization() { return false; }
+
+  /**
+   * If supported, append an encoding of the wire's value to a memoization
+   * key. Equal values must have equal encodings.
+   */
+  virtual void memoKey(Wire_T const* wire, std::string* key)
+  {
+    (void) wire;
+    (void) key;
+  }
+
+  /**
+   * If supported, assign an output of a memoized call, with the value of
+   * getExtendedWitness() from its original call. The assignment itself is
+   * not a side effect of the call (e.g. it is not counted as a gate).
+   */
+  virtual void memoAssign(Wire_T* wire, Number_T const& value)
+  {
+    (void) wire;
+    (void) value;
+  }
+
+  /**
+   * If supported, begin recording the side effects of a call, before it is
+   * evaluated. Calls may be nested, each with its own record.
+   */
+  virtual std::unique_ptr<MemoRecord> beginMemo() { return nullptr; }
+
+  /**
+   * Finish recording side effects, after the call is evaluated.
+   */
+  virtual void endMemo(MemoRecord* record) { (void) record; }
+
+  /**
+   * Apply the recorded side effects again, in place of evaluating the call.
+   */
+  virtual void replayMemo(MemoRecord const* record) { (void) record; }
+
   virtual ~TypeBackend() = default;
 };
 
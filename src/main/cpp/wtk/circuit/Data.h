@@ -78,15 +78,26 @@ struct TypeSpec
   {
     field,
     ring,
+    extField,
     plugin
   } const variety = field;
 
-  // The prime for field types
+  // The prime for field types, or the base field's prime for extension
+  // field types (0 when the base field is unknown, as in a stream header).
   Number_T const prime = 0;
 
   // The bit-width for ring types
   size_t const bitWidth = 0;
 
+  // For extension field types, the index of the base field type, the
+  // degree d of the extension, and the reduction polynomial. The polynomial
+  // is monic, x^d + m_(d-1) x^(d-1) + ... + m_0, and is encoded as the
+  // number m_0 + m_1 p + ... + m_(d-1) p^(d-1). Elements are encoded
+  // likewise, by their coefficients as digits in base p.
+  type_idx const baseField = 0;
+  size_t const degree = 0;
+  Number_T const modulus = 0;
+
   // The plugin binding for plugin types
   PluginBinding<Number_T> const binding;
 
@@ -96,12 +107,18 @@ struct TypeSpec
   // Construct a ring type
   TypeSpec(size_t const bw) : variety(ring), bitWidth(bw) { }
 
+  // Construct an extension field type
+  TypeSpec(type_idx const bf, size_t const d, Number_T&& m,
+      Number_T&& p = Number_T(0))
+    : variety(extField), prime(std::move(p)), baseField(bf), degree(d),
+    modulus(std::move(m)) { }
+
   // Construct a plugin type
   TypeSpec(PluginBinding<Number_T>&& b)
     : variety(plugin), binding(std::move(b)) { }
 
-  // Return the type's maximum value (e.g. field's prime or 2**bitWidth for
-  // a ring, or 0 for a plugin).
+  // Return the type's maximum value (e.g. field's prime, 2**bitWidth for
+  // a ring, prime**degree for an extension field, or 0 for a plugin).
   Number_T maxValue() const;
 
   // Return true if the type is the boolean field (GF(2))
@@ -54,6 +54,12 @@ Number_T TypeSpec<Number_T>::maxValue() const
   {
     return Number_T(1) << this->bitWidth;
   }
+  case extField:
+  {
+    Number_T ret(1);
+    for(size_t i = 0; i < this->degree; i++) { ret = ret * this->prime; }
+    return ret;
+  }
   case plugin:
   {
     return Number_T(0);
@@ -87,6 +93,17 @@ bool operator== (
     if(l.bitWidth != r.bitWidth) { return false; }
     break;
   }
+  case TypeSpec<Number_T>::extField:
+  {
+    // The base field's prime is unknown to a stream, so only its index is
+    // compared.
+    if(l.baseField != r.baseField || l.degree != r.degree
+        || l.modulus != r.modulus)
+    {
+      return false;
+    }
+    break;
+  }
   case TypeSpec<Number_T>::plugin:
   {
     if(l.binding != r.binding) { return false; }
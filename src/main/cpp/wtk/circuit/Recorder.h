@@ -0,0 +1,163 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_CIRCUIT_RECORDER_H_
+#define WTK_CIRCUIT_RECORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <wtk/indexes.h>
+
+#include <wtk/circuit/Data.h>
+#include <wtk/circuit/Handler.h>
+
+namespace wtk {
+namespace circuit {
+
+/**
+ * The Recorder is a Handler which remembers each of its callbacks (with
+ * line numbers) so that the relation may be parsed once and then replayed
+ * into any number of other Handlers.
+ *
+ * The Recorder is unchanged by replay(), so multiple threads may replay
+ * it at once.
+ */
+template<typename Number_T>
+class Recorder : public Handler<Number_T>
+{
+  /**
+   * Each callback is recorded as a directive. Operands which don't fit a
+   * few wire indexes are held in a side table and referenced by index.
+   */
+  struct Directive
+  {
+    enum Operation : uint8_t
+    {
+      add,
+      mul,
+      addc,
+      mulc,
+      copy,
+      copyMulti,
+      assign,
+      assertZero,
+      publicIn,
+      publicInMulti,
+      privateIn,
+      privateInMulti,
+      convert,
+      newRange,
+      deleteRange,
+      startFunction,
+      regularFunction,
+      endFunction,
+      pluginFunction,
+      invoke
+    };
+
+    Operation operation;
+    type_idx type = 0;
+
+    // Convert only
+    type_idx inType = 0;
+    bool modulus = false;
+
+    // Wire operands or a side table index, per operation.
+    wire_idx first = 0;
+    wire_idx second = 0;
+    wire_idx third = 0;
+    wire_idx fourth = 0;
+
+    size_t lineNum;
+
+    Directive(Operation const op, type_idx const t, size_t const ln)
+      : operation(op), type(t), lineNum(ln) { }
+  };
+
+  std::vector<Directive> directives;
+
+  // side tables
+  std::vector<Number_T> constants;
+  std::vector<CopyMulti> copyMultis;
+  std::vector<FunctionSignature> signatures;
+  std::vector<PluginBinding<Number_T>> bindings;
+  std::vector<FunctionCall> calls;
+
+  Directive* record(typename Directive::Operation const op, type_idx const t);
+
+public:
+  bool addGate(wire_idx const out,
+      wire_idx const left, wire_idx const right, type_idx const type) final;
+
+  bool mulGate(wire_idx const out,
+      wire_idx const left, wire_idx const right, type_idx const type) final;
+
+  bool addcGate(wire_idx const out,
+      wire_idx const left, Number_T&& right, type_idx const type) final;
+
+  bool mulcGate(wire_idx const out,
+      wire_idx const left, Number_T&& right, type_idx const type) final;
+
+  bool copy(
+      wire_idx const out, wire_idx const left, type_idx const type) final;
+
+  bool copyMulti(CopyMulti* copy_multi) final;
+
+  bool assign(
+      wire_idx const out, Number_T&& left, type_idx const type) final;
+
+  bool assertZero(wire_idx const left, type_idx const type) final;
+
+  bool publicIn(wire_idx const out, type_idx const type) final;
+
+  bool publicInMulti(Range* outs, type_idx const type) final;
+
+  bool privateIn(wire_idx const out, type_idx const type) final;
+
+  bool privateInMulti(Range* outs, type_idx const type) final;
+
+  bool convert(
+      wire_idx const first_out, wire_idx const last_out,
+      type_idx const out_type,
+      wire_idx const first_in, wire_idx const last_in,
+      type_idx const in_type, bool modulus) final;
+
+  bool newRange(
+      wire_idx const first, wire_idx const last, type_idx const type) final;
+
+  bool deleteRange(
+      wire_idx const first, wire_idx const last, type_idx const type) final;
+
+  bool startFunction(FunctionSignature&& signature) final;
+
+  bool regularFunction() final;
+
+  bool endFunction() final;
+
+  bool pluginFunction(PluginBinding<Number_T>&& binding) final;
+
+  bool invoke(FunctionCall* const call) final;
+
+  /**
+   * Repeat each of the recorded callbacks to the given handler, stopping
+   * at the first failure.
+   *
+   * Returns false on failure.
+   */
+  bool replay(Handler<Number_T>* const handler) const;
+
+  /**
+   * Approximate bytes held by the recording (excluding the heap memory of
+   * its constants and names).
+   */
+  size_t bytes() const;
+};
+
+} } // namespace wtk::circuit
+
+#include <wtk/circuit/Recorder.t.h>
+
+#endif//WTK_CIRCUIT_RECORDER_H_
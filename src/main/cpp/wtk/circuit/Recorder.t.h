@@ -0,0 +1,352 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+namespace wtk {
+namespace circuit {
+
+template<typename Number_T>
+typename Recorder<Number_T>::Directive* Recorder<Number_T>::record(
+    typename Directive::Operation const op, type_idx const t)
+{
+  this->directives.emplace_back(op, t, this->lineNum);
+  return &this->directives.back();
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::addGate(wire_idx const out,
+    wire_idx const left, wire_idx const right, type_idx const type)
+{
+  Directive* const d = this->record(Directive::add, type);
+  d->first = out;
+  d->second = left;
+  d->third = right;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::mulGate(wire_idx const out,
+    wire_idx const left, wire_idx const right, type_idx const type)
+{
+  Directive* const d = this->record(Directive::mul, type);
+  d->first = out;
+  d->second = left;
+  d->third = right;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::addcGate(wire_idx const out,
+    wire_idx const left, Number_T&& right, type_idx const type)
+{
+  Directive* const d = this->record(Directive::addc, type);
+  d->first = out;
+  d->second = left;
+  d->third = this->constants.size();
+  this->constants.emplace_back(std::move(right));
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::mulcGate(wire_idx const out,
+    wire_idx const left, Number_T&& right, type_idx const type)
+{
+  Directive* const d = this->record(Directive::mulc, type);
+  d->first = out;
+  d->second = left;
+  d->third = this->constants.size();
+  this->constants.emplace_back(std::move(right));
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::copy(
+    wire_idx const out, wire_idx const left, type_idx const type)
+{
+  Directive* const d = this->record(Directive::copy, type);
+  d->first = out;
+  d->second = left;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::copyMulti(CopyMulti* copy_multi)
+{
+  Directive* const d = this->record(Directive::copyMulti, copy_multi->type);
+  d->first = this->copyMultis.size();
+  this->copyMultis.emplace_back(std::move(*copy_multi));
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::assign(
+    wire_idx const out, Number_T&& left, type_idx const type)
+{
+  Directive* const d = this->record(Directive::assign, type);
+  d->first = out;
+  d->second = this->constants.size();
+  this->constants.emplace_back(std::move(left));
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::assertZero(wire_idx const left, type_idx const type)
+{
+  Directive* const d = this->record(Directive::assertZero, type);
+  d->first = left;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::publicIn(wire_idx const out, type_idx const type)
+{
+  Directive* const d = this->record(Directive::publicIn, type);
+  d->first = out;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::publicInMulti(Range* outs, type_idx const type)
+{
+  Directive* const d = this->record(Directive::publicInMulti, type);
+  d->first = outs->first;
+  d->second = outs->last;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::privateIn(wire_idx const out, type_idx const type)
+{
+  Directive* const d = this->record(Directive::privateIn, type);
+  d->first = out;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::privateInMulti(Range* outs, type_idx const type)
+{
+  Directive* const d = this->record(Directive::privateInMulti, type);
+  d->first = outs->first;
+  d->second = outs->last;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::convert(
+    wire_idx const first_out, wire_idx const last_out,
+    type_idx const out_type,
+    wire_idx const first_in, wire_idx const last_in,
+    type_idx const in_type, bool modulus)
+{
+  Directive* const d = this->record(Directive::convert, out_type);
+  d->inType = in_type;
+  d->modulus = modulus;
+  d->first = first_out;
+  d->second = last_out;
+  d->third = first_in;
+  d->fourth = last_in;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::newRange(
+    wire_idx const first, wire_idx const last, type_idx const type)
+{
+  Directive* const d = this->record(Directive::newRange, type);
+  d->first = first;
+  d->second = last;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::deleteRange(
+    wire_idx const first, wire_idx const last, type_idx const type)
+{
+  Directive* const d = this->record(Directive::deleteRange, type);
+  d->first = first;
+  d->second = last;
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::startFunction(FunctionSignature&& signature)
+{
+  Directive* const d = this->record(Directive::startFunction, 0);
+  d->first = this->signatures.size();
+  this->signatures.emplace_back(std::move(signature));
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::regularFunction()
+{
+  this->record(Directive::regularFunction, 0);
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::endFunction()
+{
+  this->record(Directive::endFunction, 0);
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::pluginFunction(PluginBinding<Number_T>&& binding)
+{
+  Directive* const d = this->record(Directive::pluginFunction, 0);
+  d->first = this->bindings.size();
+  this->bindings.emplace_back(std::move(binding));
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::invoke(FunctionCall* const call)
+{
+  Directive* const d = this->record(Directive::invoke, 0);
+  d->first = this->calls.size();
+  this->calls.emplace_back(std::move(*call));
+  return true;
+}
+
+template<typename Number_T>
+bool Recorder<Number_T>::replay(Handler<Number_T>* const handler) const
+{
+  for(size_t i = 0; i < this->directives.size(); i++)
+  {
+    Directive const* const d = &this->directives[i];
+    handler->lineNum = d->lineNum;
+
+    bool success = false;
+    switch(d->operation)
+    {
+    case Directive::add:
+    {
+      success = handler->addGate(d->first, d->second, d->third, d->type);
+      break;
+    }
+    case Directive::mul:
+    {
+      success = handler->mulGate(d->first, d->second, d->third, d->type);
+      break;
+    }
+    case Directive::addc:
+    {
+      success = handler->addcGate(d->first, d->second,
+          Number_T(this->constants[(size_t) d->third]), d->type);
+      break;
+    }
+    case Directive::mulc:
+    {
+      success = handler->mulcGate(d->first, d->second,
+          Number_T(this->constants[(size_t) d->third]), d->type);
+      break;
+    }
+    case Directive::copy:
+    {
+      success = handler->copy(d->first, d->second, d->type);
+      break;
+    }
+    case Directive::copyMulti:
+    {
+      CopyMulti copy_multi(this->copyMultis[(size_t) d->first]);
+      success = handler->copyMulti(&copy_multi);
+      break;
+    }
+    case Directive::assign:
+    {
+      success = handler->assign(d->first,
+          Number_T(this->constants[(size_t) d->second]), d->type);
+      break;
+    }
+    case Directive::assertZero:
+    {
+      success = handler->assertZero(d->first, d->type);
+      break;
+    }
+    case Directive::publicIn:
+    {
+      success = handler->publicIn(d->first, d->type);
+      break;
+    }
+    case Directive::publicInMulti:
+    {
+      Range outs(d->first, d->second);
+      success = handler->publicInMulti(&outs, d->type);
+      break;
+    }
+    case Directive::privateIn:
+    {
+      success = handler->privateIn(d->first, d->type);
+      break;
+    }
+    case Directive::privateInMulti:
+    {
+      Range outs(d->first, d->second);
+      success = handler->privateInMulti(&outs, d->type);
+      break;
+    }
+    case Directive::convert:
+    {
+      success = handler->convert(d->first, d->second, d->type,
+          d->third, d->fourth, d->inType, d->modulus);
+      break;
+    }
+    case Directive::newRange:
+    {
+      success = handler->newRange(d->first, d->second, d->type);
+      break;
+    }
+    case Directive::deleteRange:
+    {
+      success = handler->deleteRange(d->first, d->second, d->type);
+      break;
+    }
+    case Directive::startFunction:
+    {
+      success = handler->startFunction(
+          FunctionSignature(this->signatures[(size_t) d->first]));
+      break;
+    }
+    case Directive::regularFunction:
+    {
+      success = handler->regularFunction();
+      break;
+    }
+    case Directive::endFunction:
+    {
+      success = handler->endFunction();
+      break;
+    }
+    case Directive::pluginFunction:
+    {
+      success = handler->pluginFunction(
+          PluginBinding<Number_T>(this->bindings[(size_t) d->first]));
+      break;
+    }
+    case Directive::invoke:
+    {
+      FunctionCall call(this->calls[(size_t) d->first]);
+      success = handler->invoke(&call);
+      break;
+    }
+    }
+
+    if(!success) { return false; }
+  }
+
+  return true;
+}
+
+template<typename Number_T>
+size_t Recorder<Number_T>::bytes() const
+{
+  return this->directives.capacity() * sizeof(Directive)
+    + this->constants.capacity() * sizeof(Number_T)
+    + this->copyMultis.capacity() * sizeof(CopyMulti)
+    + this->signatures.capacity() * sizeof(FunctionSignature)
+    + this->bindings.capacity() * sizeof(PluginBinding<Number_T>)
+    + this->calls.capacity() * sizeof(FunctionCall);
+}
+
+} } // namespace wtk::circuit
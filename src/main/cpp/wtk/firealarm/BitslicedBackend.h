@@ -0,0 +1,123 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_FIREALARM_BITSLICED_BACKEND_H_
+#define WTK_FIREALARM_BITSLICED_BACKEND_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <wtk/Parser.h>
+#include <wtk/circuit/Data.h>
+
+#include <wtk/firealarm/Wire.h>
+#include <wtk/firealarm/Counters.h>
+#include <wtk/firealarm/BooleanBackend.h>
+
+#define LOG_IDENTIFIER "wtk::firealarm"
+#include <stealth_logging.h>
+
+namespace wtk {
+namespace firealarm {
+
+/**
+ * The number of input sets which a BitslicedBackend evaluates at once.
+ */
+constexpr size_t BITSLICED_LANES = 64;
+
+/**
+ * An InputStream which reads one value from each of up to BITSLICED_LANES
+ * GF(2) input streams, and packs them into a single value, whose i'th bit
+ * is the i'th stream's (lane's) value.
+ *
+ * Each lane's stream header must already be parsed (by ParserOrganizer).
+ */
+template<typename Number_T>
+class LaneStream : public wtk::InputStream<Number_T>
+{
+  std::vector<wtk::InputStream<Number_T>*> const lanes;
+  std::vector<char const*> const names;
+
+public:
+  LaneStream(std::vector<wtk::InputStream<Number_T>*>&& ls,
+      std::vector<char const*>&& ns);
+
+  bool parseStreamHeader() override { return true; }
+
+  wtk::StreamStatus next(Number_T* num) override;
+
+  size_t lineNum() override { return this->lanes[0]->lineNum(); }
+};
+
+/**
+ * A GF(2) backend which evaluates BITSLICED_LANES input sets at once, by
+ * carrying one input set's value in each bit (lane) of a Wire<uint64_t>.
+ * Gates are bitwise (from BooleanBackend), constants are broadcast to every
+ * lane, and inputs are packed by a LaneStream.
+ *
+ * Assertions are tracked per lane, rather than failing the whole evaluation.
+ * Plugins which inspect wire values (RAM, mux, etc.) are not supported.
+ */
+template<typename Number_T>
+class BitslicedBackend : public BooleanBackend<Number_T, uint64_t>
+{
+public:
+  // The number of lanes in use, and a mask of their bits.
+  size_t const lanes;
+  uint64_t const laneMask;
+
+  // Mask of the lanes with a failed assertion, and each lane's first
+  // failing line number.
+  uint64_t failures = 0;
+  size_t failureLines[BITSLICED_LANES] = { 0 };
+
+  BitslicedBackend(
+      char const* const fn, wtk::circuit::TypeSpec<Number_T> const* const t,
+      TypeCounter* const c, bool sa, size_t const ls)
+    : BooleanBackend<Number_T, uint64_t>(fn, t, c, sa), lanes(ls),
+    laneMask(ls == BITSLICED_LANES ? UINT64_MAX : (UINT64_C(1) << ls) - 1)
+  {
+    log_assert(ls > 0 && ls <= BITSLICED_LANES);
+  }
+
+  void assign(Wire<uint64_t>* element, Number_T&& value) override;
+
+  void addcGate(Wire<uint64_t>* out,
+      Wire<uint64_t> const* left, Number_T&& right) override;
+
+  void mulcGate(Wire<uint64_t>* out,
+      Wire<uint64_t> const* left, Number_T&& right) override;
+
+  void assertZero(Wire<uint64_t> const* left) override;
+
+  // Constants are broadcast to all lanes.
+  void* prepareConstant(Number_T const& value) override;
+
+  // Inputs hold one bit per lane.
+  Number_T maxInputValue() const override;
+
+  bool check() override { return this->failures == 0; }
+
+  // A wire holds many values, so neither is supported.
+  bool supportsExtendedWitness() override { return false; }
+  bool supportsMemoization() override { return false; }
+
+  /**
+   * Indicates if the given lane passed all of its assertions.
+   */
+  bool checkLane(size_t const lane) const;
+
+private:
+  static uint64_t broadcast(Number_T const& value);
+};
+
+} } // namespace wtk::firealarm
+
+#include <wtk/firealarm/BitslicedBackend.t.h>
+
+#define LOG_UNINCLUDE
+#include <stealth_logging.h>
+
+#endif//WTK_FIREALARM_BITSLICED_BACKEND_H_
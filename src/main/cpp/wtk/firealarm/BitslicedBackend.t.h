@@ -0,0 +1,136 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+namespace wtk {
+namespace firealarm {
+
+template<typename Number_T>
+LaneStream<Number_T>::LaneStream(
+    std::vector<wtk::InputStream<Number_T>*>&& ls,
+    std::vector<char const*>&& ns)
+  : lanes(std::move(ls)), names(std::move(ns))
+{
+  log_assert(this->lanes.size() > 0
+      && this->lanes.size() <= BITSLICED_LANES
+      && this->lanes.size() == this->names.size());
+
+  this->type.reset(new wtk::circuit::TypeSpec<Number_T>(
+        Number_T(this->lanes[0]->type->prime)));
+}
+
+template<typename Number_T>
+wtk::StreamStatus LaneStream<Number_T>::next(Number_T* num)
+{
+  uint64_t packed = 0;
+  wtk::StreamStatus status = wtk::StreamStatus::error;
+
+  for(size_t i = 0; i < this->lanes.size(); i++)
+  {
+    Number_T value(0);
+    wtk::StreamStatus const lane_status = this->lanes[i]->next(&value);
+
+    if(lane_status == wtk::StreamStatus::error)
+    {
+      return wtk::StreamStatus::error;
+    }
+    else if(i != 0 && lane_status != status)
+    {
+      log_error("%s:%zu: stream length differs from %s", this->names[i],
+          this->lanes[i]->lineNum(), this->names[0]);
+      return wtk::StreamStatus::error;
+    }
+    else if(lane_status == wtk::StreamStatus::success)
+    {
+      if(this->type->prime <= value)
+      {
+        log_error("%s:%zu: stream value %s exceeds field maximum",
+            this->names[i], this->lanes[i]->lineNum(),
+            wtk::utils::dec(value).c_str());
+        return wtk::StreamStatus::error;
+      }
+
+      packed |= (uint64_t) (value != Number_T(0)) << i;
+    }
+
+    status = lane_status;
+  }
+
+  *num = Number_T(packed);
+  return status;
+}
+
+template<typename Number_T>
+uint64_t BitslicedBackend<Number_T>::broadcast(Number_T const& value)
+{
+  return value == Number_T(0) ? UINT64_C(0) : UINT64_MAX;
+}
+
+template<typename Number_T>
+void BitslicedBackend<Number_T>::assign(
+    Wire<uint64_t>* const element, Number_T&& value)
+{
+  uint64_t const prepared = broadcast(value);
+  this->assignPrepared(element, &prepared);
+}
+
+template<typename Number_T>
+void BitslicedBackend<Number_T>::addcGate(
+    Wire<uint64_t>* const out, Wire<uint64_t> const* left, Number_T&& right)
+{
+  uint64_t const prepared = broadcast(right);
+  this->addcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T>
+void BitslicedBackend<Number_T>::mulcGate(
+    Wire<uint64_t>* const out, Wire<uint64_t> const* left, Number_T&& right)
+{
+  uint64_t const prepared = broadcast(right);
+  this->mulcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T>
+void* BitslicedBackend<Number_T>::prepareConstant(Number_T const& value)
+{
+  return new uint64_t(broadcast(value));
+}
+
+template<typename Number_T>
+Number_T BitslicedBackend<Number_T>::maxInputValue() const
+{
+  return Number_T(1) << this->lanes;
+}
+
+template<typename Number_T>
+void BitslicedBackend<Number_T>::assertZero(Wire<uint64_t> const* left)
+{
+  if(this->trace)
+  {
+    log_info("%s:%zu: %s<- %s", this->fileName, this->lineNum,
+        this->indent->get(), wtk::utils::dec(left->value).c_str());
+  }
+
+  this->counter->assertZero += 1;
+  if(this->suppressAsserts) { return; }
+
+  // Record the line of each lane's first failure.
+  uint64_t fresh = left->value & this->laneMask & ~this->failures;
+  this->failures |= fresh;
+  while(fresh != 0)
+  {
+    size_t i = 0;
+    while((fresh & (UINT64_C(1) << i)) == 0) { i++; }
+
+    this->failureLines[i] = this->lineNum;
+    fresh &= ~(UINT64_C(1) << i);
+  }
+}
+
+template<typename Number_T>
+bool BitslicedBackend<Number_T>::checkLane(size_t const lane) const
+{
+  return (this->failures & (UINT64_C(1) << lane)) == 0;
+}
+
+} } // namespace wtk::firealarm
@@ -0,0 +1,80 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_FIREALARM_BOOLEAN_BACKEND_H_
+#define WTK_FIREALARM_BOOLEAN_BACKEND_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <wtk/circuit/Data.h>
+
+#include <wtk/firealarm/Wire.h>
+#include <wtk/firealarm/Counters.h>
+#include <wtk/firealarm/FieldBackend.h>
+
+#define LOG_IDENTIFIER "wtk::firealarm"
+#include <stealth_logging.h>
+
+namespace wtk {
+namespace firealarm {
+
+/**
+ * A FieldBackend for GF(2), where addition is XOR and multiplication is AND,
+ * rather than reduction by the % operator.
+ *
+ * Wires remain Wire<uint8_t>, one per byte, because the NAILS Scope, RAM and
+ * plugins all address a Wire_T per wire. Hence it may stand in for any
+ * FieldBackend<Number_T, uint8_t>, such as the index type of a BoolRAM.
+ * Wider Wire_Ts operate bitwise, as for the BitslicedBackend.
+ */
+template<typename Number_T, typename Wire_T = uint8_t>
+class BooleanBackend : public FieldBackend<Number_T, Wire_T>
+{
+public:
+  BooleanBackend(
+      char const* const fn, wtk::circuit::TypeSpec<Number_T> const* const t,
+      TypeCounter* const c, bool sa)
+    : FieldBackend<Number_T, Wire_T>(fn, t, c, sa)
+  {
+    log_assert(t->prime == 2);
+  }
+
+  void addGate(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, Wire<Wire_T> const* right) override;
+
+  void mulGate(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, Wire<Wire_T> const* right) override;
+
+  void addcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
+  void mulcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
+  // Batches are evaluated in a single loop, unless tracing.
+  void addGates(Wire<Wire_T>* const* outs, Wire<Wire_T> const* const* lefts,
+      Wire<Wire_T> const* const* rights, size_t const n) override;
+
+  void mulGates(Wire<Wire_T>* const* outs, Wire<Wire_T> const* const* lefts,
+      Wire<Wire_T> const* const* rights, size_t const n) override;
+
+  void addcGates(Wire<Wire_T>* const* outs, Wire<Wire_T> const* const* lefts,
+      void const* const* rights, size_t const n) override;
+
+  void mulcGates(Wire<Wire_T>* const* outs, Wire<Wire_T> const* const* lefts,
+      void const* const* rights, size_t const n) override;
+
+private:
+  void traceOut(Wire<Wire_T> const* out);
+};
+
+} } // namespace wtk::firealarm
+
+#include <wtk/firealarm/BooleanBackend.t.h>
+
+#define LOG_UNINCLUDE
+#include <stealth_logging.h>
+
+#endif//WTK_FIREALARM_BOOLEAN_BACKEND_H_
@@ -0,0 +1,154 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+namespace wtk {
+namespace firealarm {
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::traceOut(Wire<Wire_T> const* out)
+{
+  if(this->trace)
+  {
+    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
+        this->indent->get(), wtk::utils::dec(out->value).c_str());
+  }
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::addGate(Wire<Wire_T>* const out,
+    Wire<Wire_T> const* left, Wire<Wire_T> const* right)
+{
+  this->counter->add++;
+  this->counter->increment();
+  out->value = left->value ^ right->value;
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::mulGate(Wire<Wire_T>* const out,
+    Wire<Wire_T> const* left, Wire<Wire_T> const* right)
+{
+  this->counter->mul++;
+  this->counter->increment();
+  out->value = left->value & right->value;
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::addcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
+{
+  this->counter->mul++;
+  this->counter->increment();
+  out->value = left->value ^ *(Wire_T const*) right;
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::mulcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
+{
+  this->counter->mul++;
+  this->counter->increment();
+  out->value = left->value & *(Wire_T const*) right;
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::addGates(Wire<Wire_T>* const* outs,
+    Wire<Wire_T> const* const* lefts, Wire<Wire_T> const* const* rights,
+    size_t const n)
+{
+  if(this->trace)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->addGate(outs[i], lefts[i], rights[i]);
+    }
+    return;
+  }
+
+  this->counter->add += n;
+  this->counter->increment(n);
+  for(size_t i = 0; i < n; i++)
+  {
+    outs[i]->value = lefts[i]->value ^ rights[i]->value;
+    outs[i]->counter = this->counter;
+  }
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::mulGates(Wire<Wire_T>* const* outs,
+    Wire<Wire_T> const* const* lefts, Wire<Wire_T> const* const* rights,
+    size_t const n)
+{
+  if(this->trace)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->mulGate(outs[i], lefts[i], rights[i]);
+    }
+    return;
+  }
+
+  this->counter->mul += n;
+  this->counter->increment(n);
+  for(size_t i = 0; i < n; i++)
+  {
+    outs[i]->value = lefts[i]->value & rights[i]->value;
+    outs[i]->counter = this->counter;
+  }
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::addcGates(Wire<Wire_T>* const* outs,
+    Wire<Wire_T> const* const* lefts, void const* const* rights,
+    size_t const n)
+{
+  if(this->trace)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->addcPrepared(outs[i], lefts[i], rights[i]);
+    }
+    return;
+  }
+
+  this->counter->mul += n;
+  this->counter->increment(n);
+  for(size_t i = 0; i < n; i++)
+  {
+    outs[i]->value = lefts[i]->value ^ *(Wire_T const*) rights[i];
+    outs[i]->counter = this->counter;
+  }
+}
+
+template<typename Number_T, typename Wire_T>
+void BooleanBackend<Number_T, Wire_T>::mulcGates(Wire<Wire_T>* const* outs,
+    Wire<Wire_T> const* const* lefts, void const* const* rights,
+    size_t const n)
+{
+  if(this->trace)
+  {
+    for(size_t i = 0; i < n; i++)
+    {
+      this->mulcPrepared(outs[i], lefts[i], rights[i]);
+    }
+    return;
+  }
+
+  this->counter->mul += n;
+  this->counter->increment(n);
+  for(size_t i = 0; i < n; i++)
+  {
+    outs[i]->value = lefts[i]->value & *(Wire_T const*) rights[i];
+    outs[i]->counter = this->counter;
+  }
+}
+
+} } // namespace wtk::firealarm
@@ -21,6 +21,7 @@ class Converter : public wtk::Converter<Wire<OutWire_T>, Wire<InWire_T>>
 {
 public:
 
+  // The radix of each type: a field's prime or 2^bitWidth for a ring.
   Number_T outPrime;
   Number_T inPrime;
 
@@ -14,7 +14,10 @@ void Converter<Number_T, OutWire_T, InWire_T>::convert(
   Number_T val(0);
   for(size_t i = 0; i < this->inLength; i++)
   {
-    val = (val * this->inPrime) + static_cast<Number_T>(in_wires[i].value);
+    // An unreduced sum (see FieldBackend) is reduced here.
+    Number_T digit = static_cast<Number_T>(in_wires[i].value);
+    if(in_wires[i].counter.excess() != 0) { digit = digit % this->inPrime; }
+    val = (val * this->inPrime) + digit;
   }
 
   this->outTypeCounter->converts += this->outLength;
@@ -6,6 +6,10 @@
 #define WTK_FIREALARM_COUNTER_
 
 #include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 #define LOG_IDENTIFIER "counters"
 #include <stealth_logging.h>
@@ -13,6 +17,143 @@
 namespace wtk {
 namespace firealarm {
 
+struct TypeCounter;
+
+/**
+ * A table of all live TypeCounters, so that a wire may refer to its counter
+ * by a 32-bit index (see CounterRef), rather than a 64-bit pointer.
+ *
+ * The table grows by blocks, which never move, so that indexes may be
+ * resolved without locking while other threads add counters. Indexes of
+ * removed counters are reused. Index 0 is reserved for null. There are at
+ * most 2^24 indexes (see CounterRef).
+ */
+class CounterTable
+{
+  static constexpr size_t BLOCK_BITS = 12;
+  static constexpr size_t BLOCK_SIZE = 1 << BLOCK_BITS;
+  static constexpr size_t MAX_BLOCKS = 1 << 12;
+
+  std::atomic<TypeCounter**> blocks[MAX_BLOCKS];
+
+  std::mutex mutex;
+  std::vector<uint32_t> freeIndexes;
+  size_t next = 1;
+
+  CounterTable()
+  {
+    for(size_t i = 0; i < MAX_BLOCKS; i++) { this->blocks[i] = nullptr; }
+  }
+
+public:
+  CounterTable(CounterTable const&) = delete;
+  CounterTable& operator=(CounterTable const&) = delete;
+
+  ~CounterTable()
+  {
+    for(size_t i = 0; i < MAX_BLOCKS; i++) { delete[] this->blocks[i].load(); }
+  }
+
+  static CounterTable* instance()
+  {
+    static CounterTable table;
+    return &table;
+  }
+
+  uint32_t add(TypeCounter* const counter)
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    size_t idx;
+    if(this->freeIndexes.size() != 0)
+    {
+      idx = this->freeIndexes.back();
+      this->freeIndexes.pop_back();
+    }
+    else
+    {
+      log_assert(this->next < BLOCK_SIZE * MAX_BLOCKS);
+      idx = this->next++;
+      if(this->blocks[idx >> BLOCK_BITS].load() == nullptr)
+      {
+        this->blocks[idx >> BLOCK_BITS].store(
+            new TypeCounter*[BLOCK_SIZE], std::memory_order_release);
+      }
+    }
+
+    this->blocks[idx >> BLOCK_BITS].load()[idx & (BLOCK_SIZE - 1)] = counter;
+    return static_cast<uint32_t>(idx);
+  }
+
+  void remove(uint32_t const idx)
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->freeIndexes.push_back(idx);
+  }
+
+  TypeCounter* get(uint32_t const idx) const
+  {
+    return this->blocks[idx >> BLOCK_BITS].load(std::memory_order_acquire)
+      [idx & (BLOCK_SIZE - 1)];
+  }
+};
+
+/**
+ * A wire's reference to its TypeCounter, by index in the CounterTable. A
+ * wire of up to 32 bits is thus 8 bytes, rather than 16 with a pointer.
+ *
+ * It is resolved only when a wire is destroyed. The lookup adds under a
+ * nanosecond to the destructor, whose cost is mostly the shared atomic
+ * active-wire counters (see TypeCounter::decrement()).
+ *
+ * The index takes the low 24 bits, and the high 8 bits hold the excess of
+ * an unreduced field wire (see FieldBackend). Assigning a counter resets
+ * the excess to 0.
+ */
+class CounterRef
+{
+  static constexpr uint32_t INDEX_MASK = (1 << 24) - 1;
+
+  uint32_t bits = 0;
+
+public:
+  CounterRef() = default;
+
+  CounterRef(std::nullptr_t) { }
+
+  CounterRef(TypeCounter* const counter) { *this = counter; }
+
+  CounterRef& operator=(TypeCounter* const counter);
+
+  CounterRef& operator=(std::nullptr_t)
+  {
+    this->bits = 0;
+    return *this;
+  }
+
+  bool operator==(std::nullptr_t) const
+  {
+    return (this->bits & INDEX_MASK) == 0;
+  }
+
+  bool operator!=(std::nullptr_t) const
+  {
+    return (this->bits & INDEX_MASK) != 0;
+  }
+
+  TypeCounter* operator->() const
+  {
+    return CounterTable::instance()->get(this->bits & INDEX_MASK);
+  }
+
+  uint8_t excess() const { return static_cast<uint8_t>(this->bits >> 24); }
+
+  void setExcess(uint8_t const excess)
+  {
+    this->bits = (this->bits & INDEX_MASK) | (uint32_t) excess << 24;
+  }
+};
+
 // This is a counter for all the gate counts and directives that can be
 // done within a single type.
 //
@@ -41,9 +182,10 @@ struct TypeCounter
   size_t currentActive = 0;
   size_t maximumActive = 0;
 
-  // Active wire counters for all fields
-  size_t* const totalCurrentActive;
-  size_t* const totalMaximumActive;
+  // Active wire counters for all fields. These are shared by types which
+  // may be evaluated on different threads.
+  std::atomic<size_t>* const totalCurrentActive;
+  std::atomic<size_t>* const totalMaximumActive;
 
   // Indicates if this type is a RAM type
   bool const ram;
@@ -57,8 +199,30 @@ struct TypeCounter
   size_t currentAlloc = 0;
   size_t maxAlloc = 0;
 
-  TypeCounter(size_t* const tca, size_t* const tma, bool r = false)
-    : totalCurrentActive(tca), totalMaximumActive(tma), ram(r) { }
+  // Index in the CounterTable
+  uint32_t const index;
+
+  TypeCounter(std::atomic<size_t>* const tca,
+      std::atomic<size_t>* const tma, bool r = false)
+    : totalCurrentActive(tca), totalMaximumActive(tma), ram(r),
+    index(CounterTable::instance()->add(this)) { }
+
+  // A copy has its own index.
+  TypeCounter(TypeCounter const& other)
+    : add(other.add), mul(other.mul), addc(other.addc), mulc(other.mulc),
+    copy(other.copy), assign(other.assign), assertZero(other.assertZero),
+    publicIn(other.publicIn), privateIn(other.privateIn),
+    converts(other.converts), currentActive(other.currentActive),
+    maximumActive(other.maximumActive),
+    totalCurrentActive(other.totalCurrentActive),
+    totalMaximumActive(other.totalMaximumActive), ram(other.ram),
+    init(other.init), read(other.read), write(other.write),
+    totalAlloc(other.totalAlloc), currentAlloc(other.currentAlloc),
+    maxAlloc(other.maxAlloc), index(CounterTable::instance()->add(this)) { }
+
+  TypeCounter& operator=(TypeCounter const&) = delete;
+
+  ~TypeCounter() { CounterTable::instance()->remove(this->index); }
 
   // Increment the maximum wire counters
   void increment(size_t const count = 1)
@@ -71,11 +235,11 @@ struct TypeCounter
         this->maximumActive = this->currentActive;
       }
 
-      *this->totalCurrentActive += count;
-      if(*this->totalCurrentActive > *this->totalMaximumActive)
-      {
-        *this->totalMaximumActive = *this->totalCurrentActive;
-      }
+      size_t const total = *this->totalCurrentActive += count;
+      size_t maximum = this->totalMaximumActive->load();
+      while(total > maximum
+          && !this->totalMaximumActive->compare_exchange_weak(maximum, total))
+      { }
     }
     else
     {
@@ -170,6 +334,12 @@ struct TypeCounter
   }
 };
 
+inline CounterRef& CounterRef::operator=(TypeCounter* const counter)
+{
+  this->bits = counter == nullptr ? 0 : counter->index;
+  return *this;
+}
+
 } } // namespace wtk::firealarm
 
 #define LOG_UNINCLUDE
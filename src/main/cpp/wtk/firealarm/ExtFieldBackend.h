@@ -0,0 +1,147 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_FIREALARM_EXT_FIELD_BACKEND_H_
+#define WTK_FIREALARM_EXT_FIELD_BACKEND_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <wtk/indexes.h>
+#include <wtk/TypeBackend.h>
+#include <wtk/circuit/Data.h>
+#include <wtk/utils/NumUtils.h>
+#include <wtk/utils/Extension.h>
+
+#include <wtk/firealarm/Wire.h>
+#include <wtk/firealarm/Counters.h>
+#include <wtk/firealarm/FieldBackend.h>
+
+#include <wtk/utils/Indent.h>
+
+#define LOG_IDENTIFIER "wtk::firealarm"
+#include <stealth_logging.h>
+
+namespace wtk {
+namespace firealarm {
+
+/**
+ * A backend for extension fields of degree at most N, over a prime field of
+ * at most 64 bits. Wires are polynomials with a fixed-size coefficient array
+ * (see wtk::utils::Extension), which are encoded to and from Number_T as the
+ * coefficients' digits in base p.
+ */
+template<typename Number_T, size_t N>
+class ExtFieldBackend
+  : public wtk::TypeBackend<Number_T, Wire<wtk::utils::ExtElement<N>>>
+{
+public:
+  typedef wtk::utils::ExtElement<N> Wire_T;
+
+  char const* const fileName;
+
+  // The base field's prime.
+  Number_T const prime;
+
+  // Arithmetic in the extension field.
+  wtk::utils::Extension<N> const ext;
+
+  TypeCounter* const counter;
+
+  bool suppressAsserts;
+  bool trace = false;
+  wtk::utils::Indent const* indent = nullptr;
+
+  ExtFieldBackend(
+      char const* const fn, wtk::circuit::TypeSpec<Number_T> const* const t,
+      TypeCounter* const c, bool sa)
+    : wtk::TypeBackend<Number_T, Wire<Wire_T>>(t), fileName(fn),
+    prime(t->prime), ext(makeExtension(t)), counter(c), suppressAsserts(sa)
+  {
+    log_assert(t->variety == wtk::circuit::TypeSpec<Number_T>::extField
+        && t->degree <= N);
+  }
+
+  void enableTrace(wtk::utils::Indent const* const idt);
+
+  void assign(Wire<Wire_T>* element, Number_T&& value) override;
+
+  void copy(Wire<Wire_T>* element, Wire<Wire_T> const* value) override;
+
+  void addGate(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, Wire<Wire_T> const* right) override;
+
+  void mulGate(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, Wire<Wire_T> const* right) override;
+
+  void addcGate(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, Number_T&& right) override;
+
+  void mulcGate(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, Number_T&& right) override;
+
+  void assertZero(Wire<Wire_T> const* left) override;
+
+  // Constants are prepared by conversion to Wire_T.
+  void* prepareConstant(Number_T const& value) override;
+
+  void releaseConstant(void* constant) override;
+
+  void assignPrepared(Wire<Wire_T>* element, void const* value) override;
+
+  void addcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
+  void mulcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
+  void publicIn(Wire<Wire_T>* element, Number_T&& value) override;
+
+  void privateIn(Wire<Wire_T>* element, Number_T&& value) override;
+
+  bool check() override;
+
+  bool supportsExtendedWitness() override { return true; }
+
+  Number_T getExtendedWitness(Wire<Wire_T> const* wire) override;
+
+  wire_idx getExtendedWitnessIdx(Wire<Wire_T> const* wire) override;
+
+  // Memoized as by the FieldBackend.
+  bool supportsMemoization() override { return true; }
+
+  void memoKey(Wire<Wire_T> const* wire, std::string* key) override;
+
+  void memoAssign(Wire<Wire_T>* wire, Number_T const& value) override;
+
+  std::unique_ptr<wtk::MemoRecord> beginMemo() override;
+
+  void endMemo(wtk::MemoRecord* record) override;
+
+  void replayMemo(wtk::MemoRecord const* record) override;
+
+  // starts as false (no failure) and may be set to indicate a failure at end
+  bool fail = false;
+
+  // Conversion between Number_T and the coefficients of Wire_T.
+  Wire_T encode(Number_T value) const;
+  Number_T decode(Wire_T const& value) const;
+
+private:
+  static wtk::utils::Extension<N> makeExtension(
+      wtk::circuit::TypeSpec<Number_T> const* const t);
+
+  void traceOut(Wire<Wire_T> const* out);
+};
+
+} } // namespace wtk::firealarm
+
+#include <wtk/firealarm/ExtFieldBackend.t.h>
+
+#define LOG_UNINCLUDE
+#include <stealth_logging.h>
+
+#endif//WTK_FIREALARM_EXT_FIELD_BACKEND_H_
@@ -0,0 +1,270 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+namespace wtk {
+namespace firealarm {
+
+template<typename Number_T, size_t N>
+wtk::utils::Extension<N> ExtFieldBackend<Number_T, N>::makeExtension(
+    wtk::circuit::TypeSpec<Number_T> const* const t)
+{
+  uint64_t modulus[N] = { 0 };
+  Number_T rest(t->modulus);
+  for(size_t i = 0; i < t->degree; i++)
+  {
+    modulus[i] = static_cast<uint64_t>(Number_T(rest % t->prime));
+    rest = Number_T(rest / t->prime);
+  }
+
+  return wtk::utils::Extension<N>(
+      static_cast<uint64_t>(t->prime), t->degree, modulus);
+}
+
+template<typename Number_T, size_t N>
+typename ExtFieldBackend<Number_T, N>::Wire_T
+ExtFieldBackend<Number_T, N>::encode(Number_T value) const
+{
+  Wire_T ret;
+  for(size_t i = 0; i < this->ext.degree; i++)
+  {
+    ret.coeffs[i] = static_cast<uint64_t>(Number_T(value % this->prime));
+    value = Number_T(value / this->prime);
+  }
+
+  return ret;
+}
+
+template<typename Number_T, size_t N>
+Number_T ExtFieldBackend<Number_T, N>::decode(Wire_T const& value) const
+{
+  Number_T ret(0);
+  for(size_t i = this->ext.degree; i > 0; i--)
+  {
+    ret = Number_T(ret * this->prime);
+    ret = Number_T(ret + Number_T(value.coeffs[i - 1]));
+  }
+
+  return ret;
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::enableTrace(
+    wtk::utils::Indent const* const idt)
+{
+  this->trace = true;
+  this->indent = idt;
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::traceOut(Wire<Wire_T> const* out)
+{
+  if(this->trace)
+  {
+    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
+        this->indent->get(), wtk::utils::dec(this->decode(out->value)).c_str());
+  }
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::assign(
+    Wire<Wire_T>* const element, Number_T&& value)
+{
+  Wire_T const prepared = this->encode(value);
+  this->assignPrepared(element, &prepared);
+}
+
+template<typename Number_T, size_t N>
+void* ExtFieldBackend<Number_T, N>::prepareConstant(Number_T const& value)
+{
+  return new Wire_T(this->encode(value));
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::releaseConstant(void* constant)
+{
+  delete (Wire_T*) constant;
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::assignPrepared(
+    Wire<Wire_T>* const element, void const* value)
+{
+  this->counter->assign++;
+  this->counter->increment();
+  element->value = *(Wire_T const*) value;
+  element->counter = this->counter;
+  this->traceOut(element);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::copy(
+    Wire<Wire_T>* const element, Wire<Wire_T> const* value)
+{
+  this->counter->copy++;
+  this->counter->increment();
+  element->value = value->value;
+  element->counter = this->counter;
+  this->traceOut(element);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::addGate(Wire<Wire_T>* const out,
+    Wire<Wire_T> const* left, Wire<Wire_T> const* right)
+{
+  this->counter->add++;
+  this->counter->increment();
+  out->value = this->ext.add(left->value, right->value);
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::mulGate(Wire<Wire_T>* const out,
+    Wire<Wire_T> const* left, Wire<Wire_T> const* right)
+{
+  this->counter->mul++;
+  this->counter->increment();
+  out->value = this->ext.mul(left->value, right->value);
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::addcGate(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, Number_T&& right)
+{
+  Wire_T const prepared = this->encode(right);
+  this->addcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::addcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
+{
+  this->counter->addc++;
+  this->counter->increment();
+  out->value = this->ext.add(left->value, *(Wire_T const*) right);
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::mulcGate(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, Number_T&& right)
+{
+  Wire_T const prepared = this->encode(right);
+  this->mulcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::mulcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
+{
+  this->counter->mulc++;
+  this->counter->increment();
+  out->value = this->ext.mul(left->value, *(Wire_T const*) right);
+  out->counter = this->counter;
+  this->traceOut(out);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::assertZero(Wire<Wire_T> const* left)
+{
+  if(this->trace)
+  {
+    log_info("%s:%zu: %s<- %s", this->fileName, this->lineNum,
+        this->indent->get(),
+        wtk::utils::dec(this->decode(left->value)).c_str());
+  }
+
+  this->counter->assertZero += 1;
+  if(!this->suppressAsserts && !left->value.isZero())
+  {
+    log_error("%s:%zu: Assert zero failed at value %s",
+        this->fileName, this->lineNum,
+        wtk::utils::dec(this->decode(left->value)).c_str());
+    this->fail = true;
+  }
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::publicIn(
+    Wire<Wire_T>* const element, Number_T&& value)
+{
+  this->counter->publicIn++;
+  this->counter->increment();
+  element->value = this->encode(value);
+  element->counter = this->counter;
+  this->traceOut(element);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::privateIn(
+    Wire<Wire_T>* const element, Number_T&& value)
+{
+  this->counter->privateIn++;
+  this->counter->increment();
+  element->value = this->encode(value);
+  element->counter = this->counter;
+  this->traceOut(element);
+}
+
+template<typename Number_T, size_t N>
+bool ExtFieldBackend<Number_T, N>::check()
+{
+  return !this->fail;
+}
+
+template<typename Number_T, size_t N>
+Number_T ExtFieldBackend<Number_T, N>::getExtendedWitness(
+    Wire<Wire_T> const* wire)
+{
+  return this->decode(wire->value);
+}
+
+template<typename Number_T, size_t N>
+wire_idx ExtFieldBackend<Number_T, N>::getExtendedWitnessIdx(
+    Wire<Wire_T> const* wire)
+{
+  return static_cast<wire_idx>(this->decode(wire->value));
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::memoKey(
+    Wire<Wire_T> const* wire, std::string* key)
+{
+  memoEncode(wire->value, key);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::memoAssign(
+    Wire<Wire_T>* wire, Number_T const& value)
+{
+  this->counter->increment();
+  wire->value = this->encode(value);
+  wire->counter = this->counter;
+}
+
+template<typename Number_T, size_t N>
+std::unique_ptr<wtk::MemoRecord> ExtFieldBackend<Number_T, N>::beginMemo()
+{
+  std::unique_ptr<CounterMemoRecord> record(new CounterMemoRecord());
+  record->begin(this->counter);
+  return std::unique_ptr<wtk::MemoRecord>(std::move(record));
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::endMemo(wtk::MemoRecord* record)
+{
+  static_cast<CounterMemoRecord*>(record)->end(this->counter);
+}
+
+template<typename Number_T, size_t N>
+void ExtFieldBackend<Number_T, N>::replayMemo(
+    wtk::MemoRecord const* record)
+{
+  static_cast<CounterMemoRecord const*>(record)->replay(this->counter);
+}
+
+} } // namespace wtk::firealarm
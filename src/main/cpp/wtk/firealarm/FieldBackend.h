@@ -6,11 +6,15 @@
 #define WTK_FIREALARM_FIELD_BACKEND_H_
 
 #include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
 
 #include <wtk/indexes.h>
 #include <wtk/TypeBackend.h>
 #include <wtk/circuit/Data.h>
 #include <wtk/utils/NumUtils.h>
+#include <wtk/utils/Modulus.h>
 
 #include <wtk/firealarm/Wire.h>
 #include <wtk/firealarm/Counters.h>
@@ -23,6 +27,84 @@
 namespace wtk {
 namespace firealarm {
 
+/**
+ * Side effects of a memoized call on a TypeCounter: the gates counted by
+ * the call, and the rise of active wires above their count at its start.
+ */
+struct CounterMemoRecord : public wtk::MemoRecord
+{
+  size_t add = 0;
+  size_t mul = 0;
+  size_t addc = 0;
+  size_t mulc = 0;
+  size_t copy = 0;
+  size_t assign = 0;
+  size_t assertZero = 0;
+
+  size_t startActive = 0;
+  size_t savedMaximum = 0;
+  size_t rise = 0;
+
+  size_t bytes() const override { return sizeof(CounterMemoRecord); }
+
+  // Note the counter at the start of a call, and measure the call's own
+  // maximum active wires (restoring the outer maximum at its end).
+  void begin(TypeCounter* const counter)
+  {
+    this->add = counter->add;
+    this->mul = counter->mul;
+    this->addc = counter->addc;
+    this->mulc = counter->mulc;
+    this->copy = counter->copy;
+    this->assign = counter->assign;
+    this->assertZero = counter->assertZero;
+
+    this->startActive = counter->currentActive;
+    this->savedMaximum = counter->maximumActive;
+    counter->maximumActive = counter->currentActive;
+  }
+
+  // Take the difference of the counter since begin().
+  void end(TypeCounter* const counter)
+  {
+    this->add = counter->add - this->add;
+    this->mul = counter->mul - this->mul;
+    this->addc = counter->addc - this->addc;
+    this->mulc = counter->mulc - this->mulc;
+    this->copy = counter->copy - this->copy;
+    this->assign = counter->assign - this->assign;
+    this->assertZero = counter->assertZero - this->assertZero;
+
+    this->rise = counter->maximumActive - this->startActive;
+    if(this->savedMaximum > counter->maximumActive)
+    {
+      counter->maximumActive = this->savedMaximum;
+    }
+  }
+
+  // Add the call's side effects to the counter.
+  void replay(TypeCounter* const counter) const
+  {
+    counter->add += this->add;
+    counter->mul += this->mul;
+    counter->addc += this->addc;
+    counter->mulc += this->mulc;
+    counter->copy += this->copy;
+    counter->assign += this->assign;
+    counter->assertZero += this->assertZero;
+
+    // Raise the maximum active wires as the call would have.
+    counter->increment(this->rise);
+    counter->decrement(this->rise);
+  }
+};
+
+/**
+ * Field wires hold residues, but sums are left unreduced while they fit in
+ * Wire_T (see wtk::utils::Modulus::sum()). Each wire's excess is held by its
+ * CounterRef, and its value is reduced before it is multiplied, asserted,
+ * traced or read (e.g. as an extended witness, or by a converter or RAM).
+ */
 template<typename Number_T, typename Wire_T>
 class FieldBackend : public wtk::TypeBackend<Number_T, Wire<Wire_T>>
 {
@@ -31,6 +113,9 @@ public:
 
   Wire_T const primeWire;
 
+  // Reduction of sums and products modulo the prime.
+  wtk::utils::Modulus<Wire_T> const modulus;
+
   TypeCounter* const counter;
 
   bool suppressAsserts;
@@ -41,7 +126,8 @@ public:
       char const* const fn, wtk::circuit::TypeSpec<Number_T> const* const t,
       TypeCounter* const c, bool sa)
     : wtk::TypeBackend<Number_T, Wire<Wire_T>>(t),
-    fileName(fn), primeWire(static_cast<Wire_T>(t->prime)), counter(c),
+    fileName(fn), primeWire(static_cast<Wire_T>(t->prime)),
+    modulus(this->primeWire), counter(c),
     suppressAsserts(sa)
   {
     log_assert(t->variety == wtk::circuit::TypeSpec<Number_T>::field);
@@ -49,6 +135,13 @@ public:
 
   void enableTrace(wtk::utils::Indent const* const idt);
 
+  // The wire's reduced value. Gates use the value directly when it is
+  // already reduced, so that a bignum isn't copied.
+  Wire_T canonical(Wire<Wire_T> const* const wire) const
+  {
+    return this->modulus.canonical(wire->value, wire->counter.excess());
+  }
+
   void assign(Wire<Wire_T>* element, Number_T&& value) override;
 
   void copy(Wire<Wire_T>* element, Wire<Wire_T> const* value) override;
@@ -67,6 +160,19 @@ public:
 
   void assertZero(Wire<Wire_T> const* left) override;
 
+  // Constants are prepared by conversion to Wire_T.
+  void* prepareConstant(Number_T const& value) override;
+
+  void releaseConstant(void* constant) override;
+
+  void assignPrepared(Wire<Wire_T>* element, void const* value) override;
+
+  void addcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
+  void mulcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
   void publicIn(Wire<Wire_T>* element, Number_T&& value) override;
 
   void privateIn(Wire<Wire_T>* element, Number_T&& value) override;
@@ -79,6 +185,20 @@ public:
 
   wire_idx getExtendedWitnessIdx(Wire<Wire_T> const* wire) override;
 
+  // Wires are plaintext, so calls may be memoized by their values. Only
+  // the TypeCounter is affected by a call.
+  bool supportsMemoization() override { return true; }
+
+  void memoKey(Wire<Wire_T> const* wire, std::string* key) override;
+
+  void memoAssign(Wire<Wire_T>* wire, Number_T const& value) override;
+
+  std::unique_ptr<wtk::MemoRecord> beginMemo() override;
+
+  void endMemo(wtk::MemoRecord* record) override;
+
+  void replayMemo(wtk::MemoRecord const* record) override;
+
   // starts as false (no failure) and may be set to indicate a failure at end
   bool fail = false;
 };
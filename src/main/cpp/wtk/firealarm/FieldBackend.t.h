@@ -16,10 +16,30 @@ void FieldBackend<Number_T, Wire_T>::enableTrace(
 template<typename Number_T, typename Wire_T>
 void FieldBackend<Number_T, Wire_T>::assign(
     Wire<Wire_T>* const element, Number_T&& value)
+{
+  Wire_T const prepared = static_cast<Wire_T>(value);
+  this->assignPrepared(element, &prepared);
+}
+
+template<typename Number_T, typename Wire_T>
+void* FieldBackend<Number_T, Wire_T>::prepareConstant(Number_T const& value)
+{
+  return new Wire_T(static_cast<Wire_T>(value));
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::releaseConstant(void* constant)
+{
+  delete (Wire_T*) constant;
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::assignPrepared(
+    Wire<Wire_T>* const element, void const* value)
 {
   this->counter->assign++;
   this->counter->increment();
-  element->value = static_cast<Wire_T>(value);
+  element->value = *(Wire_T const*) value;
   element->counter = this->counter;
 
   if(this->trace)
@@ -35,13 +55,15 @@ void FieldBackend<Number_T, Wire_T>::copy(
 {
   this->counter->copy++;
   this->counter->increment();
+  uint8_t const excess = value->counter.excess();
   element->value = value->value;
   element->counter = this->counter;
+  element->counter.setExcess(excess);
 
   if(this->trace)
   {
     log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(element->value).c_str());
+        this->indent->get(), wtk::utils::dec(this->canonical(element)).c_str());
   }
 }
 
@@ -51,14 +73,32 @@ void FieldBackend<Number_T, Wire_T>::addGate(Wire<Wire_T>* const out,
 {
   this->counter->add++;
   this->counter->increment();
-  out->value =
-    static_cast<Wire_T>((left->value + right->value) % this->primeWire);
-  out->counter = this->counter;
+
+  // The sum is left unreduced, unless its excess would exceed the bound.
+  size_t const excess =
+    (size_t) left->counter.excess() + right->counter.excess() + 1;
+  if(excess <= this->modulus.maxExcess)
+  {
+    out->value = this->modulus.sum(left->value, right->value);
+    out->counter = this->counter;
+    out->counter.setExcess(static_cast<uint8_t>(excess));
+  }
+  else if(excess == 1)
+  {
+    out->value = this->modulus.add(left->value, right->value);
+    out->counter = this->counter;
+  }
+  else
+  {
+    out->value =
+      this->modulus.add(this->canonical(left), this->canonical(right));
+    out->counter = this->counter;
+  }
 
   if(this->trace)
   {
     log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
+        this->indent->get(), wtk::utils::dec(this->canonical(out)).c_str());
   }
 }
 
@@ -68,48 +108,95 @@ void FieldBackend<Number_T, Wire_T>::mulGate(Wire<Wire_T>* const out,
 {
   this->counter->mul++;
   this->counter->increment();
-  out->value =
-    static_cast<Wire_T>((left->value * right->value) % this->primeWire);
+  if(left->counter.excess() == 0 && right->counter.excess() == 0)
+  {
+    out->value = this->modulus.mul(left->value, right->value);
+  }
+  else
+  {
+    out->value =
+      this->modulus.mul(this->canonical(left), this->canonical(right));
+  }
   out->counter = this->counter;
 
   if(this->trace)
   {
     log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
+        this->indent->get(), wtk::utils::dec(this->canonical(out)).c_str());
   }
 }
 
 template<typename Number_T, typename Wire_T>
 void FieldBackend<Number_T, Wire_T>::addcGate(
     Wire<Wire_T>* const out, Wire<Wire_T> const* left, Number_T&& right)
+{
+  Wire_T const prepared = static_cast<Wire_T>(right);
+  this->addcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::addcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
 {
   this->counter->mul++;
   this->counter->increment();
-  out->value = static_cast<Wire_T>(
-      (left->value + static_cast<Wire_T>(right)) % this->primeWire);
-  out->counter = this->counter;
+
+  // Constants are reduced, so the sum's excess is one more than left's.
+  size_t const excess = (size_t) left->counter.excess() + 1;
+  if(excess <= this->modulus.maxExcess)
+  {
+    out->value = this->modulus.sum(left->value, *(Wire_T const*) right);
+    out->counter = this->counter;
+    out->counter.setExcess(static_cast<uint8_t>(excess));
+  }
+  else if(excess == 1)
+  {
+    out->value = this->modulus.add(left->value, *(Wire_T const*) right);
+    out->counter = this->counter;
+  }
+  else
+  {
+    out->value =
+      this->modulus.add(this->canonical(left), *(Wire_T const*) right);
+    out->counter = this->counter;
+  }
 
   if(this->trace)
   {
     log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
+        this->indent->get(), wtk::utils::dec(this->canonical(out)).c_str());
   }
 }
 
 template<typename Number_T, typename Wire_T>
 void FieldBackend<Number_T, Wire_T>::mulcGate(
     Wire<Wire_T>* const out, Wire<Wire_T> const* left, Number_T&& right)
+{
+  Wire_T const prepared = static_cast<Wire_T>(right);
+  this->mulcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::mulcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
 {
   this->counter->mul++;
   this->counter->increment();
-  out->value = static_cast<Wire_T>(
-      (left->value * static_cast<Wire_T>(right)) % this->primeWire);
+  if(left->counter.excess() == 0)
+  {
+    out->value = this->modulus.mul(left->value, *(Wire_T const*) right);
+  }
+  else
+  {
+    out->value =
+      this->modulus.mul(this->canonical(left), *(Wire_T const*) right);
+  }
   out->counter = this->counter;
 
   if(this->trace)
   {
     log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
+        this->indent->get(), wtk::utils::dec(this->canonical(out)).c_str());
   }
 }
 
@@ -119,14 +206,16 @@ void FieldBackend<Number_T, Wire_T>::assertZero(Wire<Wire_T> const* left)
   if(this->trace)
   {
     log_info("%s:%zu: %s<- %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(left->value).c_str());
+        this->indent->get(), wtk::utils::dec(this->canonical(left)).c_str());
   }
 
+  // Zero may be unreduced, as a multiple of the prime.
   this->counter->assertZero += 1;
-  if(!this->suppressAsserts && left->value != 0)
+  if(!this->suppressAsserts && (left->counter.excess() == 0
+        ? left->value != 0 : this->canonical(left) != 0))
   {
-    log_error("%s:%zu: Assert zero failed at value %s",
-        this->fileName, this->lineNum, wtk::utils::dec(left->value).c_str());
+    log_error("%s:%zu: Assert zero failed at value %s", this->fileName,
+        this->lineNum, wtk::utils::dec(this->canonical(left)).c_str());
     this->fail = true;
   }
 }
@@ -173,14 +262,67 @@ template<typename Number_T, typename Wire_T>
 Number_T FieldBackend<Number_T, Wire_T>::getExtendedWitness(
     Wire<Wire_T> const* wire)
 {
-  return wire->value;
+  return static_cast<Number_T>(this->canonical(wire));
 }
 
 template<typename Number_T, typename Wire_T>
 wire_idx FieldBackend<Number_T, Wire_T>::getExtendedWitnessIdx(
     Wire<Wire_T> const* wire)
 {
-  return static_cast<wire_idx>(wire->value);
+  return static_cast<wire_idx>(this->canonical(wire));
+}
+
+// Fixed-width values are encoded by their bytes, and others in decimal.
+template<typename Wire_T>
+typename std::enable_if<std::is_trivially_copyable<Wire_T>::value>::type
+memoEncode(Wire_T const& value, std::string* const key)
+{
+  key->append((char const*) &value, sizeof(Wire_T));
+}
+
+template<typename Wire_T>
+typename std::enable_if<!std::is_trivially_copyable<Wire_T>::value>::type
+memoEncode(Wire_T const& value, std::string* const key)
+{
+  key->append(wtk::utils::dec(value));
+  key->push_back(',');
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::memoKey(
+    Wire<Wire_T> const* wire, std::string* key)
+{
+  memoEncode(this->canonical(wire), key);
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::memoAssign(
+    Wire<Wire_T>* wire, Number_T const& value)
+{
+  this->counter->increment();
+  wire->value = static_cast<Wire_T>(value);
+  wire->counter = this->counter;
+}
+
+template<typename Number_T, typename Wire_T>
+std::unique_ptr<wtk::MemoRecord> FieldBackend<Number_T, Wire_T>::beginMemo()
+{
+  std::unique_ptr<CounterMemoRecord> record(new CounterMemoRecord());
+  record->begin(this->counter);
+  return std::unique_ptr<wtk::MemoRecord>(std::move(record));
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::endMemo(wtk::MemoRecord* record)
+{
+  static_cast<CounterMemoRecord*>(record)->end(this->counter);
+}
+
+template<typename Number_T, typename Wire_T>
+void FieldBackend<Number_T, Wire_T>::replayMemo(
+    wtk::MemoRecord const* record)
+{
+  static_cast<CounterMemoRecord const*>(record)->replay(this->counter);
 }
 
 } } // namespace wtk::firealarm
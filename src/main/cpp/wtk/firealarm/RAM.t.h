@@ -36,6 +36,11 @@ void RAMInitOperation<Number_T, Wire_T>::init(wire_idx const size,
 {
   RAMBackend<Number_T, Wire_T>* const ram =
     static_cast<RAMBackend<Number_T, Wire_T>*>(this->backend);
+  FieldBackend<Number_T, Wire_T>* const backend =
+    static_cast<FieldBackend<Number_T, Wire_T>*>(ram->wireBackend);
+
+  // Buffers hold reduced values, which are read back with no excess.
+  Wire_T const value = backend->canonical(fill);
 
   buffer->length = static_cast<size_t>(size);
   buffer->buffer = (Wire_T*) malloc(buffer->length * sizeof(Wire_T));
@@ -45,7 +50,7 @@ void RAMInitOperation<Number_T, Wire_T>::init(wire_idx const size,
 
   for(size_t i = 0; i < buffer->length; i++)
   {
-    new(buffer->buffer + i) Wire_T(fill->value);
+    new(buffer->buffer + i) Wire_T(value);
   }
 }
 
@@ -58,7 +63,7 @@ void RAMReadOperation<Number_T, Wire_T>::read(Wire<Wire_T>* const out,
   FieldBackend<Number_T, Wire_T>* const backend =
     static_cast<FieldBackend<Number_T, Wire_T>*>(ram->wireBackend);
 
-  size_t idx_sz = static_cast<size_t>(idx->value);
+  size_t idx_sz = static_cast<size_t>(backend->canonical(idx));
   if(idx_sz >= buffer->length)
   {
     log_error("Index %zu exceeds RAM buffer size %zu", idx_sz, buffer->length);
@@ -82,8 +87,10 @@ void RAMWriteOperation<Number_T, Wire_T>::write(RAMBuffer<Wire_T>* const buffer,
 {
   RAMBackend<Number_T, Wire_T>* const ram =
     static_cast<RAMBackend<Number_T, Wire_T>*>(this->backend);
+  FieldBackend<Number_T, Wire_T>* const backend =
+    static_cast<FieldBackend<Number_T, Wire_T>*>(ram->wireBackend);
 
-  size_t idx_sz = static_cast<size_t>(idx->value);
+  size_t idx_sz = static_cast<size_t>(backend->canonical(idx));
   if(idx_sz >= buffer->length)
   {
     log_error("Index %zu exceeds RAM buffer size %zu", idx_sz, buffer->length);
@@ -91,7 +98,7 @@ void RAMWriteOperation<Number_T, Wire_T>::write(RAMBuffer<Wire_T>* const buffer,
   }
   else
   {
-    buffer->buffer[idx_sz] = in->value;
+    buffer->buffer[idx_sz] = backend->canonical(in);
   }
 
   ram->counter->write++;
@@ -136,6 +143,8 @@ void BoolRAMInitOperation<Number_T, Wire_T>::init(wire_idx const size,
 {
   BoolRAMBackend<Number_T, Wire_T>* const ram =
     static_cast<BoolRAMBackend<Number_T, Wire_T>*>(this->backend);
+  FieldBackend<Number_T, Wire_T>* const backend =
+    static_cast<FieldBackend<Number_T, Wire_T>*>(ram->wireBackend);
 
   buffer->length = static_cast<size_t>(size) * ram->elementBits;
   buffer->buffer = (Wire_T*) malloc(buffer->length * sizeof(Wire_T));
@@ -147,7 +156,8 @@ void BoolRAMInitOperation<Number_T, Wire_T>::init(wire_idx const size,
   {
     for(size_t j = 0; j < (size_t) ram->elementBits; j++)
     {
-      new(buffer->buffer + i * ram->elementBits + j) Wire_T((fill + j)->value);
+      new(buffer->buffer + i * ram->elementBits + j)
+        Wire_T(backend->canonical(fill + j));
     }
   }
 }
@@ -164,7 +174,8 @@ void BoolRAMReadOperation<Number_T, Wire_T>::read(Wire<Wire_T>* const out,
   size_t idx_sz = 0;
   for(size_t i = 0; i < (size_t) ram->indexBits; i++)
   {
-    idx_sz = idx_sz << 1 | (static_cast<size_t>((idx + i)->value) & 1);
+    idx_sz = idx_sz << 1
+      | (static_cast<size_t>(backend->canonical(idx + i)) & 1);
   }
 
   if(idx_sz * ram->elementBits >= buffer->length)
@@ -201,11 +212,14 @@ void BoolRAMWriteOperation<Number_T, Wire_T>::write(
 {
   BoolRAMBackend<Number_T, Wire_T>* const ram =
     static_cast<BoolRAMBackend<Number_T, Wire_T>*>(this->backend);
+  FieldBackend<Number_T, Wire_T>* const backend =
+    static_cast<FieldBackend<Number_T, Wire_T>*>(ram->wireBackend);
 
   size_t idx_sz = 0;
   for(size_t i = 0; i < (size_t) ram->indexBits; i++)
   {
-    idx_sz = idx_sz << 1 | (static_cast<size_t>((idx + i)->value) & 1);
+    idx_sz = idx_sz << 1
+      | (static_cast<size_t>(backend->canonical(idx + i)) & 1);
   }
 
   if(idx_sz * ram->elementBits >= buffer->length)
@@ -218,7 +232,8 @@ void BoolRAMWriteOperation<Number_T, Wire_T>::write(
   {
     for(size_t i = 0; i < (size_t) ram->elementBits; i++)
     {
-      buffer->buffer[idx_sz * ram->elementBits + i] = in[i].value;
+      buffer->buffer[idx_sz * ram->elementBits + i] =
+        backend->canonical(in + i);
     }
   }
 
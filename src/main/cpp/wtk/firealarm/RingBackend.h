@@ -2,18 +2,22 @@
  * Copyright (C) 2022, Stealth Software Technologies, Inc.
  */
 
-#ifndef WTK_FIREALARM_FIELD_BACKEND_H_
-#define WTK_FIREALARM_FIELD_BACKEND_H_
+#ifndef WTK_FIREALARM_RING_BACKEND_H_
+#define WTK_FIREALARM_RING_BACKEND_H_
 
 #include <cstddef>
+#include <memory>
+#include <string>
 
 #include <wtk/indexes.h>
 #include <wtk/TypeBackend.h>
 #include <wtk/circuit/Data.h>
 #include <wtk/utils/NumUtils.h>
+#include <wtk/utils/Wraparound.h>
 
 #include <wtk/firealarm/Wire.h>
 #include <wtk/firealarm/Counters.h>
+#include <wtk/firealarm/FieldBackend.h>
 
 #include <wtk/utils/Indent.h>
 
@@ -23,13 +27,19 @@
 namespace wtk {
 namespace firealarm {
 
+/**
+ * A backend for rings of integers modulo 2^bitWidth. Sums and products wrap
+ * around in Wire_T, which must have at least bitWidth bits, and are masked
+ * to bitWidth (see wtk::utils::Wraparound).
+ */
 template<typename Number_T, typename Wire_T>
-class FieldBackend : public wtk::TypeBackend<Number_T, Wire<Wire_T>>
+class RingBackend : public wtk::TypeBackend<Number_T, Wire<Wire_T>>
 {
 public:
   char const* const fileName;
 
-  Wire_T const primeWire;
+  // Arithmetic modulo 2^bitWidth.
+  wtk::utils::Wraparound<Wire_T> const ring;
 
   TypeCounter* const counter;
 
@@ -37,14 +47,14 @@ public:
   bool trace = false;
   wtk::utils::Indent const* indent = nullptr;
 
-  FieldBackend(
+  RingBackend(
       char const* const fn, wtk::circuit::TypeSpec<Number_T> const* const t,
       TypeCounter* const c, bool sa)
-    : wtk::TypeBackend<Number_T, Wire<Wire_T>>(t),
-    fileName(fn), primeWire(static_cast<Wire_T>(t->prime)), counter(c),
-    suppressAsserts(sa)
+    : wtk::TypeBackend<Number_T, Wire<Wire_T>>(t), fileName(fn),
+    ring(static_cast<Wire_T>(Number_T(t->maxValue() - Number_T(1)))),
+    counter(c), suppressAsserts(sa)
   {
-    log_assert(t->variety == wtk::circuit::TypeSpec<Number_T>::field);
+    log_assert(t->variety == wtk::circuit::TypeSpec<Number_T>::ring);
   }
 
   void enableTrace(wtk::utils::Indent const* const idt);
@@ -67,6 +77,19 @@ public:
 
   void assertZero(Wire<Wire_T> const* left) override;
 
+  // Constants are prepared by conversion to Wire_T.
+  void* prepareConstant(Number_T const& value) override;
+
+  void releaseConstant(void* constant) override;
+
+  void assignPrepared(Wire<Wire_T>* element, void const* value) override;
+
+  void addcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
+  void mulcPrepared(Wire<Wire_T>* out,
+      Wire<Wire_T> const* left, void const* right) override;
+
   void publicIn(Wire<Wire_T>* element, Number_T&& value) override;
 
   void privateIn(Wire<Wire_T>* element, Number_T&& value) override;
@@ -79,15 +102,31 @@ public:
 
   wire_idx getExtendedWitnessIdx(Wire<Wire_T> const* wire) override;
 
+  // Memoized as by the FieldBackend.
+  bool supportsMemoization() override { return true; }
+
+  void memoKey(Wire<Wire_T> const* wire, std::string* key) override;
+
+  void memoAssign(Wire<Wire_T>* wire, Number_T const& value) override;
+
+  std::unique_ptr<wtk::MemoRecord> beginMemo() override;
+
+  void endMemo(wtk::MemoRecord* record) override;
+
+  void replayMemo(wtk::MemoRecord const* record) override;
+
   // starts as false (no failure) and may be set to indicate a failure at end
   bool fail = false;
+
+private:
+  void traceOut(Wire<Wire_T> const* out);
 };
 
 } } // namespace wtk::firealarm
 
-#include <wtk/firealarm/FieldBackend.t.h>
+#include <wtk/firealarm/RingBackend.t.h>
 
 #define LOG_UNINCLUDE
 #include <stealth_logging.h>
 
-#endif//WTK_FIREALARM_FIELD_BACKEND_H_
+#endif//WTK_FIREALARM_RING_BACKEND_H_
@@ -6,7 +6,7 @@ namespace wtk {
 namespace firealarm {
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::enableTrace(
+void RingBackend<Number_T, Wire_T>::enableTrace(
     wtk::utils::Indent const* const idt)
 {
   this->trace = true;
@@ -14,107 +14,119 @@ void FieldBackend<Number_T, Wire_T>::enableTrace(
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::assign(
-    Wire<Wire_T>* const element, Number_T&& value)
+void RingBackend<Number_T, Wire_T>::traceOut(Wire<Wire_T> const* out)
 {
-  this->counter->assign++;
-  this->counter->increment();
-  element->value = static_cast<Wire_T>(value);
-  element->counter = this->counter;
-
   if(this->trace)
   {
     log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(element->value).c_str());
+        this->indent->get(), wtk::utils::dec(out->value).c_str());
   }
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::copy(
+void RingBackend<Number_T, Wire_T>::assign(
+    Wire<Wire_T>* const element, Number_T&& value)
+{
+  Wire_T const prepared = static_cast<Wire_T>(value);
+  this->assignPrepared(element, &prepared);
+}
+
+template<typename Number_T, typename Wire_T>
+void* RingBackend<Number_T, Wire_T>::prepareConstant(Number_T const& value)
+{
+  return new Wire_T(static_cast<Wire_T>(value));
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::releaseConstant(void* constant)
+{
+  delete (Wire_T*) constant;
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::assignPrepared(
+    Wire<Wire_T>* const element, void const* value)
+{
+  this->counter->assign++;
+  this->counter->increment();
+  element->value = *(Wire_T const*) value;
+  element->counter = this->counter;
+  this->traceOut(element);
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::copy(
     Wire<Wire_T>* const element, Wire<Wire_T> const* value)
 {
   this->counter->copy++;
   this->counter->increment();
   element->value = value->value;
   element->counter = this->counter;
-
-  if(this->trace)
-  {
-    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(element->value).c_str());
-  }
+  this->traceOut(element);
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::addGate(Wire<Wire_T>* const out,
+void RingBackend<Number_T, Wire_T>::addGate(Wire<Wire_T>* const out,
     Wire<Wire_T> const* left, Wire<Wire_T> const* right)
 {
   this->counter->add++;
   this->counter->increment();
-  out->value =
-    static_cast<Wire_T>((left->value + right->value) % this->primeWire);
+  out->value = this->ring.add(left->value, right->value);
   out->counter = this->counter;
-
-  if(this->trace)
-  {
-    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
-  }
+  this->traceOut(out);
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::mulGate(Wire<Wire_T>* const out,
+void RingBackend<Number_T, Wire_T>::mulGate(Wire<Wire_T>* const out,
     Wire<Wire_T> const* left, Wire<Wire_T> const* right)
 {
   this->counter->mul++;
   this->counter->increment();
-  out->value =
-    static_cast<Wire_T>((left->value * right->value) % this->primeWire);
+  out->value = this->ring.mul(left->value, right->value);
   out->counter = this->counter;
-
-  if(this->trace)
-  {
-    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
-  }
+  this->traceOut(out);
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::addcGate(
+void RingBackend<Number_T, Wire_T>::addcGate(
     Wire<Wire_T>* const out, Wire<Wire_T> const* left, Number_T&& right)
 {
-  this->counter->mul++;
+  Wire_T const prepared = static_cast<Wire_T>(right);
+  this->addcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::addcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
+{
+  this->counter->addc++;
   this->counter->increment();
-  out->value = static_cast<Wire_T>(
-      (left->value + static_cast<Wire_T>(right)) % this->primeWire);
+  out->value = this->ring.add(left->value, *(Wire_T const*) right);
   out->counter = this->counter;
-
-  if(this->trace)
-  {
-    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
-  }
+  this->traceOut(out);
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::mulcGate(
+void RingBackend<Number_T, Wire_T>::mulcGate(
     Wire<Wire_T>* const out, Wire<Wire_T> const* left, Number_T&& right)
 {
-  this->counter->mul++;
+  Wire_T const prepared = static_cast<Wire_T>(right);
+  this->mulcPrepared(out, left, &prepared);
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::mulcPrepared(
+    Wire<Wire_T>* const out, Wire<Wire_T> const* left, void const* right)
+{
+  this->counter->mulc++;
   this->counter->increment();
-  out->value = static_cast<Wire_T>(
-      (left->value * static_cast<Wire_T>(right)) % this->primeWire);
+  out->value = this->ring.mul(left->value, *(Wire_T const*) right);
   out->counter = this->counter;
-
-  if(this->trace)
-  {
-    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(out->value).c_str());
-  }
+  this->traceOut(out);
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::assertZero(Wire<Wire_T> const* left)
+void RingBackend<Number_T, Wire_T>::assertZero(Wire<Wire_T> const* left)
 {
   if(this->trace)
   {
@@ -123,7 +135,7 @@ void FieldBackend<Number_T, Wire_T>::assertZero(Wire<Wire_T> const* left)
   }
 
   this->counter->assertZero += 1;
-  if(!this->suppressAsserts && left->value != 0)
+  if(!this->suppressAsserts && left->value != Wire_T(0))
   {
     log_error("%s:%zu: Assert zero failed at value %s",
         this->fileName, this->lineNum, wtk::utils::dec(left->value).c_str());
@@ -132,55 +144,82 @@ void FieldBackend<Number_T, Wire_T>::assertZero(Wire<Wire_T> const* left)
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::publicIn(
+void RingBackend<Number_T, Wire_T>::publicIn(
     Wire<Wire_T>* const element, Number_T&& value)
 {
-  this->counter->privateIn++;
+  this->counter->publicIn++;
   this->counter->increment();
   element->value = static_cast<Wire_T>(value);
   element->counter = this->counter;
-
-  if(this->trace)
-  {
-    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(element->value).c_str());
-  }
+  this->traceOut(element);
 }
 
 template<typename Number_T, typename Wire_T>
-void FieldBackend<Number_T, Wire_T>::privateIn(
+void RingBackend<Number_T, Wire_T>::privateIn(
     Wire<Wire_T>* const element, Number_T&& value)
 {
   this->counter->privateIn++;
   this->counter->increment();
   element->value = static_cast<Wire_T>(value);
   element->counter = this->counter;
-
-  if(this->trace)
-  {
-    log_info("%s:%zu: %s-> %s", this->fileName, this->lineNum,
-        this->indent->get(), wtk::utils::dec(element->value).c_str());
-  }
+  this->traceOut(element);
 }
 
 template<typename Number_T, typename Wire_T>
-bool FieldBackend<Number_T, Wire_T>::check()
+bool RingBackend<Number_T, Wire_T>::check()
 {
   return !this->fail;
 }
 
 template<typename Number_T, typename Wire_T>
-Number_T FieldBackend<Number_T, Wire_T>::getExtendedWitness(
+Number_T RingBackend<Number_T, Wire_T>::getExtendedWitness(
     Wire<Wire_T> const* wire)
 {
-  return wire->value;
+  return static_cast<Number_T>(wire->value);
 }
 
 template<typename Number_T, typename Wire_T>
-wire_idx FieldBackend<Number_T, Wire_T>::getExtendedWitnessIdx(
+wire_idx RingBackend<Number_T, Wire_T>::getExtendedWitnessIdx(
     Wire<Wire_T> const* wire)
 {
   return static_cast<wire_idx>(wire->value);
 }
 
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::memoKey(
+    Wire<Wire_T> const* wire, std::string* key)
+{
+  memoEncode(wire->value, key);
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::memoAssign(
+    Wire<Wire_T>* wire, Number_T const& value)
+{
+  this->counter->increment();
+  wire->value = static_cast<Wire_T>(value);
+  wire->counter = this->counter;
+}
+
+template<typename Number_T, typename Wire_T>
+std::unique_ptr<wtk::MemoRecord> RingBackend<Number_T, Wire_T>::beginMemo()
+{
+  std::unique_ptr<CounterMemoRecord> record(new CounterMemoRecord());
+  record->begin(this->counter);
+  return std::unique_ptr<wtk::MemoRecord>(std::move(record));
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::endMemo(wtk::MemoRecord* record)
+{
+  static_cast<CounterMemoRecord*>(record)->end(this->counter);
+}
+
+template<typename Number_T, typename Wire_T>
+void RingBackend<Number_T, Wire_T>::replayMemo(
+    wtk::MemoRecord const* record)
+{
+  static_cast<CounterMemoRecord const*>(record)->replay(this->counter);
+}
+
 } } // namespace wtk::firealarm
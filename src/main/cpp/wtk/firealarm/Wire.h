@@ -12,14 +12,14 @@
 namespace wtk {
 namespace firealarm {
 
-// A wrapper for a value and a counter. At destruction, counters must
-// be updated
+// A wrapper for a value and a (compact) counter reference. At destruction,
+// counters must be updated
 template<typename Element_T>
 struct Wire
 {
   Element_T value = Element_T(0);
 
-  TypeCounter* counter = nullptr;
+  CounterRef counter = nullptr;
 
   Wire() = default;
   
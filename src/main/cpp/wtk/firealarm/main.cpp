@@ -3,10 +3,18 @@
  */
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstdio>
 #include <cstring>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <vector>
+#include <memory>
+#include <algorithm>
 
 #define WTK_NAILS_ENABLE_TRACES
 
@@ -18,27 +26,51 @@
 #include <wtk/Parser.h>
 #include <wtk/circuit/Parser.h>
 #include <wtk/circuit/Data.h>
+#include <wtk/circuit/Recorder.h>
 #include <wtk/utils/NumUtils.h>
+#include <wtk/utils/Certificate.h>
 #include <wtk/utils/ParserOrganizer.h>
 #include <wtk/utils/Pool.h>
+#include <wtk/utils/MemStats.h>
+#include <wtk/utils/FixedUint.h>
+#include <wtk/utils/Modulus.h>
+#include <wtk/utils/Extension.h>
 
 #include <wtk/irregular/Parser.h>
 #include <wtk/flatbuffer/Parser.h>
 #include <wtk/firealarm/FieldBackend.h>
+#include <wtk/firealarm/BitslicedBackend.h>
+#include <wtk/firealarm/BooleanBackend.h>
+#include <wtk/firealarm/RingBackend.h>
+#include <wtk/firealarm/ExtFieldBackend.h>
 #include <wtk/firealarm/Converter.h>
 #include <wtk/firealarm/Wire.h>
 #include <wtk/firealarm/Counters.h>
 #include <wtk/firealarm/RAM.h>
 
+#include <wtk/nails/CompiledFunction.h>
 #include <wtk/nails/Handler.h>
 #include <wtk/nails/Interpreter.h>
 #include <wtk/nails/IterPlugin.h>
+#include <wtk/nails/Profiler.h>
+#include <wtk/nails/Memoizer.h>
 
 #include <wtk/plugins/Plugin.h>
 #include <wtk/plugins/Vectors.h>
 #include <wtk/plugins/Multiplexer.h>
 #include <wtk/plugins/ExtendedArithmetic.h>
 
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+// Multi-limb wires, for primes too large for uint64_t.
+typedef wtk::utils::FixedUint<2> fixed128_t;
+typedef wtk::utils::FixedUint<4> fixed256_t;
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
+// Extension field wires, by the maximum degree.
+typedef wtk::utils::ExtElement<2> ext2_t;
+typedef wtk::utils::ExtElement<4> ext4_t;
+typedef wtk::utils::ExtElement<8> ext8_t;
+
 #define LOG_IDENTIFIER "wtk-firealarm"
 #include <stealth_logging.h>
 
@@ -80,6 +112,36 @@ void print_help()
   printf("  -d        Include details when reporting on gate counts.\n");
   printf("  --fallback-ram\n"
          "            Use the fallback RAM plugin (default: firealarm RAM)\n");
+  printf("  --compiled\n"
+         "            Compile functions to pre-resolved frames for replay.\n");
+  printf("  --parallel\n"
+         "            Evaluate each type on its own thread (ignored with "
+      "traces).\n");
+  printf("  --profile <file>\n"
+         "            Profile function calls, printing a table and writing "
+      "folded stacks\n            (for flamegraph tools) to the file.\n");
+  printf("  --memoize <MiB>\n"
+         "            Reuse the results of repeated calls to pure functions, "
+      "caching up to\n            the given size.\n");
+  printf("  --bitslice\n"
+         "            Evaluate up to 64 sets of GF(2) public and private "
+      "inputs at once,\n            reporting on each set (given in the "
+      "order of their streams).\n");
+  printf("  --batch <list>\n"
+         "            Parse the relation once, then evaluate it for each line "
+      "of the list,\n            which names the input streams of one "
+      "instance/witness pair.\n            The relation is checked with "
+      "the first pair, and not\n            rechecked if that pair "
+      "succeeds.\n");
+  printf("  --jobs <n>\n"
+         "            Number of threads for --batch (default: one per "
+      "core).\n");
+  printf("  --certify <certificate>\n"
+         "            Write a validation certificate for the relation if it "
+      "is valid.\n");
+  printf("  --trusted <certificate>\n"
+         "            Skip wire validity checks for a relation which was "
+      "previously\n            validated with --certify.\n");
   printf("  --help\n");
   printf("  -h        Print this help text.\n");
   printf("  --version\n");
@@ -122,6 +184,29 @@ bool fallback_ram_flag = false;
 // flag to use the flatbuffer parser instead of irregular
 bool flatbuffer_flag = false;
 
+// flag to use compiled functions instead of gates functions
+bool compiled_flag = false;
+
+// flag to evaluate each type on its own thread
+bool parallel_flag = false;
+
+// file for folded stacks of the function profile
+char const* profile_name = nullptr;
+
+// size of the memo cache for pure function calls (0 to disable)
+size_t memoize_bytes = 0;
+
+// flag to evaluate multiple GF(2) input sets at once
+bool bitslice_flag = false;
+
+// list of input stream sets to evaluate in batch, and threads to do so
+char const* batch_name = nullptr;
+size_t batch_jobs = 0;
+
+// validation certificates to write (--certify) or to check (--trusted)
+char const* certify_name = nullptr;
+char const* trusted_name = nullptr;
+
 // Function to read the arguments
 void read_arguments(int argc, char const* argv[])
 {
@@ -156,6 +241,66 @@ void read_arguments(int argc, char const* argv[])
     {
       flatbuffer_flag = true;
     }
+    else if(0 == strcmp(argv[i], "--compiled"))
+    {
+      compiled_flag = true;
+    }
+    else if(0 == strcmp(argv[i], "--parallel"))
+    {
+      parallel_flag = true;
+    }
+    else if(0 == strcmp(argv[i], "--profile") && i + 1 < (size_t) argc)
+    {
+      i++;
+      profile_name = argv[i];
+    }
+    else if(0 == strcmp(argv[i], "--memoize") && i + 1 < (size_t) argc)
+    {
+      i++;
+      char* end = nullptr;
+      unsigned long long const mib = strtoull(argv[i], &end, 10);
+      if(end == argv[i] || *end != '\0' || mib == 0 || mib > (SIZE_MAX >> 20))
+      {
+        print_help_flag = true;
+      }
+      else
+      {
+        memoize_bytes = ((size_t) mib) << 20;
+      }
+    }
+    else if(0 == strcmp(argv[i], "--bitslice"))
+    {
+      bitslice_flag = true;
+    }
+    else if(0 == strcmp(argv[i], "--batch") && i + 1 < (size_t) argc)
+    {
+      i++;
+      batch_name = argv[i];
+    }
+    else if(0 == strcmp(argv[i], "--jobs") && i + 1 < (size_t) argc)
+    {
+      i++;
+      char* end = nullptr;
+      unsigned long long const jobs = strtoull(argv[i], &end, 10);
+      if(end == argv[i] || *end != '\0' || jobs == 0 || jobs > 4096)
+      {
+        print_help_flag = true;
+      }
+      else
+      {
+        batch_jobs = (size_t) jobs;
+      }
+    }
+    else if(0 == strcmp(argv[i], "--certify") && i + 1 < (size_t) argc)
+    {
+      i++;
+      certify_name = argv[i];
+    }
+    else if(0 == strcmp(argv[i], "--trusted") && i + 1 < (size_t) argc)
+    {
+      i++;
+      trusted_name = argv[i];
+    }
     else
     {
       resource_names.emplace_back(argv[i]);
@@ -168,24 +313,171 @@ void read_arguments(int argc, char const* argv[])
 // (most ZK backends probably don't need as much flexibility and could
 // have simpler setup)
 
-// Enumeration of bit-width/precision for Wire_T arguments.
+// Enumeration of bit-width/precision for Wire_T arguments. RAM types are
+// not distinguished by Wire_T, as that of their index type is consulted.
 enum class Precision
 {
   unlimited,
+  uint256,
+  uint128,
   uint64,
+  uint32,
+  uint16,
   uint8,
-  ram_unlimited,
-  ram_uint64,
-  ram_uint8,
+  ram,
   bool_ram,
-  fallback_ram_unlimited,
-  fallback_ram_uint64,
-  fallback_ram_uint8,
-  fallback_bool_ram_uint8
+  fallback_ram,
+  fallback_bool_ram,
+  bitsliced,
+  ext2,
+  ext4,
+  ext8
+};
+
+// The precision of each Wire_T.
+template<typename Wire_T>
+struct PrecisionOf;
+
+template<>
+struct PrecisionOf<sst::bignum>
+  : std::integral_constant<Precision, Precision::unlimited> { };
+
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+template<>
+struct PrecisionOf<fixed256_t>
+  : std::integral_constant<Precision, Precision::uint256> { };
+
+template<>
+struct PrecisionOf<fixed128_t>
+  : std::integral_constant<Precision, Precision::uint128> { };
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
+template<>
+struct PrecisionOf<uint64_t>
+  : std::integral_constant<Precision, Precision::uint64> { };
+
+template<>
+struct PrecisionOf<uint32_t>
+  : std::integral_constant<Precision, Precision::uint32> { };
+
+template<>
+struct PrecisionOf<uint16_t>
+  : std::integral_constant<Precision, Precision::uint16> { };
+
+template<>
+struct PrecisionOf<uint8_t>
+  : std::integral_constant<Precision, Precision::uint8> { };
+
+// A list of Wire_Ts, from which pools and dispatch are generated.
+template<typename... Wire_Ts>
+struct WireList { };
+
+// Wire_Ts of each field and ring precision.
+typedef WireList<sst::bignum,
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+        fixed256_t, fixed128_t,
+#endif//WTK_UTILS_MODULUS_WIDE_64
+        uint64_t, uint32_t, uint16_t, uint8_t> Wires;
+
+// The narrowest precision for a prime field.
+Precision fieldPrecision(sst::bignum const& prime)
+{
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+  if(prime >> 256 != 0) { return Precision::unlimited; }
+  else if(prime >> 128 != 0) { return Precision::uint256; }
+  else if(prime > UINT64_MAX) { return Precision::uint128; }
+  else if(prime > UINT32_MAX) { return Precision::uint64; }
+#else
+  if(prime > UINT32_MAX) { return Precision::unlimited; }
+#endif//WTK_UTILS_MODULUS_WIDE_64
+  else if(prime > UINT16_MAX) { return Precision::uint32; }
+  else if(prime > UINT8_MAX) { return Precision::uint16; }
+  else { return Precision::uint8; }
+}
+
+// The narrowest precision for a ring of the given bit width.
+Precision ringPrecision(size_t const bit_width)
+{
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+  if(bit_width > 256) { return Precision::unlimited; }
+  else if(bit_width > 128) { return Precision::uint256; }
+  else if(bit_width > 64) { return Precision::uint128; }
+#else
+  if(bit_width > 64) { return Precision::unlimited; }
+#endif//WTK_UTILS_MODULUS_WIDE_64
+  else if(bit_width > 32) { return Precision::uint64; }
+  else if(bit_width > 16) { return Precision::uint32; }
+  else if(bit_width > 8) { return Precision::uint16; }
+  else { return Precision::uint8; }
+}
+
+/**
+ * Calls visitor->visit<Wire_T>() with the Wire_T of the given precision,
+ * or visitor->unsupported() if no Wire_T in the list has that precision.
+ */
+template<typename Visitor_T>
+bool visitPrecision(
+    WireList<>, Precision const precision, Visitor_T* const visitor)
+{
+  (void) precision;
+  return visitor->unsupported();
+}
+
+template<typename Visitor_T, typename Wire_T, typename... Rest_Ts>
+bool visitPrecision(WireList<Wire_T, Rest_Ts...>,
+    Precision const precision, Visitor_T* const visitor)
+{
+  if(precision == PrecisionOf<Wire_T>::value)
+  {
+    return visitor->template visit<Wire_T>();
+  }
+
+  return visitPrecision(WireList<Rest_Ts...>(), precision, visitor);
+}
+
+// A pool of T, found among the TypeManager's bases by T.
+template<typename T>
+struct PoolOf
+{
+  wtk::utils::Pool<T, 1> pool;
 };
 
+// A pool of Backend_T<sst::bignum, Wire_T> for each Wire_T in the list.
+template<template<typename, typename> class Backend_T, typename List_T>
+struct PoolsOf;
+
+template<template<typename, typename> class Backend_T, typename... Wire_Ts>
+struct PoolsOf<Backend_T, WireList<Wire_Ts...>>
+  : PoolOf<Backend_T<sst::bignum, Wire_Ts>>... { };
+
+// The fallback RAM, templated by Wire_T as the FIREALARM RAM is.
+template<typename Number_T, typename Wire_T>
+using FallbackRAMBackend =
+  wtk::plugins::FallbackRAMBackend<Number_T, wtk::firealarm::Wire<Wire_T>>;
+
+// A pool of converters to Out_T from each Wire_T in the list.
+template<typename Out_T, typename List_T>
+struct ConverterPools;
+
+template<typename Out_T, typename... In_Ts>
+struct ConverterPools<Out_T, WireList<In_Ts...>>
+  : PoolOf<wtk::firealarm::Converter<sst::bignum, Out_T, In_Ts>>... { };
+
+// A pool of converters for each pair of Wire_Ts in the list.
+template<typename List_T>
+struct ConverterMatrix;
+
+template<typename... Wire_Ts>
+struct ConverterMatrix<WireList<Wire_Ts...>>
+  : ConverterPools<Wire_Ts, WireList<Wire_Ts...>>... { };
+
 // Memory manager for TypeBackends within FIREALARM
 struct TypeManager
+  : PoolsOf<wtk::firealarm::FieldBackend, Wires>,
+    PoolsOf<wtk::firealarm::RingBackend, Wires>,
+    PoolsOf<wtk::firealarm::RAMBackend, Wires>,
+    PoolsOf<FallbackRAMBackend, Wires>,
+    ConverterMatrix<Wires>
 {
   bool suppressAsserts;
 
@@ -200,25 +492,23 @@ struct TypeManager
     this->indent = idt;
   }
 
-  // pool allocation
-  wtk::utils::Pool<wtk::firealarm::FieldBackend<sst::bignum, sst::bignum>, 1> unlimited;
-  wtk::utils::Pool<wtk::firealarm::FieldBackend<sst::bignum, uint64_t>, 1> uint64;
-  wtk::utils::Pool<wtk::firealarm::FieldBackend<sst::bignum, uint8_t>, 1> uint8;
-  wtk::utils::Pool<wtk::firealarm::RAMBackend<sst::bignum, sst::bignum>, 1> ramUnlimited;
-  wtk::utils::Pool<wtk::firealarm::RAMBackend<sst::bignum, uint64_t>, 1> ramUint64;
-  wtk::utils::Pool<wtk::firealarm::RAMBackend<sst::bignum, uint8_t>, 1> ramUint8;
+  // pool allocation, for those not generated by Wire_T.
+  wtk::utils::Pool<wtk::firealarm::BooleanBackend<sst::bignum>, 1> boolean;
+  wtk::utils::Pool<wtk::firealarm::BitslicedBackend<sst::bignum>, 1> bitsliced;
+  wtk::utils::Pool<wtk::firealarm::ExtFieldBackend<sst::bignum, 2>, 1> ext2;
+  wtk::utils::Pool<wtk::firealarm::ExtFieldBackend<sst::bignum, 4>, 1> ext4;
+  wtk::utils::Pool<wtk::firealarm::ExtFieldBackend<sst::bignum, 8>, 1> ext8;
   wtk::utils::Pool<wtk::firealarm::BoolRAMBackend<sst::bignum, uint8_t>, 1> boolRam;
-
-  // pool allocation for fallback RAM (option)
-  wtk::utils::Pool<wtk::plugins::FallbackRAMBackend<
-    sst::bignum, wtk::firealarm::Wire<sst::bignum>>, 1> fallbackRamUnlimited;
-  wtk::utils::Pool<wtk::plugins::FallbackRAMBackend<
-    sst::bignum, wtk::firealarm::Wire<uint64_t>>, 1> fallbackRamUint64;
-  wtk::utils::Pool<wtk::plugins::FallbackRAMBackend<
-    sst::bignum, wtk::firealarm::Wire<uint8_t>>, 1> fallbackRamUint8;
   wtk::utils::Pool<wtk::plugins::FallbackBoolRAMBackend<
     sst::bignum, wtk::firealarm::Wire<uint8_t>>, 1> fallbackBoolRamUint8;
 
+  // The pool of T.
+  template<typename T>
+  wtk::utils::Pool<T, 1>* pool()
+  {
+    return &static_cast<PoolOf<T>*>(this)->pool;
+  }
+
   // reference to a backend. precision is indicated, but type is erased
   struct TypeRef
   {
@@ -233,15 +523,16 @@ struct TypeManager
   // List of all backends, indexed in order of declaration
   std::vector<TypeRef> typeRefs;
 
-  // make a backend with unlimited precision wire
-  wtk::firealarm::FieldBackend<sst::bignum, sst::bignum>* makeUnlimited(
+  // make a field backend with the given Wire_T
+  template<typename Wire_T>
+  wtk::firealarm::FieldBackend<sst::bignum, Wire_T>* makeField(
       char const* const f_name,
       wtk::circuit::TypeSpec<sst::bignum> const* const type,
       wtk::firealarm::TypeCounter* const ctr)
   {
-    wtk::firealarm::FieldBackend<sst::bignum, sst::bignum>* ret =
-      this->unlimited.allocate(1, f_name, type, ctr, this->suppressAsserts);
-    this->typeRefs.emplace_back(Precision::unlimited, ret);
+    wtk::firealarm::FieldBackend<sst::bignum, Wire_T>* ret =
+      this->allocateField<Wire_T>(f_name, type, ctr);
+    this->typeRefs.emplace_back(PrecisionOf<Wire_T>::value, ret);
 
     if(this->trace)
     {
@@ -251,15 +542,26 @@ struct TypeManager
     return ret;
   }
 
-  // make a backend with 64-bit wire
-  wtk::firealarm::FieldBackend<sst::bignum, uint64_t>* makeUint64(
+  template<typename Wire_T>
+  wtk::firealarm::FieldBackend<sst::bignum, Wire_T>* allocateField(
       char const* const f_name,
       wtk::circuit::TypeSpec<sst::bignum> const* const type,
       wtk::firealarm::TypeCounter* const ctr)
   {
-    wtk::firealarm::FieldBackend<sst::bignum, uint64_t>* ret =
-      this->uint64.allocate(1, f_name, type, ctr, this->suppressAsserts);
-    this->typeRefs.emplace_back(Precision::uint64, ret);
+    return this->pool<wtk::firealarm::FieldBackend<sst::bignum, Wire_T>>()
+      ->allocate(1, f_name, type, ctr, this->suppressAsserts);
+  }
+
+  // make a GF(2) backend with a 64-bit wire of lanes (one per input set)
+  wtk::firealarm::BitslicedBackend<sst::bignum>* makeBitsliced(
+      char const* const f_name,
+      wtk::circuit::TypeSpec<sst::bignum> const* const type,
+      wtk::firealarm::TypeCounter* const ctr, size_t const lanes)
+  {
+    wtk::firealarm::BitslicedBackend<sst::bignum>* ret =
+      this->bitsliced.allocate(
+          1, f_name, type, ctr, this->suppressAsserts, lanes);
+    this->typeRefs.emplace_back(Precision::bitsliced, ret);
 
     if(this->trace)
     {
@@ -269,15 +571,34 @@ struct TypeManager
     return ret;
   }
 
-  // make a backend with 8-bit wire
-  wtk::firealarm::FieldBackend<sst::bignum, uint8_t>* makeUint8(
+  // make a ring backend with the given Wire_T
+  template<typename Wire_T>
+  wtk::firealarm::RingBackend<sst::bignum, Wire_T>* makeRing(
+      char const* const f_name,
+      wtk::circuit::TypeSpec<sst::bignum> const* const type,
+      wtk::firealarm::TypeCounter* const ctr)
+  {
+    wtk::firealarm::RingBackend<sst::bignum, Wire_T>* ret =
+      this->pool<wtk::firealarm::RingBackend<sst::bignum, Wire_T>>()
+      ->allocate(1, f_name, type, ctr, this->suppressAsserts);
+    this->typeRefs.emplace_back(PrecisionOf<Wire_T>::value, ret);
+
+    if(this->trace)
+    {
+      ret->enableTrace(this->indent);
+    }
+
+    return ret;
+  }
+  // make an extension field backend for degrees up to 2
+  wtk::firealarm::ExtFieldBackend<sst::bignum, 2>* makeExt2(
       char const* const f_name,
       wtk::circuit::TypeSpec<sst::bignum> const* const type,
       wtk::firealarm::TypeCounter* const ctr)
   {
-    wtk::firealarm::FieldBackend<sst::bignum, uint8_t>* ret =
-      this->uint8.allocate(1, f_name, type, ctr, this->suppressAsserts);
-    this->typeRefs.emplace_back(Precision::uint8, ret);
+    wtk::firealarm::ExtFieldBackend<sst::bignum, 2>* ret =
+      this->ext2.allocate(1, f_name, type, ctr, this->suppressAsserts);
+    this->typeRefs.emplace_back(Precision::ext2, ret);
 
     if(this->trace)
     {
@@ -287,54 +608,59 @@ struct TypeManager
     return ret;
   }
 
-  // make a RAM backend with unlimited precision wire
-  wtk::firealarm::RAMBackend<sst::bignum, sst::bignum>* makeRAMUnlimited(
+  // make an extension field backend for degrees up to 4
+  wtk::firealarm::ExtFieldBackend<sst::bignum, 4>* makeExt4(
+      char const* const f_name,
       wtk::circuit::TypeSpec<sst::bignum> const* const type,
-      char const* const f_name, wtk::type_idx const idx_type,
-      wtk::firealarm::TypeCounter* const counter)
+      wtk::firealarm::TypeCounter* const ctr)
   {
-    log_assert(idx_type < this->typeRefs.size()
-        && this->typeRefs[(size_t) idx_type].precision == Precision::unlimited);
+    wtk::firealarm::ExtFieldBackend<sst::bignum, 4>* ret =
+      this->ext4.allocate(1, f_name, type, ctr, this->suppressAsserts);
+    this->typeRefs.emplace_back(Precision::ext4, ret);
+
+    if(this->trace)
+    {
+      ret->enableTrace(this->indent);
+    }
 
-    wtk::firealarm::RAMBackend<sst::bignum, sst::bignum>* ret =
-      this->ramUnlimited.allocate(1, f_name, idx_type,
-          static_cast<wtk::firealarm::FieldBackend<sst::bignum, sst::bignum>*>(
-            this->typeRefs[(size_t) idx_type].erasedType), counter, type);
-    this->typeRefs.emplace_back(Precision::ram_unlimited, ret);
     return ret;
   }
 
-  // make a RAM backend with 64-bit wire
-  wtk::firealarm::RAMBackend<sst::bignum, uint64_t>* makeRAMUint64(
+  // make an extension field backend for degrees up to 8
+  wtk::firealarm::ExtFieldBackend<sst::bignum, 8>* makeExt8(
+      char const* const f_name,
       wtk::circuit::TypeSpec<sst::bignum> const* const type,
-      char const* const f_name, wtk::type_idx const idx_type,
-      wtk::firealarm::TypeCounter* const counter)
+      wtk::firealarm::TypeCounter* const ctr)
   {
-    log_assert(idx_type < this->typeRefs.size()
-        && this->typeRefs[(size_t) idx_type].precision == Precision::uint64);
+    wtk::firealarm::ExtFieldBackend<sst::bignum, 8>* ret =
+      this->ext8.allocate(1, f_name, type, ctr, this->suppressAsserts);
+    this->typeRefs.emplace_back(Precision::ext8, ret);
+
+    if(this->trace)
+    {
+      ret->enableTrace(this->indent);
+    }
 
-    wtk::firealarm::RAMBackend<sst::bignum, uint64_t>* ret =
-      this->ramUint64.allocate(1, f_name, idx_type,
-          static_cast<wtk::firealarm::FieldBackend<sst::bignum, uint64_t>*>(
-            this->typeRefs[(size_t) idx_type].erasedType), counter, type);
-    this->typeRefs.emplace_back(Precision::ram_uint64, ret);
     return ret;
   }
 
-  // make a RAM backend with 8-bit wire
-  wtk::firealarm::RAMBackend<sst::bignum, uint8_t>* makeRAMUint8(
+  // make a RAM backend with the given Wire_T (that of its index type)
+  template<typename Wire_T>
+  wtk::firealarm::RAMBackend<sst::bignum, Wire_T>* makeRAM(
       wtk::circuit::TypeSpec<sst::bignum> const* const type,
       char const* const f_name, wtk::type_idx const idx_type,
       wtk::firealarm::TypeCounter* const counter)
   {
     log_assert(idx_type < this->typeRefs.size()
-        && this->typeRefs[(size_t) idx_type].precision == Precision::uint8);
+        && this->typeRefs[(size_t) idx_type].precision
+          == PrecisionOf<Wire_T>::value);
 
-    wtk::firealarm::RAMBackend<sst::bignum, uint8_t>* ret =
-      this->ramUint8.allocate(1, f_name, idx_type,
-          static_cast<wtk::firealarm::FieldBackend<sst::bignum, uint8_t>*>(
+    wtk::firealarm::RAMBackend<sst::bignum, Wire_T>* ret =
+      this->pool<wtk::firealarm::RAMBackend<sst::bignum, Wire_T>>()
+      ->allocate(1, f_name, idx_type,
+          static_cast<wtk::firealarm::FieldBackend<sst::bignum, Wire_T>*>(
             this->typeRefs[(size_t) idx_type].erasedType), counter, type);
-    this->typeRefs.emplace_back(Precision::ram_uint8, ret);
+    this->typeRefs.emplace_back(Precision::ram, ret);
     return ret;
   }
 
@@ -357,60 +683,22 @@ struct TypeManager
     return ret;
   }
 
-  // make a Fallback RAM backend with unlimited precision wire
-  wtk::plugins::FallbackRAMBackend<
-    sst::bignum, wtk::firealarm::Wire<sst::bignum>>*
-    makeFallbackRAMUnlimited(
-        wtk::circuit::TypeSpec<sst::bignum> const* const type,
-        wtk::type_idx const idx_type)
-  {
-    log_assert(idx_type < this->typeRefs.size()
-        && this->typeRefs[(size_t) idx_type].precision == Precision::unlimited);
-
-    wtk::plugins::FallbackRAMBackend<
-      sst::bignum, wtk::firealarm::Wire<sst::bignum>>* ret =
-      this->fallbackRamUnlimited.allocate(1, type, idx_type,
-          static_cast<wtk::firealarm::FieldBackend<sst::bignum, sst::bignum>*>(
-            this->typeRefs[(size_t) idx_type].erasedType));
-    this->typeRefs.emplace_back(Precision::fallback_ram_unlimited, ret);
-    return ret;
-  }
-
-  // make a Fallback RAM backend with uint64 precision wire
-  wtk::plugins::FallbackRAMBackend<
-    sst::bignum, wtk::firealarm::Wire<uint64_t>>*
-    makeFallbackRAMUint64(
-        wtk::circuit::TypeSpec<sst::bignum> const* const type,
-        wtk::type_idx const idx_type)
-  {
-    log_assert(idx_type < this->typeRefs.size()
-        && this->typeRefs[(size_t) idx_type].precision == Precision::uint64);
-
-    wtk::plugins::FallbackRAMBackend<
-      sst::bignum, wtk::firealarm::Wire<uint64_t>>* ret =
-      this->fallbackRamUint64.allocate(1, type, idx_type,
-          static_cast<wtk::firealarm::FieldBackend<sst::bignum, uint64_t>*>(
-            this->typeRefs[(size_t) idx_type].erasedType));
-    this->typeRefs.emplace_back(Precision::fallback_ram_uint64, ret);
-    return ret;
-  }
-
-  // make a Fallback RAM backend with uint8 precision wire
-  wtk::plugins::FallbackRAMBackend<
-    sst::bignum, wtk::firealarm::Wire<uint8_t>>*
-    makeFallbackRAMUint8(
-        wtk::circuit::TypeSpec<sst::bignum> const* const type,
-        wtk::type_idx const idx_type)
+  // make a Fallback RAM backend with the given Wire_T
+  template<typename Wire_T>
+  FallbackRAMBackend<sst::bignum, Wire_T>* makeFallbackRAM(
+      wtk::circuit::TypeSpec<sst::bignum> const* const type,
+      wtk::type_idx const idx_type)
   {
     log_assert(idx_type < this->typeRefs.size()
-        && this->typeRefs[(size_t) idx_type].precision == Precision::uint8);
+        && this->typeRefs[(size_t) idx_type].precision
+          == PrecisionOf<Wire_T>::value);
 
-    wtk::plugins::FallbackRAMBackend<
-      sst::bignum, wtk::firealarm::Wire<uint8_t>>* ret =
-      this->fallbackRamUint8.allocate(1, type, idx_type,
-          static_cast<wtk::firealarm::FieldBackend<sst::bignum, uint8_t>*>(
+    FallbackRAMBackend<sst::bignum, Wire_T>* ret =
+      this->pool<FallbackRAMBackend<sst::bignum, Wire_T>>()->allocate(
+          1, type, idx_type,
+          static_cast<wtk::firealarm::FieldBackend<sst::bignum, Wire_T>*>(
             this->typeRefs[(size_t) idx_type].erasedType));
-    this->typeRefs.emplace_back(Precision::fallback_ram_uint8, ret);
+    this->typeRefs.emplace_back(Precision::fallback_ram, ret);
     return ret;
   }
 
@@ -430,40 +718,226 @@ struct TypeManager
       this->fallbackBoolRamUint8.allocate(1, type, idx_type,
           static_cast<wtk::firealarm::FieldBackend<sst::bignum, uint8_t>*>(
             this->typeRefs[(size_t) idx_type].erasedType), idx_bits, elt_bits);
-    this->typeRefs.emplace_back(Precision::fallback_bool_ram_uint8, ret);
+    this->typeRefs.emplace_back(Precision::fallback_bool_ram, ret);
     return ret;
   }
 
-  /* ==== pool allocators for converters ==== */
-
-  // out type: unlimited, in type: *
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, sst::bignum, sst::bignum>, 1> convertUnlimitedUnlimited;
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, sst::bignum, uint64_t>, 1> convertUnlimitedUint64;
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, sst::bignum, uint8_t>, 1> convertUnlimitedUint8;
-
-  // out type: uint64, in type: *
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, uint64_t, sst::bignum>, 1> convertUint64Unlimited;
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, uint64_t, uint64_t>, 1> convertUint64Uint64;
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, uint64_t, uint8_t>, 1> convertUint64Uint8;
-
-  // out type: uint8, in type: *
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, uint8_t, sst::bignum>, 1> convertUint8Unlimited;
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, uint8_t, uint64_t>, 1> convertUint8Uint64;
-  wtk::utils::Pool<wtk::firealarm::Converter<
-    sst::bignum, uint8_t, uint8_t>, 1> convertUint8Uint8;
+
+  // make a converter between the given Wire_Ts
+  template<typename Out_T, typename In_T>
+  wtk::firealarm::Converter<sst::bignum, Out_T, In_T>* makeConverter(
+      sst::bignum const& out_radix, sst::bignum const& in_radix,
+      size_t const out_length, size_t const in_length,
+      wtk::firealarm::TypeCounter* const out_counter,
+      size_t* const count, char const* const f_name)
+  {
+    return this->pool<wtk::firealarm::Converter<sst::bignum, Out_T, In_T>>()
+      ->allocate(1, out_radix, in_radix, out_length, in_length,
+          out_counter, count, f_name);
+  }
+};
+
+// GF(2) is specialized by the BooleanBackend.
+template<>
+wtk::firealarm::FieldBackend<sst::bignum, uint8_t>*
+TypeManager::allocateField<uint8_t>(
+    char const* const f_name,
+    wtk::circuit::TypeSpec<sst::bignum> const* const type,
+    wtk::firealarm::TypeCounter* const ctr)
+{
+  return type->prime == 2
+    ? this->boolean.allocate(1, f_name, type, ctr, this->suppressAsserts)
+    : this->pool<wtk::firealarm::FieldBackend<sst::bignum, uint8_t>>()
+      ->allocate(1, f_name, type, ctr, this->suppressAsserts);
+}
+
+// Plugins Manager, with each Wire_T and RAM buffer of FIREALARM
+typedef wtk::plugins::PluginsManager<sst::bignum,
+  wtk::firealarm::Wire<sst::bignum>,
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+  wtk::firealarm::Wire<fixed256_t>,
+  wtk::firealarm::Wire<fixed128_t>,
+  wtk::firealarm::RAMBuffer<fixed256_t>,
+  wtk::firealarm::RAMBuffer<fixed128_t>,
+  wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<fixed256_t>>,
+  wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<fixed128_t>>,
+#endif//WTK_UTILS_MODULUS_WIDE_64
+  wtk::firealarm::Wire<uint64_t>,
+  wtk::firealarm::Wire<uint32_t>,
+  wtk::firealarm::Wire<uint16_t>,
+  wtk::firealarm::Wire<uint8_t>,
+  wtk::firealarm::Wire<ext8_t>,
+  wtk::firealarm::Wire<ext4_t>,
+  wtk::firealarm::Wire<ext2_t>,
+  wtk::firealarm::RAMBuffer<sst::bignum>,
+  wtk::firealarm::RAMBuffer<uint8_t>,
+  wtk::firealarm::RAMBuffer<uint16_t>,
+  wtk::firealarm::RAMBuffer<uint32_t>,
+  wtk::firealarm::RAMBuffer<uint64_t>,
+  wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<sst::bignum>>,
+  wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<uint64_t>>,
+  wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<uint32_t>>,
+  wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<uint16_t>>,
+  wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<uint8_t>>,
+  wtk::plugins::FallbackBoolRAMBuffer<wtk::firealarm::Wire<uint8_t>>>
+    FirealarmPluginsManager;
+
+// Adds a field or ring type, with the Wire_T of its precision.
+struct TypeVisitor
+{
+  TypeManager* const manager;
+  wtk::nails::Interpreter<sst::bignum>* const interpreter;
+  FirealarmPluginsManager* const pluginsManager;
+  wtk::circuit::TypeSpec<sst::bignum> const* const type;
+  wtk::type_idx const index;
+  char const* const fileName;
+  wtk::firealarm::TypeCounter* const counter;
+  wtk::InputStream<sst::bignum>* const publicStream;
+  wtk::InputStream<sst::bignum>* const privateStream;
+
+  template<typename Wire_T>
+  bool visit()
+  {
+    wtk::TypeBackend<sst::bignum, wtk::firealarm::Wire<Wire_T>>* backend =
+      nullptr;
+    if(this->type->variety == wtk::circuit::TypeSpec<sst::bignum>::ring)
+    {
+      backend = this->manager->makeRing<Wire_T>(
+          this->fileName, this->type, this->counter);
+    }
+    else
+    {
+      backend = this->manager->makeField<Wire_T>(
+          this->fileName, this->type, this->counter);
+    }
+
+    this->interpreter->addType<wtk::firealarm::Wire<Wire_T>>(
+        backend, this->publicStream, this->privateStream);
+    this->pluginsManager->addBackend(this->index, backend);
+    return true;
+  }
+
+  bool unsupported()
+  {
+    log_error("Cannot instantiate type %zu", (size_t) this->index);
+    return false;
+  }
+};
+
+// Adds an arithmetic RAM type, with the Wire_T of its index type.
+struct RAMVisitor
+{
+  TypeManager* const manager;
+  wtk::nails::Interpreter<sst::bignum>* const interpreter;
+  FirealarmPluginsManager* const pluginsManager;
+  wtk::circuit::TypeSpec<sst::bignum> const* const type;
+  wtk::type_idx const index;
+  wtk::type_idx const idxType;
+  char const* const fileName;
+  wtk::firealarm::TypeCounter* const counter;
+  bool const fallback;
+
+  template<typename Wire_T>
+  bool visit()
+  {
+    if(this->fallback)
+    {
+      FallbackRAMBackend<sst::bignum, Wire_T>* backend =
+        this->manager->makeFallbackRAM<Wire_T>(this->type, this->idxType);
+
+      this->interpreter->addType<wtk::plugins::FallbackRAMBuffer<
+        wtk::firealarm::Wire<Wire_T>>>(backend, nullptr, nullptr);
+
+      this->pluginsManager->addBackend(this->index, backend);
+    }
+    else
+    {
+      wtk::firealarm::RAMBackend<sst::bignum, Wire_T>* backend =
+        this->manager->makeRAM<Wire_T>(
+            this->type, this->fileName, this->idxType, this->counter);
+
+      this->interpreter->addType<wtk::firealarm::RAMBuffer<Wire_T>>(
+          backend, nullptr, nullptr);
+
+      this->pluginsManager->addBackend(this->index, backend);
+    }
+
+    return true;
+  }
+
+  bool unsupported()
+  {
+    log_error("Cannot use RAM with type %d", (int) this->idxType);
+    return false;
+  }
+};
+
+// Adds a converter, with the Wire_Ts of its output and input types.
+struct ConverterVisitor
+{
+  TypeManager* const manager;
+  wtk::nails::Interpreter<sst::bignum>* const interpreter;
+  wtk::circuit::ConversionSpec const* const spec;
+  wtk::circuit::TypeSpec<sst::bignum> const* const outType;
+  wtk::circuit::TypeSpec<sst::bignum> const* const inType;
+  Precision const inPrecision;
+  wtk::firealarm::TypeCounter* const outCounter;
+  size_t* const count;
+  char const* const fileName;
+
+  // Having found Out_T, visits the input precision for In_T.
+  template<typename Out_T>
+  struct InputVisitor
+  {
+    ConverterVisitor* const outer;
+
+    template<typename In_T>
+    bool visit()
+    {
+      ConverterVisitor const* const o = this->outer;
+      o->interpreter->addConversion(o->spec,
+          o->manager->makeConverter<Out_T, In_T>(
+            o->outType->maxValue(), o->inType->maxValue(),
+            o->spec->outLength, o->spec->inLength,
+            o->outCounter, o->count, o->fileName));
+      return true;
+    }
+
+    bool unsupported() { return this->outer->unsupported(); }
+  };
+
+  template<typename Out_T>
+  bool visit()
+  {
+    InputVisitor<Out_T> in_visitor = { this };
+    return visitPrecision(Wires(), this->inPrecision, &in_visitor);
+  }
+
+  bool unsupported()
+  {
+    log_error("Cannot convert from type %d to type %d",
+        (int) this->spec->inType, (int) this->spec->outType);
+    return false;
+  }
 };
 
 template<typename Parser_T>
 int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers);
 
+template<typename Parser_T>
+int batchmain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers);
+
+// Evaluate the relation with the given input streams, parsing it or else
+// replaying its recording (in batch mode). The relation is not checked if
+// it is already known to be valid.
+template<typename Parser_T>
+int evaluate(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers,
+    wtk::utils::Setting const setting,
+    std::vector<typename wtk::utils::ParserOrganizer<
+      Parser_T, sst::bignum>::InputStreamPair> const& streams,
+    wtk::circuit::Recorder<sst::bignum> const* const recording,
+    bool const valid);
+
 int main(int argc, char const* argv[])
 {
   read_arguments(argc, argv);
@@ -501,91 +975,312 @@ int main(int argc, char const* argv[])
 template<typename Parser_T>
 int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
 {
+  if(batch_name != nullptr) { return batchmain(parsers); }
+
   for(size_t i = 0; i < resource_names.size(); i++)
   {
     if(!parsers.open(resource_names[i])) { return 1; }
   }
 
+  parsers.multipleStreamSets = bitslice_flag;
+
   wtk::utils::Setting setting = parsers.organize();
-  bool suppress_asserts = false;
   if(setting == wtk::utils::Setting::failure) { return 1; }
+  else if(bitslice_flag
+      && parsers.streamSets.size() > wtk::firealarm::BITSLICED_LANES)
+  {
+    log_error("--bitslice is limited to %zu input sets, but %zu were given",
+        wtk::firealarm::BITSLICED_LANES, parsers.streamSets.size());
+    return 1;
+  }
   else if(setting == wtk::utils::Setting::verifier)
   {
     log_warn("Running wtk-firealarm in the verifier setting will suppress "
         "@assert_zero gates to avoid false positives.");
-    suppress_asserts = true;
   }
-  else if(setting == wtk::utils::Setting::preprocess)
+
+  return evaluate(parsers, setting, parsers.circuitStreams, nullptr, false);
+}
+
+template<typename Parser_T>
+int batchmain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
+{
+  // Traces, profiles and certificates are of a single evaluation.
+  if(short_trace_flag || profile_name != nullptr || certify_name != nullptr
+      || bitslice_flag)
   {
-    suppress_asserts = true;
+    log_error("--batch cannot be used with traces, --profile, --certify, "
+        "or --bitslice");
+    return 1;
   }
 
-  // Counters for current/maximum active wire reporting.
-  // These are pointed to/updated by all the FIREALARM backends
-  size_t totalCurrentCount = 0;
-  size_t totalMaximumCount = 0;
-
-  // Allocate counters for each backend
-  std::vector<wtk::firealarm::TypeCounter> counters;
-  counters.reserve(parsers.circuitBodyParser->types.size());
+  // Each line of the list names the input streams of one pair.
+  std::vector<std::vector<std::string>> pair_names;
+  std::ifstream list(batch_name);
+  if(!list)
+  {
+    log_error("Could not open batch list %s", batch_name);
+    return 1;
+  }
 
-  // NAILS Interpreter
-  wtk::nails::Interpreter<sst::bignum> interpreter(parsers.circuitName);
+  std::string line;
+  while(std::getline(list, line))
+  {
+    std::istringstream words(line);
+    std::vector<std::string> names;
+    std::string name;
+    while(words >> name) { names.emplace_back(std::move(name)); }
 
-  if(short_trace_flag) { interpreter.enableTrace(); }
-  if(detail_trace_flag) { interpreter.enableTraceDetail(); }
+    if(names.size() != 0) { pair_names.emplace_back(std::move(names)); }
+  }
 
-  TypeManager manager(suppress_asserts);
-  if(detail_trace_flag)
+  if(pair_names.size() == 0)
   {
-    manager.enableTrace(&interpreter.indent);
+    log_error("No input streams listed in %s", batch_name);
+    return 1;
   }
 
-  // Plugins Manager
-  wtk::plugins::PluginsManager<sst::bignum,
-    wtk::firealarm::Wire<sst::bignum>,
-    wtk::firealarm::Wire<uint64_t>,
-    wtk::firealarm::Wire<uint8_t>,
-    wtk::firealarm::RAMBuffer<sst::bignum>,
-    wtk::firealarm::RAMBuffer<uint8_t>,
-    wtk::firealarm::RAMBuffer<uint64_t>,
-    wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<sst::bignum>>,
-    wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<uint64_t>>,
-    wtk::plugins::FallbackRAMBuffer<wtk::firealarm::Wire<uint8_t>>,
-    wtk::plugins::FallbackBoolRAMBuffer<wtk::firealarm::Wire<uint8_t>>>
-      plugins_manager;
+  for(size_t i = 0; i < resource_names.size(); i++)
+  {
+    if(!parsers.open(resource_names[i])) { return 1; }
+  }
 
-  wtk::nails::MapOperation<sst::bignum> map_op(&interpreter);
+  if(parsers.organize() == wtk::utils::Setting::failure) { return 1; }
 
-  // load all the plugins indicated in the relation's header.
-  for(size_t i = 0; i < parsers.circuitBodyParser->plugins.size(); i++)
+  for(size_t i = 0; i < parsers.circuitStreams.size(); i++)
   {
-    if(detail_counts)
+    if(parsers.circuitStreams[i].publicName != nullptr
+        || parsers.circuitStreams[i].privateName != nullptr)
     {
-      log_info("loading plugin: %s",
-          parsers.circuitBodyParser->plugins[i].c_str());
+      log_error("With --batch, input streams must be given by the list");
+      return 1;
     }
+  }
 
-    if("wizkit_vectors" == parsers.circuitBodyParser->plugins[i])
+  // Parse once, and replay for each pair.
+  wtk::circuit::Recorder<sst::bignum> recording;
+  if(!parsers.circuitBodyParser->parse(&recording)) { return 1; }
+
+  if(detail_counts)
+  {
+    log_info("recorded relation: %zu bytes", recording.bytes());
+  }
+
+  size_t jobs = batch_jobs;
+  if(jobs == 0) { jobs = (size_t) std::thread::hardware_concurrency(); }
+  if(jobs == 0) { jobs = 1; }
+  if(jobs > pair_names.size()) { jobs = pair_names.size(); }
+
+  std::vector<char> pair_wins(pair_names.size(), 0);
+
+  auto run = [&](size_t const k, bool const valid)
+  {
+    std::vector<char const*> names;
+    for(size_t i = 0; i < pair_names[k].size(); i++)
     {
-      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
-        wtk::firealarm::Wire<sst::bignum>>> vector_bignum_plugin_ptr(
-            new wtk::plugins::FallbackVectorPlugin<
-            sst::bignum, wtk::firealarm::Wire<sst::bignum>>());
-      plugins_manager.addPlugin(
-          "wizkit_vectors", std::move(vector_bignum_plugin_ptr));
+      names.push_back(pair_names[k][i].c_str());
+    }
 
-      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
-        wtk::firealarm::Wire<uint64_t>>> vector_uint64_plugin_ptr(
-            new wtk::plugins::FallbackVectorPlugin<
-            sst::bignum, wtk::firealarm::Wire<uint64_t>>());
-      plugins_manager.addPlugin(
-          "wizkit_vectors", std::move(vector_uint64_plugin_ptr));
+    std::vector<Parser_T> stream_parsers;
+    std::vector<typename wtk::utils::ParserOrganizer<
+      Parser_T, sst::bignum>::InputStreamPair> streams;
+    wtk::utils::Setting const setting =
+      parsers.openStreamSet(names, &stream_parsers, &streams);
 
-      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
-        wtk::firealarm::Wire<uint8_t>>> vector_uint8_plugin_ptr(
-            new wtk::plugins::FallbackVectorPlugin<
-            sst::bignum, wtk::firealarm::Wire<uint8_t>>());
+    pair_wins[k] = setting != wtk::utils::Setting::failure
+      && 0 == evaluate(parsers, setting, streams, &recording, valid);
+  };
+
+  // The relation, including its function bodies, is checked with the first
+  // pair. Its success shows the relation is valid, so the other pairs skip
+  // the checks (as with --trusted). Otherwise each pair is checked.
+  run(0, false);
+  bool const valid = pair_wins[0];
+
+  std::atomic<size_t> next_pair(1);
+  auto work = [&]()
+  {
+    for(size_t k = next_pair++; k < pair_names.size(); k = next_pair++)
+    {
+      run(k, valid);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for(size_t i = 1; i < jobs; i++) { threads.emplace_back(work); }
+  work();
+  for(size_t i = 0; i < threads.size(); i++) { threads[i].join(); }
+
+  // Report on each pair, in order of the list.
+  size_t wins = 0;
+  for(size_t k = 0; k < pair_names.size(); k++)
+  {
+    std::string name = pair_names[k][0];
+    for(size_t i = 1; i < pair_names[k].size(); i++)
+    {
+      name += " " + pair_names[k][i];
+    }
+
+    if(pair_wins[k])
+    {
+      log_info("pair %zu (%s): evaluated successfully", k, name.c_str());
+      wins++;
+    }
+    else
+    {
+      log_error("pair %zu (%s): failed", k, name.c_str());
+    }
+  }
+
+  log_info("%zu of %zu pairs evaluated successfully",
+      wins, pair_names.size());
+
+  return wins == pair_names.size() ? 0 : 1;
+}
+
+template<typename Parser_T>
+int evaluate(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers,
+    wtk::utils::Setting const setting,
+    std::vector<typename wtk::utils::ParserOrganizer<
+      Parser_T, sst::bignum>::InputStreamPair> const& streams,
+    wtk::circuit::Recorder<sst::bignum> const* const recording,
+    bool const valid)
+{
+  // Assertions are checked only in the prover setting.
+  bool const suppress_asserts = setting != wtk::utils::Setting::prover;
+
+  // Counters for current/maximum active wire reporting.
+  // These are pointed to/updated by all the FIREALARM backends
+  std::atomic<size_t> totalCurrentCount(0);
+  std::atomic<size_t> totalMaximumCount(0);
+
+  // Allocate counters for each backend
+  std::vector<wtk::firealarm::TypeCounter> counters;
+  counters.reserve(parsers.circuitBodyParser->types.size());
+
+  // NAILS Interpreter
+  wtk::nails::Interpreter<sst::bignum> interpreter(parsers.circuitName);
+
+  if(short_trace_flag) { interpreter.enableTrace(); }
+  if(detail_trace_flag) { interpreter.enableTraceDetail(); }
+
+  if(trusted_name != nullptr)
+  {
+    if(!wtk::utils::checkCertificate(trusted_name, parsers.circuitName))
+    {
+      return 1;
+    }
+
+    interpreter.enableTrusted();
+  }
+  else if(valid) { interpreter.enableTrusted(); }
+
+  std::unique_ptr<wtk::nails::Profiler> profiler;
+  if(profile_name != nullptr)
+  {
+    profiler.reset(new wtk::nails::Profiler(parsers.circuitName));
+    interpreter.profiler = profiler.get();
+  }
+
+  std::unique_ptr<wtk::nails::Memoizer<sst::bignum>> memoizer;
+  if(memoize_bytes != 0)
+  {
+    memoizer.reset(new wtk::nails::Memoizer<sst::bignum>(memoize_bytes));
+    interpreter.memoizer = memoizer.get();
+  }
+
+  if(parallel_flag)
+  {
+    // Traces are ordered, so they can't be produced by multiple threads.
+    if(short_trace_flag || detail_trace_flag)
+    {
+      log_warn("--parallel is ignored when tracing");
+    }
+    else
+    {
+      interpreter.enableParallel();
+    }
+  }
+
+  TypeManager manager(suppress_asserts);
+  if(detail_trace_flag)
+  {
+    manager.enableTrace(&interpreter.indent);
+  }
+
+  // Plugins Manager
+  FirealarmPluginsManager plugins_manager;
+
+  wtk::nails::MapOperation<sst::bignum> map_op(&interpreter);
+
+  // load all the plugins indicated in the relation's header.
+  for(size_t i = 0; i < parsers.circuitBodyParser->plugins.size(); i++)
+  {
+    if(detail_counts)
+    {
+      log_info("loading plugin: %s",
+          parsers.circuitBodyParser->plugins[i].c_str());
+    }
+
+    // Other plugins may inspect the values of wires, which hold many lanes.
+    if(bitslice_flag && "iter_v0" != parsers.circuitBodyParser->plugins[i])
+    {
+      log_error("Plugin \"%s\" is not supported with --bitslice",
+          parsers.circuitBodyParser->plugins[i].c_str());
+      return 1;
+    }
+
+    if("wizkit_vectors" == parsers.circuitBodyParser->plugins[i])
+    {
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<sst::bignum>>> vector_bignum_plugin_ptr(
+            new wtk::plugins::FallbackVectorPlugin<
+            sst::bignum, wtk::firealarm::Wire<sst::bignum>>());
+      plugins_manager.addPlugin(
+          "wizkit_vectors", std::move(vector_bignum_plugin_ptr));
+
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<fixed256_t>>> vector_uint256_plugin_ptr(
+            new wtk::plugins::FallbackVectorPlugin<
+            sst::bignum, wtk::firealarm::Wire<fixed256_t>>());
+      plugins_manager.addPlugin(
+          "wizkit_vectors", std::move(vector_uint256_plugin_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<fixed128_t>>> vector_uint128_plugin_ptr(
+            new wtk::plugins::FallbackVectorPlugin<
+            sst::bignum, wtk::firealarm::Wire<fixed128_t>>());
+      plugins_manager.addPlugin(
+          "wizkit_vectors", std::move(vector_uint128_plugin_ptr));
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint64_t>>> vector_uint64_plugin_ptr(
+            new wtk::plugins::FallbackVectorPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint64_t>>());
+      plugins_manager.addPlugin(
+          "wizkit_vectors", std::move(vector_uint64_plugin_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint32_t>>> vector_uint32_plugin_ptr(
+            new wtk::plugins::FallbackVectorPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint32_t>>());
+      plugins_manager.addPlugin(
+          "wizkit_vectors", std::move(vector_uint32_plugin_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint16_t>>> vector_uint16_plugin_ptr(
+            new wtk::plugins::FallbackVectorPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint16_t>>());
+      plugins_manager.addPlugin(
+          "wizkit_vectors", std::move(vector_uint16_plugin_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint8_t>>> vector_uint8_plugin_ptr(
+            new wtk::plugins::FallbackVectorPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint8_t>>());
       plugins_manager.addPlugin(
           "wizkit_vectors", std::move(vector_uint8_plugin_ptr));
     }
@@ -604,6 +1299,25 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
         plugins_manager.addPlugin(
             plugin_name, std::move(ram_bignum_plugin_ptr));
 
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::plugins::FallbackRAMBuffer<
+            wtk::firealarm::Wire<fixed256_t>>>> ram_uint256_plugin_ptr(
+                new wtk::plugins::FallbackRAMPlugin<
+                  sst::bignum, wtk::firealarm::Wire<fixed256_t>>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint256_plugin_ptr));
+
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::plugins::FallbackRAMBuffer<
+            wtk::firealarm::Wire<fixed128_t>>>> ram_uint128_plugin_ptr(
+                new wtk::plugins::FallbackRAMPlugin<
+                  sst::bignum, wtk::firealarm::Wire<fixed128_t>>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint128_plugin_ptr));
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
         std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
           wtk::plugins::FallbackRAMBuffer<
             wtk::firealarm::Wire<uint64_t>>>> ram_uint64_plugin_ptr(
@@ -612,6 +1326,22 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
         plugins_manager.addPlugin(
             plugin_name, std::move(ram_uint64_plugin_ptr));
 
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::plugins::FallbackRAMBuffer<
+            wtk::firealarm::Wire<uint32_t>>>> ram_uint32_plugin_ptr(
+                new wtk::plugins::FallbackRAMPlugin<
+                  sst::bignum, wtk::firealarm::Wire<uint32_t>>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint32_plugin_ptr));
+
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::plugins::FallbackRAMBuffer<
+            wtk::firealarm::Wire<uint16_t>>>> ram_uint16_plugin_ptr(
+                new wtk::plugins::FallbackRAMPlugin<
+                  sst::bignum, wtk::firealarm::Wire<uint16_t>>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint16_plugin_ptr));
+
         std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
           wtk::plugins::FallbackRAMBuffer<
             wtk::firealarm::Wire<uint8_t>>>> ram_uint8_plugin_ptr(
@@ -628,12 +1358,39 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
         plugins_manager.addPlugin(
             plugin_name, std::move(ram_bignum_plugin_ptr));
 
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::firealarm::RAMBuffer<fixed256_t>>> ram_uint256_plugin_ptr(
+              new wtk::firealarm::RAMPlugin<sst::bignum, fixed256_t>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint256_plugin_ptr));
+
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::firealarm::RAMBuffer<fixed128_t>>> ram_uint128_plugin_ptr(
+              new wtk::firealarm::RAMPlugin<sst::bignum, fixed128_t>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint128_plugin_ptr));
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
         std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
           wtk::firealarm::RAMBuffer<uint64_t>>> ram_uint64_plugin_ptr(
               new wtk::firealarm::RAMPlugin<sst::bignum, uint64_t>());
         plugins_manager.addPlugin(
             plugin_name, std::move(ram_uint64_plugin_ptr));
 
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::firealarm::RAMBuffer<uint32_t>>> ram_uint32_plugin_ptr(
+              new wtk::firealarm::RAMPlugin<sst::bignum, uint32_t>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint32_plugin_ptr));
+
+        std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+          wtk::firealarm::RAMBuffer<uint16_t>>> ram_uint16_plugin_ptr(
+              new wtk::firealarm::RAMPlugin<sst::bignum, uint16_t>());
+        plugins_manager.addPlugin(
+            plugin_name, std::move(ram_uint16_plugin_ptr));
+
         std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
           wtk::firealarm::RAMBuffer<uint8_t>>> ram_uint8_plugin_ptr(
               new wtk::firealarm::RAMPlugin<sst::bignum, uint8_t>());
@@ -666,14 +1423,44 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
     {
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::firealarm::Wire<sst::bignum>>());
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::Wire<fixed256_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::Wire<fixed128_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::RAMBuffer<fixed256_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::RAMBuffer<fixed128_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::plugins::FallbackRAMBuffer<
+          wtk::firealarm::Wire<fixed256_t>>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::plugins::FallbackRAMBuffer<
+          wtk::firealarm::Wire<fixed128_t>>>());
+#endif//WTK_UTILS_MODULUS_WIDE_64
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::firealarm::Wire<uint64_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::Wire<uint32_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::Wire<uint16_t>>());
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::firealarm::Wire<uint8_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::Wire<ext8_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::Wire<ext4_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::Wire<ext2_t>>());
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::firealarm::RAMBuffer<sst::bignum>>());
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::firealarm::RAMBuffer<uint64_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::RAMBuffer<uint32_t>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::firealarm::RAMBuffer<uint16_t>>());
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::firealarm::RAMBuffer<uint8_t>>());
       plugins_manager.addPlugin("iter_v0",
@@ -682,6 +1469,12 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::plugins::FallbackRAMBuffer<
           wtk::firealarm::Wire<uint64_t>>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::plugins::FallbackRAMBuffer<
+          wtk::firealarm::Wire<uint32_t>>>());
+      plugins_manager.addPlugin("iter_v0",
+          map_op.makePlugin<wtk::plugins::FallbackRAMBuffer<
+          wtk::firealarm::Wire<uint16_t>>>());
       plugins_manager.addPlugin("iter_v0",
           map_op.makePlugin<wtk::plugins::FallbackRAMBuffer<
           wtk::firealarm::Wire<uint8_t>>>());
@@ -698,6 +1491,23 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
       plugins_manager.addPlugin(
           "mux_v0", std::move(multiplexer_bignum_plugin_ptr));
 
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<fixed256_t>>> multiplexer_uint256_plugin_ptr(
+            new wtk::plugins::FallbackMultiplexerPlugin<
+            sst::bignum, wtk::firealarm::Wire<fixed256_t>>());
+      plugins_manager.addPlugin(
+          "mux_v0", std::move(multiplexer_uint256_plugin_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<fixed128_t>>> multiplexer_uint128_plugin_ptr(
+            new wtk::plugins::FallbackMultiplexerPlugin<
+            sst::bignum, wtk::firealarm::Wire<fixed128_t>>());
+      plugins_manager.addPlugin(
+          "mux_v0", std::move(multiplexer_uint128_plugin_ptr));
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
       std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
         wtk::firealarm::Wire<uint64_t>>> multiplexer_uint64_plugin_ptr(
             new wtk::plugins::FallbackMultiplexerPlugin<
@@ -705,6 +1515,20 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
       plugins_manager.addPlugin(
           "mux_v0", std::move(multiplexer_uint64_plugin_ptr));
 
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint32_t>>> multiplexer_uint32_plugin_ptr(
+            new wtk::plugins::FallbackMultiplexerPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint32_t>>());
+      plugins_manager.addPlugin(
+          "mux_v0", std::move(multiplexer_uint32_plugin_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint16_t>>> multiplexer_uint16_plugin_ptr(
+            new wtk::plugins::FallbackMultiplexerPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint16_t>>());
+      plugins_manager.addPlugin(
+          "mux_v0", std::move(multiplexer_uint16_plugin_ptr));
+
       std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
         wtk::firealarm::Wire<uint8_t>>> multiplexer_uint8_plugin_ptr(
             new wtk::plugins::FallbackMultiplexerPlugin<
@@ -721,6 +1545,23 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
       plugins_manager.addPlugin(
           "extended_arithmetic_v1", std::move(arith_plugin_bignum_ptr));
 
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<fixed256_t>>> arith_plugin_uint256_ptr(
+            new wtk::plugins::FallbackExtendedArithmeticPlugin<
+            sst::bignum, wtk::firealarm::Wire<fixed256_t>>(setting));
+      plugins_manager.addPlugin(
+          "extended_arithmetic_v1", std::move(arith_plugin_uint256_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<fixed128_t>>> arith_plugin_uint128_ptr(
+            new wtk::plugins::FallbackExtendedArithmeticPlugin<
+            sst::bignum, wtk::firealarm::Wire<fixed128_t>>(setting));
+      plugins_manager.addPlugin(
+          "extended_arithmetic_v1", std::move(arith_plugin_uint128_ptr));
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
       std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
         wtk::firealarm::Wire<uint64_t>>> arith_plugin_uint64_ptr(
             new wtk::plugins::FallbackExtendedArithmeticPlugin<
@@ -728,6 +1569,20 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
       plugins_manager.addPlugin(
           "extended_arithmetic_v1", std::move(arith_plugin_uint64_ptr));
 
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint32_t>>> arith_plugin_uint32_ptr(
+            new wtk::plugins::FallbackExtendedArithmeticPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint32_t>>(setting));
+      plugins_manager.addPlugin(
+          "extended_arithmetic_v1", std::move(arith_plugin_uint32_ptr));
+
+      std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
+        wtk::firealarm::Wire<uint16_t>>> arith_plugin_uint16_ptr(
+            new wtk::plugins::FallbackExtendedArithmeticPlugin<
+            sst::bignum, wtk::firealarm::Wire<uint16_t>>(setting));
+      plugins_manager.addPlugin(
+          "extended_arithmetic_v1", std::move(arith_plugin_uint16_ptr));
+
       std::unique_ptr<wtk::plugins::Plugin<sst::bignum,
         wtk::firealarm::Wire<uint8_t>>> arith_plugin_uint8_ptr(
             new wtk::plugins::FallbackExtendedArithmeticPlugin<
@@ -751,116 +1606,99 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
     return 1;
   }
 
+  // Bitsliced backends and their streams, which pack the input sets.
+  std::vector<wtk::firealarm::BitslicedBackend<sst::bignum>*> sliced;
+  std::vector<std::unique_ptr<
+    wtk::firealarm::LaneStream<sst::bignum>>> lane_streams;
+
   // Create a backend for each type indicated by the relation's header.
   for(size_t i = 0; i < parsers.circuitBodyParser->types.size(); i++)
   {
     wtk::circuit::TypeSpec<sst::bignum>* type =
       &parsers.circuitBodyParser->types[i];
 
-    if(type->variety == wtk::circuit::TypeSpec<sst::bignum>::plugin
-        && (type->binding.name == "ram_arith_v0"
-          || type->binding.name == "ram_arith_v1"))
+    if(bitslice_flag)
     {
-      wtk::type_idx idx_type = 0;
-      wtk::wire_idx num_allocs = 0;
-      wtk::wire_idx total_alloc = 0;
-      wtk::wire_idx max_alloc = 0;
-
-      if(type->binding.name == "ram_arith_v0" && !wtk::plugins::checkRAMv0Type(
-            type, &idx_type, &num_allocs, &total_alloc, &max_alloc))
+      if(type->variety != wtk::circuit::TypeSpec<sst::bignum>::field
+          || type->prime != 2)
       {
+        log_error("--bitslice supports only GF(2) types, not type %zu (%s)",
+            i, wtk::utils::type_str(type).c_str());
         return 1;
       }
 
-      counters.emplace_back(nullptr, nullptr, true);
-      wtk::firealarm::TypeCounter* const ctr = &counters.back();
+      counters.emplace_back(&totalCurrentCount, &totalMaximumCount);
 
-      switch(manager.typeRefs[(size_t) idx_type].precision)
-      {
-      case Precision::unlimited:
+      wtk::firealarm::BitslicedBackend<sst::bignum>* backend =
+        manager.makeBitsliced(parsers.circuitName, type, &counters.back(),
+            parsers.streamSets.size());
+      sliced.push_back(backend);
+
+      wtk::firealarm::LaneStream<sst::bignum>* lane_ins[2] = { };
+      for(size_t j = 0; j < 2; j++)
       {
-        if(fallback_ram_flag)
+        std::vector<wtk::InputStream<sst::bignum>*> lanes;
+        std::vector<char const*> names;
+        for(size_t k = 0; k < parsers.streamSets.size(); k++)
         {
-          wtk::plugins::FallbackRAMBackend<
-            sst::bignum, wtk::firealarm::Wire<sst::bignum>>* backend =
-              manager.makeFallbackRAMUnlimited(type, idx_type);
+          auto const& pair = parsers.streamSets[k][i];
+          wtk::InputStream<sst::bignum>* const stream =
+            j == 0 ? pair.publicStream : pair.privateStream;
+          if(stream == nullptr) { break; }
 
-          interpreter.addType<wtk::plugins::FallbackRAMBuffer<
-            wtk::firealarm::Wire<sst::bignum>>>(
-              backend, nullptr, nullptr);
-
-          plugins_manager.addBackend((wtk::type_idx) i, backend);
+          lanes.push_back(stream);
+          names.push_back(j == 0 ? pair.publicName : pair.privateName);
         }
-        else
-        {
-          wtk::firealarm::RAMBackend<sst::bignum, sst::bignum>* backend =
-            manager.makeRAMUnlimited(type, parsers.circuitName, idx_type, ctr);
-
-          interpreter.addType<wtk::firealarm::RAMBuffer<sst::bignum>>(
-              backend, nullptr, nullptr);
 
-          plugins_manager.addBackend((wtk::type_idx) i, backend);
+        if(lanes.size() != 0)
+        {
+          lane_streams.emplace_back(new wtk::firealarm::LaneStream<
+              sst::bignum>(std::move(lanes), std::move(names)));
+          lane_ins[j] = lane_streams.back().get();
         }
-        break;
       }
-      case Precision::uint64:
-      {
-        if(fallback_ram_flag)
-        {
-          wtk::plugins::FallbackRAMBackend<
-            sst::bignum, wtk::firealarm::Wire<uint64_t>>* backend =
-              manager.makeFallbackRAMUint64(type, idx_type);
 
-          interpreter.addType<wtk::plugins::FallbackRAMBuffer<
-            wtk::firealarm::Wire<uint64_t>>>(
-              backend, nullptr, nullptr);
+      interpreter.addType<wtk::firealarm::Wire<uint64_t>>(
+          backend, lane_ins[0], lane_ins[1]);
 
-          plugins_manager.addBackend((wtk::type_idx) i, backend);
-        }
-        else
-        {
-          wtk::firealarm::RAMBackend<sst::bignum, uint64_t>* backend =
-            manager.makeRAMUint64(type, parsers.circuitName, idx_type, ctr);
+      plugins_manager.addBackend((wtk::type_idx) i, backend);
+      continue;
+    }
 
-          interpreter.addType<wtk::firealarm::RAMBuffer<uint64_t>>(
-              backend, nullptr, nullptr);
+    if(type->variety == wtk::circuit::TypeSpec<sst::bignum>::plugin
+        && (type->binding.name == "ram_arith_v0"
+          || type->binding.name == "ram_arith_v1"))
+    {
+      wtk::type_idx idx_type = 0;
+      wtk::wire_idx num_allocs = 0;
+      wtk::wire_idx total_alloc = 0;
+      wtk::wire_idx max_alloc = 0;
 
-          plugins_manager.addBackend((wtk::type_idx) i, backend);
-        }
-        break;
-      }
-      case Precision::uint8:
+      if(type->binding.name == "ram_arith_v0" && !wtk::plugins::checkRAMv0Type(
+            type, &idx_type, &num_allocs, &total_alloc, &max_alloc))
       {
-        if(fallback_ram_flag)
-        {
-          wtk::plugins::FallbackRAMBackend<
-            sst::bignum, wtk::firealarm::Wire<uint8_t>>* backend =
-              manager.makeFallbackRAMUint8(type, idx_type);
-
-          interpreter.addType<wtk::plugins::FallbackRAMBuffer<
-            wtk::firealarm::Wire<uint8_t>>>(
-              backend, nullptr, nullptr);
+        return 1;
+      }
 
-          plugins_manager.addBackend((wtk::type_idx) i, backend);
-        }
-        else
-        {
-          wtk::firealarm::RAMBackend<sst::bignum, uint8_t>* backend =
-            manager.makeRAMUint8(type, parsers.circuitName, idx_type, ctr);
+      // Ring backends share precisions with fields, but RAM requires one.
+      if(manager.typeRefs[(size_t) idx_type].erasedType->type->variety
+          == wtk::circuit::TypeSpec<sst::bignum>::ring)
+      {
+        log_error("Cannot instantiate arithmetic RAM with a ring type");
+        return 1;
+      }
 
-          interpreter.addType<wtk::firealarm::RAMBuffer<uint8_t>>(
-              backend, nullptr, nullptr);
+      counters.emplace_back(nullptr, nullptr, true);
+      wtk::firealarm::TypeCounter* const ctr = &counters.back();
 
-          plugins_manager.addBackend((wtk::type_idx) i, backend);
-        }
-        break;
-      }
-      default:
+      RAMVisitor visitor = { &manager, &interpreter, &plugins_manager, type,
+        (wtk::type_idx) i, idx_type, parsers.circuitName, ctr,
+        fallback_ram_flag };
+      if(!visitPrecision(Wires(),
+            manager.typeRefs[(size_t) idx_type].precision, &visitor))
       {
-        log_error("Cannot use RAM with type %d", (int) idx_type);
         return 1;
       }
-      }
 
       continue;
     }
@@ -919,47 +1757,83 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
         return 1;
       }
     }
-    else if(type->variety != wtk::circuit::TypeSpec<sst::bignum>::field)
+    else if(type->variety == wtk::circuit::TypeSpec<sst::bignum>::plugin)
     {
-      log_error(
-          "FIREALARM currently only supports prime field and RAM types");
+      log_error("FIREALARM currently only supports prime field, ring, "
+          "extension field and RAM types");
       return 1;
     }
 
     counters.emplace_back(&totalCurrentCount, &totalMaximumCount);
 
-    if(type->prime >= UINT32_MAX) // overflows uint64_t during multiply
+    // Extension fields have coefficient arrays of the smallest power of two
+    // at least their degree. Of the plugins, only iter_v0 takes their wires.
+    if(type->variety == wtk::circuit::TypeSpec<sst::bignum>::extField)
     {
-      wtk::firealarm::FieldBackend<sst::bignum, sst::bignum>* backend =
-        manager.makeUnlimited(parsers.circuitName, type, &counters.back());
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+      if(type->prime > UINT64_MAX)
+#else
+      if(type->prime >= UINT32_MAX) // overflows uint64_t during multiply
+#endif//WTK_UTILS_MODULUS_WIDE_64
+      {
+        log_error("Extension field %zu's base field is too large", i);
+        return 1;
+      }
+      else if(type->degree <= 2)
+      {
+        wtk::firealarm::ExtFieldBackend<sst::bignum, 2>* backend =
+          manager.makeExt2(parsers.circuitName, type, &counters.back());
 
-      interpreter.addType<wtk::firealarm::Wire<sst::bignum>>(backend,
-          parsers.circuitStreams[i].publicStream,
-          parsers.circuitStreams[i].privateStream);
+        interpreter.addType<wtk::firealarm::Wire<ext2_t>>(backend,
+            streams[i].publicStream,
+            streams[i].privateStream);
 
-      plugins_manager.addBackend((wtk::type_idx) i, backend);
-    }
-    else if(type->prime >= 16) // overflows uint8_t during multiply
-    {
-      wtk::firealarm::FieldBackend<sst::bignum, uint64_t>* backend =
-        manager.makeUint64(parsers.circuitName, type, &counters.back());
+        plugins_manager.addBackend((wtk::type_idx) i, backend);
+      }
+      else if(type->degree <= 4)
+      {
+        wtk::firealarm::ExtFieldBackend<sst::bignum, 4>* backend =
+          manager.makeExt4(parsers.circuitName, type, &counters.back());
 
-      interpreter.addType<wtk::firealarm::Wire<uint64_t>>(backend,
-          parsers.circuitStreams[i].publicStream,
-          parsers.circuitStreams[i].privateStream);
+        interpreter.addType<wtk::firealarm::Wire<ext4_t>>(backend,
+            streams[i].publicStream,
+            streams[i].privateStream);
 
-      plugins_manager.addBackend((wtk::type_idx) i, backend);
+        plugins_manager.addBackend((wtk::type_idx) i, backend);
+      }
+      else if(type->degree <= 8)
+      {
+        wtk::firealarm::ExtFieldBackend<sst::bignum, 8>* backend =
+          manager.makeExt8(parsers.circuitName, type, &counters.back());
+
+        interpreter.addType<wtk::firealarm::Wire<ext8_t>>(backend,
+            streams[i].publicStream,
+            streams[i].privateStream);
+
+        plugins_manager.addBackend((wtk::type_idx) i, backend);
+      }
+      else
+      {
+        log_error("Extension field %zu's degree (%zu) exceeds 8",
+            i, type->degree);
+        return 1;
+      }
+
+      continue;
     }
-    else
-    {
-      wtk::firealarm::FieldBackend<sst::bignum, uint8_t>* backend =
-        manager.makeUint8(parsers.circuitName, type, &counters.back());
 
-      interpreter.addType<wtk::firealarm::Wire<uint8_t>>(backend,
-          parsers.circuitStreams[i].publicStream,
-          parsers.circuitStreams[i].privateStream);
+    // Fields and rings have the narrowest wire which holds their values.
+    Precision const precision =
+      type->variety == wtk::circuit::TypeSpec<sst::bignum>::ring
+      ? ringPrecision(type->bitWidth)
+      : fieldPrecision(type->prime);
 
-      plugins_manager.addBackend((wtk::type_idx) i, backend);
+    TypeVisitor visitor = { &manager, &interpreter, &plugins_manager, type,
+      (wtk::type_idx) i, parsers.circuitName, &counters.back(),
+      streams[i].publicStream, streams[i].privateStream };
+    if(!visitPrecision(Wires(), precision, &visitor))
+    {
+      return 1;
     }
   }
 
@@ -978,153 +1852,46 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
     wtk::circuit::TypeSpec<sst::bignum> const* in_type =
       &parsers.circuitBodyParser->types[(size_t) spec->inType];
 
-    // Switch on the output type's precision (Wire_T template)
-    switch(manager.typeRefs[(size_t) spec->outType].precision)
-    {
-    case Precision::unlimited:
+    // Visit the output, then input, type's precision (Wire_T template)
+    ConverterVisitor visitor = { &manager, &interpreter, spec,
+      out_type, in_type, manager.typeRefs[(size_t) spec->inType].precision,
+      &counters[(size_t) spec->outType], &conv_counters[i],
+      parsers.circuitName };
+    if(!visitPrecision(Wires(),
+          manager.typeRefs[(size_t) spec->outType].precision, &visitor))
     {
-      // Switch on the intput type's precision (Wire_T template)
-      switch(manager.typeRefs[(size_t) spec->inType].precision)
-      {
-      case Precision::unlimited:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUnlimitedUnlimited.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      case Precision::uint64:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUnlimitedUint64.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      case Precision::uint8:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUnlimitedUint8.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      default:
-      {
-        log_error("Cannot convert from type %d to type %d",
-            (int) spec->inType, (int) spec->outType);
-        return 1;
-      }
-      }
-
-      break;
-    }
-    case Precision::uint64:
-    {
-      // Switch on the intput type's precision (Wire_T template)
-      switch(manager.typeRefs[(size_t) spec->inType].precision)
-      {
-      case Precision::unlimited:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUint64Unlimited.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      case Precision::uint64:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUint64Uint64.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      case Precision::uint8:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUint64Uint8.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      default:
-      {
-        log_error("Cannot convert from type %d to type %d",
-            (int) spec->inType, (int) spec->outType);
-        return 1;
-      }
-      }
-
-      break;
-    }
-    case Precision::uint8:
-    {
-      // Switch on the intput type's precision (Wire_T template)
-      switch(manager.typeRefs[(size_t) spec->inType].precision)
-      {
-      case Precision::unlimited:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUint8Unlimited.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      case Precision::uint64:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUint8Uint64.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      case Precision::uint8:
-      {
-        interpreter.addConversion(
-            spec, manager.convertUint8Uint8.allocate(1,
-              out_type->prime, in_type->prime, spec->outLength,
-              spec->inLength, &counters[(size_t) spec->outType],
-              &conv_counters[i], parsers.circuitName));
-        break;
-      }
-      default:
-      {
-        log_error("Cannot convert from type %d to type %d",
-            (int) spec->inType, (int) spec->outType);
-        return 1;
-      }
-      }
-
-      break;
-    }
-    default:
-    {
-      log_error("Cannot convert from type %d to type %d",
-          (int) spec->inType, (int) spec->outType);
       return 1;
     }
-    }
   }
 
-  // NAILS boilerplate.
-  wtk::nails::GatesFunctionFactory<sst::bignum> func_fact;
+  // NAILS boilerplate. Functions release their prepared constants to the
+  // backends, so the factories must be declared after the manager.
+  wtk::nails::GatesFunctionFactory<sst::bignum> gates_func_fact;
+  wtk::nails::CompiledFunctionFactory<sst::bignum> compiled_func_fact;
+  wtk::nails::FunctionFactory<sst::bignum>* const func_fact = compiled_flag
+    ? (wtk::nails::FunctionFactory<sst::bignum>*) &compiled_func_fact
+    : (wtk::nails::FunctionFactory<sst::bignum>*) &gates_func_fact;
   wtk::nails::Handler<sst::bignum> handler(
-      &interpreter, &func_fact, &plugins_manager);
+      &interpreter, func_fact, &plugins_manager);
 
   bool win = true;
 
   // Parse/stream and check for success criteria
-  if(!parsers.circuitBodyParser->parse(&handler))
+  bool const parsed = recording == nullptr
+    ? parsers.circuitBodyParser->parse(&handler)
+    : recording->replay(&handler);
+
+  if(profiler != nullptr)
+  {
+    profiler->finish();
+    profiler->report();
+    if(!profiler->writeFolded(profile_name)) { win = false; }
+  }
+
+  if(memoizer != nullptr && recording == nullptr) { memoizer->print(); }
+
+  // In parallel mode, wait for the remaining gates, even after a failure.
+  if(!interpreter.synchronize() || !parsed)
   {
     win = false;
   }
@@ -1146,6 +1913,18 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
           break;
         }
         case wtk::circuit::TypeSpec<sst::bignum>::ring:
+        {
+          log_error("failure in ring %zu (bit width %zu)",
+              i, backend->type->bitWidth);
+          break;
+        }
+        case wtk::circuit::TypeSpec<sst::bignum>::extField:
+        {
+          log_error("failure in extension field %zu (degree %zu over prime %s)",
+              i, backend->type->degree,
+              wtk::utils::dec(backend->type->prime).c_str());
+          break;
+        }
         case wtk::circuit::TypeSpec<sst::bignum>::plugin:
         {
           /* TODO */
@@ -1157,9 +1936,55 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
       }
     }
 
+    // Report on each input set, and fail if any did.
+    if(bitslice_flag)
+    {
+      for(size_t k = 0; k < parsers.streamSets.size(); k++)
+      {
+        char const* name = parsers.circuitName;
+        for(size_t i = 0; i < parsers.streamSets[k].size(); i++)
+        {
+          if(parsers.streamSets[k][i].privateName != nullptr)
+          {
+            name = parsers.streamSets[k][i].privateName;
+            break;
+          }
+          else if(parsers.streamSets[k][i].publicName != nullptr)
+          {
+            name = parsers.streamSets[k][i].publicName;
+          }
+        }
+
+        bool lane_win = true;
+        for(size_t i = 0; i < sliced.size() && lane_win; i++)
+        {
+          if(!sliced[i]->checkLane(k))
+          {
+            log_error("input set %zu (%s): assert zero failed at %s:%zu",
+                k, name, parsers.circuitName, sliced[i]->failureLines[k]);
+            lane_win = false;
+          }
+        }
+
+        if(lane_win)
+        {
+          log_info("input set %zu (%s): evaluated successfully", k, name);
+        }
+      }
+    }
+
+    // In batch mode, each pair is reported by batchmain().
+    if(recording != nullptr) { return win ? 0 : 1; }
+
     if(win)
     {
       log_info("Relation evaluated successfully");
+
+      if(certify_name != nullptr
+          && !wtk::utils::writeCertificate(certify_name, parsers.circuitName))
+      {
+        win = false;
+      }
     }
 
     // Add up all the total gate counts
@@ -1178,6 +2003,25 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
           name += ":";
           name += wtk::utils::dec(parsers.circuitBodyParser->types[i].prime);
         }
+        else if(parsers.circuitBodyParser->types[i].variety ==
+            wtk::circuit::TypeSpec<sst::bignum>::ring)
+        {
+          name = "ring ";
+          name += wtk::utils::dec(i);
+          name += ":";
+          name += wtk::utils::dec(
+              parsers.circuitBodyParser->types[i].bitWidth);
+        }
+        else if(parsers.circuitBodyParser->types[i].variety ==
+            wtk::circuit::TypeSpec<sst::bignum>::extField)
+        {
+          name = "extension field ";
+          name += wtk::utils::dec(i);
+          name += ":";
+          name += wtk::utils::dec(parsers.circuitBodyParser->types[i].prime);
+          name += "^";
+          name += wtk::utils::dec(parsers.circuitBodyParser->types[i].degree);
+        }
         else if(parsers.circuitBodyParser->types[i].binding.name
             == "ram_arith_v0")
         {
@@ -1198,6 +2042,69 @@ int submain(wtk::utils::ParserOrganizer<Parser_T, sst::bignum>& parsers)
     total.maximumActive = totalMaximumCount;
     total.print(detail_counts, "totals");
 
+    // print out memory usage, by type and by function
+    log_info("Memory usage (bytes allocated, live, peak)");
+    wtk::utils::MemStats total_wires;
+    wtk::utils::MemStats total_skip_lists;
+    for(size_t i = 0; i < interpreter.interpreters.size(); i++)
+    {
+      wtk::utils::MemStats const* const wires =
+        &interpreter.interpreters[i]->wireStats;
+      wtk::utils::MemStats const* const skip_lists =
+        &interpreter.interpreters[i]->skipListStats;
+
+      if(detail_counts)
+      {
+        log_info("type %zu wires:      %zu, %zu, %zu",
+            i, wires->allocated, wires->live, wires->peak);
+        log_info("type %zu skip lists: %zu, %zu, %zu",
+            i, skip_lists->allocated, skip_lists->live, skip_lists->peak);
+      }
+
+      total_wires.addTotal(wires);
+      total_skip_lists.addTotal(skip_lists);
+    }
+
+    log_info("wires:            %zu, %zu, %zu", total_wires.allocated,
+        total_wires.live, total_wires.peak);
+    log_info("skip lists:       %zu, %zu, %zu", total_skip_lists.allocated,
+        total_skip_lists.live, total_skip_lists.peak);
+
+    wtk::utils::MemStats pools;
+    pools.addTotal(&gates_func_fact.gatesFunctionPool.stats());
+    pools.addTotal(&compiled_func_fact.compiledFunctionPool.stats());
+    pools.addTotal(&handler.pluginPool.stats());
+    log_info("function objects: %zu, %zu, %zu (%zu reserved)",
+        pools.allocated, pools.live, pools.peak,
+        gates_func_fact.gatesFunctionPool.reserved()
+        + compiled_func_fact.compiledFunctionPool.reserved()
+        + handler.pluginPool.reserved());
+
+    std::vector<std::pair<size_t, char const*>> bodies;
+    size_t total_bodies = 0;
+    for(auto iter = interpreter.functions.begin();
+        iter != interpreter.functions.end(); iter++)
+    {
+      bodies.emplace_back(iter->second->bytes(), iter->first);
+      total_bodies += bodies.back().first;
+    }
+
+    log_info("function bodies:  %zu", total_bodies);
+    if(detail_counts)
+    {
+      std::sort(bodies.begin(), bodies.end(),
+          [](std::pair<size_t, char const*> const& a,
+            std::pair<size_t, char const*> const& b)
+          {
+            return a.first > b.first;
+          });
+
+      for(size_t i = 0; i < bodies.size(); i++)
+      {
+        log_info("@function(%s): %zu", bodies[i].second, bodies[i].first);
+      }
+    }
+
     // print out detailed gate counts (per field/per convert)
     if(detail_counts && conv_counters.size() > 0)
     {
@@ -539,8 +539,31 @@ bool CircuitParser<Number_T>::parseCircuitHeader()
     }
     case TypeU_ExtField:
     {
-      log_error("Extension Fields are currently unsupported");
-      return false;
+      ExtField const* const ext =
+        header->types()->Get(i)->element_as_ExtField();
+      NONULL(ext, false);
+
+      if(ext->index() >= this->types.size()
+          || this->types[(size_t) ext->index()].variety
+            != wtk::circuit::TypeSpec<Number_T>::field)
+      {
+        log_error("extension field's base type %zu is not a prior field type",
+            (size_t) ext->index());
+        return false;
+      }
+
+      wtk::circuit::TypeSpec<Number_T> spec((type_idx) ext->index(),
+          (size_t) ext->degree(), Number_T(ext->modulus()),
+          Number_T(this->types[(size_t) ext->index()].prime));
+      if(ext->degree() == 0 || !(spec.modulus < spec.maxValue()))
+      {
+        log_error("extension field of degree %zu has an invalid reduction "
+            "polynomial", (size_t) ext->degree());
+        return false;
+      }
+
+      this->types.emplace_back(std::move(spec));
+      break;
     }
     case TypeU_Ring:
     {
@@ -1169,8 +1192,14 @@ bool PublicInputStream<Number_T>::parseStreamHeader()
   }
   case TypeU_ExtField:
   {
-    log_error("Extension Fields Currently Unsupported");
-    return false;
+    ExtField const* const ext = public_inputs->type()->element_as_ExtField();
+    NONULL(ext, false);
+
+    // The base field's prime is found by matching the relation's types.
+    this->type = std::unique_ptr<wtk::circuit::TypeSpec<Number_T>>(
+        new wtk::circuit::TypeSpec<Number_T>((type_idx) ext->index(),
+          (size_t) ext->degree(), Number_T(ext->modulus())));
+    break;
   }
   case TypeU_Ring:
   {
@@ -1270,8 +1299,14 @@ bool PrivateInputStream<Number_T>::parseStreamHeader()
   }
   case TypeU_ExtField:
   {
-    log_error("Extension Fields Currently Unsupported");
-    return false;
+    ExtField const* const ext = private_inputs->type()->element_as_ExtField();
+    NONULL(ext, false);
+
+    // The base field's prime is found by matching the relation's types.
+    this->type = std::unique_ptr<wtk::circuit::TypeSpec<Number_T>>(
+        new wtk::circuit::TypeSpec<Number_T>((type_idx) ext->index(),
+          (size_t) ext->degree(), Number_T(ext->modulus())));
+    break;
   }
   case TypeU_Ring:
   {
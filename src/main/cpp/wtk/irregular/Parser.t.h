@@ -260,6 +260,45 @@ bool CircuitParser<Number_T>::parseCircuitHeader()
 
       break;
     }
+    case FieldOrRingOrPlugin::ext_field:
+    {
+      type_idx base_field = 0;
+      size_t degree = 0;
+      Number_T modulus = 0;
+      if(ULK(ULK(ULK(ULK(ULK(ULK(ULK(ULK(!whitespace(this->ctx))
+          || ULK(!number(this->ctx, &base_field)))
+          || ULK(!whitespace(this->ctx))) || ULK(!number(this->ctx, &degree)))
+          || ULK(!whitespace(this->ctx))) || ULK(!number(this->ctx, &modulus)))
+          || ULK(!whitespace(this->ctx))) || ULK(!semiColonOp(this->ctx))))
+      {
+        return false;
+      }
+
+      if(ULK(base_field >= this->types.size()
+          || this->types[(size_t) base_field].variety
+            != wtk::circuit::TypeSpec<Number_T>::field))
+      {
+        log_error("%s:%zu: extension field's base type %zu is not a prior "
+            "field type", this->ctx->name, this->ctx->lineNum,
+            (size_t) base_field);
+        return false;
+      }
+
+      Number_T prime(this->types[(size_t) base_field].prime);
+      wtk::circuit::TypeSpec<Number_T> ext(
+          base_field, degree, std::move(modulus), std::move(prime));
+      if(ULK(degree == 0 || !(ext.modulus < ext.maxValue())))
+      {
+        log_error("%s:%zu: extension field of degree %zu has an invalid "
+            "reduction polynomial", this->ctx->name, this->ctx->lineNum,
+            degree);
+        return false;
+      }
+
+      this->types.emplace_back(std::move(ext));
+
+      break;
+    }
     case FieldOrRingOrPlugin::plugin:
     {
       wtk::circuit::PluginBinding<Number_T> binding;
@@ -384,6 +423,27 @@ bool InputStream<Number_T>::parseStreamHeader()
         new wtk::circuit::TypeSpec<Number_T>(bit_width));
     break;
   }
+  case FieldOrRingKws::ext_field:
+  {
+    type_idx base_field = 0;
+    size_t degree = 0;
+    Number_T modulus = 0;
+    if(!whitespace(this->ctx) || !number(this->ctx, &base_field)
+        || !whitespace(this->ctx) || !number(this->ctx, &degree)
+        || !whitespace(this->ctx) || !number(this->ctx, &modulus)
+        || !whitespace(this->ctx) || !semiColonOp(this->ctx)
+        || !whitespace(this->ctx) || !beginKw(this->ctx)
+        || !whitespace(this->ctx))
+    {
+      return false;
+    }
+
+    // The base field's prime is found by matching the relation's types.
+    this->type = std::unique_ptr<wtk::circuit::TypeSpec<Number_T>>(
+        new wtk::circuit::TypeSpec<Number_T>(
+          base_field, degree, std::move(modulus)));
+    break;
+  }
   }
 
   return true;
@@ -0,0 +1,131 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_NAILS_COMPILED_FUNCTION_H_
+#define WTK_NAILS_COMPILED_FUNCTION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+#include <utility>
+
+#include <wtk/indexes.h>
+#include <wtk/utils/Pool.h>
+#include <wtk/utils/SkipList.h>
+
+#include <wtk/circuit/Data.h>
+
+#include <wtk/nails/Functions.h>
+#include <wtk/nails/Interpreter.h>
+
+namespace wtk {
+namespace nails {
+
+/**
+ * The CompiledFunction is an alternative to the GatesFunction, similar to
+ * the BOLT engine of the IR v1 toolkit.
+ *
+ * It records gates just as the GatesFunction does. After a successful
+ * typeCheck() the gates are rewritten to address wires by frame slot (see
+ * FRAME_SEGMENT_SHIFT) rather than by wire index. Each type's local wires
+ * are a flat array, allocated once and reused by each invocation, while
+ * parameters are aliased from the caller's scope at the call boundary.
+ * Replay indexes the frame directly, skipping the Scope's range lookups and
+ * SkipList bookkeeping.
+ *
+ * Multi-wire copies and inputs are expanded to single-wire gates, and
+ * @new directives are dropped. Runs of independent add, mul, addc, mulc and
+ * assert_zero gates are batched for the TypeBackend's batch callbacks.
+ * Per-gate detail traces are not produced within a compiled function.
+ *
+ * If compilation isn't possible (e.g. the function deletes a parameter, or
+ * doesn't assign all its outputs, which are runtime errors) then the
+ * function falls back to GatesFunction evaluation.
+ *
+ * Because functions must be defined before they are called, a function is
+ * never reentered, and its frame may be reused without a stack. For the same
+ * reason a compiled function is not thread-safe (see Function::threadSafe()).
+ */
+template<typename Number_T>
+struct CompiledFunction : public GatesFunction<Number_T>
+{
+  // Indicates if compilation was successful.
+  bool compiled = false;
+
+  // The frame of a single type.
+  struct TypeFrame
+  {
+    // Segment base pointers, locals first and then each parameter.
+    std::vector<void*> frame;
+
+    // Total length of output parameters (remapped as $0 ... $n - 1).
+    wire_idx outputsLength = 0;
+
+    // Locals which remain active at the end of the function, to be
+    // destroyed, as a slot and a length.
+    std::vector<std::pair<wire_idx, wire_idx>> live;
+  };
+
+  std::vector<TypeFrame> frames;
+
+  // Per-type output cursors for checking a callee's outputs.
+  std::vector<wire_idx> places;
+
+  CompiledFunction(wtk::circuit::FunctionSignature&& sig)
+    : GatesFunction<Number_T>(std::move(sig)) { }
+
+  bool typeCheck(Interpreter<Number_T> const* const interpreter) override;
+
+  bool evaluate(Interpreter<Number_T>* const interpreter) override;
+
+  // Includes the frames, but not the local wires which they point to.
+  size_t bytes() const override;
+
+  // The frame is shared by all invocations, so a compiled function cannot
+  // be evaluated concurrently.
+  bool threadSafe() const override
+  {
+    return !this->compiled && this->GatesFunction<Number_T>::threadSafe();
+  }
+
+  // Rewrite the gates for frame evaluation, or return false to fall back.
+  bool compile(Interpreter<Number_T> const* const interpreter);
+
+  // Invoke another function from within the frame.
+  bool invokeFrame(Interpreter<Number_T>* const interpreter,
+      wtk::circuit::FunctionCall const* const call,
+      Function<Number_T>* const function, size_t const line_num);
+
+  ~CompiledFunction();
+};
+
+/**
+ * The factory for compiled functions. Use in place of the
+ * GatesFunctionFactory.
+ */
+template<typename Number_T>
+struct CompiledFunctionFactory : public FunctionFactory<Number_T>
+{
+  wtk::utils::Pool<CompiledFunction<Number_T>> compiledFunctionPool;
+
+  RegularFunction<Number_T>* createFunction(
+      wtk::circuit::FunctionSignature&& sig) override;
+
+  virtual ~CompiledFunctionFactory() = default;
+};
+
+} } // namespace wtk::nails
+
+#define LOG_IDENTIFIER "wtk::nails"
+#include <stealth_logging.h>
+
+#include <wtk/nails/CompiledFunction.t.h>
+
+#define LOG_UNINCLUDE
+#include <stealth_logging.h>
+
+#endif//WTK_NAILS_COMPILED_FUNCTION_H_
@@ -0,0 +1,839 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+namespace wtk {
+namespace nails {
+
+template<typename Number_T>
+bool CompiledFunction<Number_T>::typeCheck(
+    Interpreter<Number_T> const* const interpreter)
+{
+  if(UNLIKELY(!this->checkGates(interpreter))) { return false; }
+
+  this->compiled = this->compile(interpreter);
+  if(!this->compiled)
+  {
+    log_debug("%s:%zu: function \'%s\' was not compiled",
+        interpreter->fileName, this->signature.lineNum,
+        this->signature.name.c_str());
+  }
+
+  this->batch();
+  return true;
+}
+
+template<typename Number_T>
+bool CompiledFunction<Number_T>::compile(
+    Interpreter<Number_T> const* const interpreter)
+{
+  size_t const num_types = interpreter->interpreters.size();
+
+  // A segment is a range of wire indices with contiguous slots.
+  struct Segment
+  {
+    wire_idx first;
+    wire_idx last;
+    wire_idx slot;
+
+    Segment(wire_idx const f, wire_idx const l, wire_idx const s)
+      : first(f), last(l), slot(s) { }
+  };
+
+  std::vector<std::vector<Segment>> segments(num_types);
+  std::vector<TypeFrame> new_frames(num_types);
+  std::vector<size_t> num_params(num_types, 0);
+  std::vector<wire_idx> first_locals(num_types, 0);
+  std::vector<wire_idx> locals_lengths(num_types, 0);
+
+  auto addParameter = [&](size_t const type, size_t const length) -> bool
+    {
+      if(num_params[type] + 1 >= FRAME_MAX_SEGMENTS
+          || length - 1 > FRAME_OFFSET_MASK)
+      {
+        return false;
+      }
+
+      wire_idx const first = first_locals[type];
+      segments[type].emplace_back(first, first + length - 1,
+          frameSlot(1 + num_params[type], 0));
+      num_params[type]++;
+      first_locals[type] += length;
+      return true;
+    };
+
+  for(size_t i = 0; i < this->signature.outputs.size(); i++)
+  {
+    size_t const type = (size_t) this->signature.outputs[i].type;
+    size_t const length = this->signature.outputs[i].length;
+    if(!addParameter(type, length)) { return false; }
+    new_frames[type].outputsLength += length;
+  }
+
+  for(size_t i = 0; i < this->signature.inputs.size(); i++)
+  {
+    size_t const type = (size_t) this->signature.inputs[i].type;
+    size_t const length = this->signature.inputs[i].length;
+    if(!addParameter(type, length)) { return false; }
+  }
+
+  // Gather the ranges of local wires used by the function
+  std::vector<std::vector<std::pair<wire_idx, wire_idx>>> uses(num_types);
+  bool straddles = false;
+
+  auto use = [&](size_t const type, wire_idx const first, wire_idx const last)
+    {
+      if(first >= first_locals[type]) { uses[type].emplace_back(first, last); }
+      else if(last >= first_locals[type]) { straddles = true; }
+    };
+
+  for(size_t i = 0; i < this->gates.size(); i++)
+  {
+    GateTag const* const tag = &this->tags[i];
+    Gate const* const gate = &this->gates[i];
+    size_t const type = (size_t) tag->type;
+
+    switch(tag->operation)
+    {
+    case GateTag::add: /* fallthrough */
+    case GateTag::mul:
+    {
+      use(type, gate->out, gate->out);
+      use(type, gate->left, gate->left);
+      use(type, gate->right, gate->right);
+      break;
+    }
+    case GateTag::copy:  /* fallthrough */
+    case GateTag::addc: /* fallthrough */
+    case GateTag::mulc:
+    {
+      use(type, gate->out, gate->out);
+      use(type, gate->left, gate->left);
+      break;
+    }
+    case GateTag::assertZero:
+    {
+      use(type, gate->left, gate->left);
+      break;
+    }
+    case GateTag::publicIn:  /* fallthrough */
+    case GateTag::privateIn: /* fallthrough */
+    case GateTag::assign:
+    {
+      use(type, gate->out, gate->out);
+      break;
+    }
+    case GateTag::convert_:
+    {
+      ConvertGate const* const convert =
+        &this->converts[(size_t) gate->right];
+
+      use((size_t) convert->outType, convert->firstOut, convert->lastOut);
+      use((size_t) convert->inType, convert->firstIn, convert->lastIn);
+      break;
+    }
+    case GateTag::newRange:
+    {
+      break;
+    }
+    case GateTag::deleteRange:    /* fallthrough */
+    case GateTag::publicInMulti: /* fallthrough */
+    case GateTag::privateInMulti:
+    {
+      use(type, gate->out, gate->left);
+      break;
+    }
+    case GateTag::call_:
+    {
+      wtk::circuit::FunctionCall const* const call =
+        &this->calls[(size_t) gate->right];
+      wtk::circuit::FunctionSignature const* const signature =
+        &this->callees[(size_t) gate->right]->signature;
+
+      for(size_t j = 0; j < call->outputs.size(); j++)
+      {
+        use((size_t) signature->outputs[j].type,
+            call->outputs[j].first, call->outputs[j].last);
+      }
+
+      for(size_t j = 0; j < call->inputs.size(); j++)
+      {
+        use((size_t) signature->inputs[j].type,
+            call->inputs[j].first, call->inputs[j].last);
+      }
+
+      break;
+    }
+    case GateTag::copyMulti:
+    {
+      wtk::circuit::CopyMulti const* const multi =
+        &this->copyMultis[(size_t) gate->right];
+
+      use((size_t) multi->type, multi->outputs.first, multi->outputs.last);
+      for(size_t j = 0; j < multi->inputs.size(); j++)
+      {
+        use((size_t) multi->type,
+            multi->inputs[j].first, multi->inputs[j].last);
+      }
+
+      break;
+    }
+    case GateTag::uninitialized:   /* fallthrough */
+    case GateTag::addBatch:        /* fallthrough */
+    case GateTag::mulBatch:        /* fallthrough */
+    case GateTag::addcBatch:       /* fallthrough */
+    case GateTag::mulcBatch:       /* fallthrough */
+    case GateTag::assertZeroBatch:
+    {
+      log_assert(false, "uninitialized gate");
+      return false;
+    }
+    }
+  }
+
+  if(straddles) { return false; }
+
+  // Merge the local uses into segments of contiguous slots.
+  for(size_t t = 0; t < num_types; t++)
+  {
+    std::sort(uses[t].begin(), uses[t].end());
+
+    wire_idx base = 0;
+    size_t i = 0;
+    while(i < uses[t].size())
+    {
+      wire_idx const first = uses[t][i].first;
+      wire_idx last = uses[t][i].second;
+      i++;
+
+      while(i < uses[t].size() && (uses[t][i].first <= last
+            || (last != UINT64_MAX && uses[t][i].first == last + 1)))
+      {
+        if(uses[t][i].second > last) { last = uses[t][i].second; }
+        i++;
+      }
+
+      if(last - first >= FRAME_OFFSET_MASK - base) { return false; }
+
+      segments[t].emplace_back(first, last, frameSlot(0, base));
+      base += 1 + last - first;
+    }
+
+    if(!canConvertWireIdxToSize(base)) { return false; }
+    locals_lengths[t] = base;
+  }
+
+  auto toSlot = [&segments](size_t const type, wire_idx const first,
+      wire_idx const last, wire_idx* const slot) -> bool
+    {
+      std::vector<Segment> const& segs = segments[type];
+
+      size_t l = 0;
+      size_t h = segs.size();
+      while(l < h)
+      {
+        size_t const mid = l + (h - l) / 2;
+        if(segs[mid].first <= first) { l = mid + 1; }
+        else { h = mid; }
+      }
+
+      if(l == 0 || last > segs[l - 1].last) { return false; }
+
+      *slot = segs[l - 1].slot + (first - segs[l - 1].first);
+      return true;
+    };
+
+  // Rewrite the gates to use slots
+  std::vector<GateTag> new_tags;
+  std::vector<Gate> new_gates;
+  std::vector<ConvertGate> new_converts;
+  std::vector<Converter<Number_T>*> new_converters;
+  std::vector<wtk::circuit::FunctionCall> new_calls;
+  std::vector<Function<Number_T>*> new_callees;
+  std::vector<typename GatesFunction<Number_T>::LineRun> new_line_runs;
+
+  std::vector<wtk::utils::SkipList<wire_idx>> outputs_assigned(num_types);
+  std::vector<wtk::utils::SkipList<wire_idx>> live(num_types);
+
+  size_t line_num = 0;
+  size_t next_run = 0;
+
+  auto emit = [&](GateTag::Operation const op, type_idx const type,
+      wire_idx const out, wire_idx const left, wire_idx const right)
+    {
+      if(new_line_runs.size() == 0 || new_line_runs.back().lineNum != line_num)
+      {
+        new_line_runs.emplace_back(new_gates.size(), line_num);
+      }
+
+      new_tags.emplace_back(op, type);
+      new_gates.emplace_back(out, left, right);
+    };
+
+  auto assignRange = [&](size_t const type,
+      wire_idx const first, wire_idx const last)
+    {
+      if(first < new_frames[type].outputsLength)
+      {
+        outputs_assigned[type].insert(first, last);
+      }
+      else if(first >= first_locals[type])
+      {
+        live[type].insert(first, last);
+      }
+    };
+
+  for(size_t i = 0; i < this->gates.size(); i++)
+  {
+    if(next_run < this->lineRuns.size() && this->lineRuns[next_run].first == i)
+    {
+      line_num = this->lineRuns[next_run].lineNum;
+      next_run++;
+    }
+
+    GateTag const* const tag = &this->tags[i];
+    Gate const* const gate = &this->gates[i];
+    size_t const type = (size_t) tag->type;
+
+    wire_idx out = 0;
+    wire_idx left = 0;
+    wire_idx right = 0;
+
+    switch(tag->operation)
+    {
+    case GateTag::add: /* fallthrough */
+    case GateTag::mul:
+    {
+      if(!toSlot(type, gate->out, gate->out, &out)
+          || !toSlot(type, gate->left, gate->left, &left)
+          || !toSlot(type, gate->right, gate->right, &right))
+      {
+        return false;
+      }
+
+      emit(tag->operation, tag->type, out, left, right);
+      assignRange(type, gate->out, gate->out);
+      break;
+    }
+    case GateTag::copy: /* fallthrough */
+    case GateTag::addc: /* fallthrough */
+    case GateTag::mulc:
+    {
+      if(!toSlot(type, gate->out, gate->out, &out)
+          || !toSlot(type, gate->left, gate->left, &left))
+      {
+        return false;
+      }
+
+      emit(tag->operation, tag->type, out, left, gate->right);
+      assignRange(type, gate->out, gate->out);
+      break;
+    }
+    case GateTag::assertZero:
+    {
+      if(!toSlot(type, gate->left, gate->left, &left)) { return false; }
+
+      emit(tag->operation, tag->type, 0, left, 0);
+      break;
+    }
+    case GateTag::publicIn:  /* fallthrough */
+    case GateTag::privateIn: /* fallthrough */
+    case GateTag::assign:
+    {
+      if(!toSlot(type, gate->out, gate->out, &out)) { return false; }
+
+      emit(tag->operation, tag->type, out, 0, gate->right);
+      assignRange(type, gate->out, gate->out);
+      break;
+    }
+    case GateTag::convert_:
+    {
+      ConvertGate const* const convert =
+        &this->converts[(size_t) gate->right];
+
+      if(!toSlot((size_t) convert->outType,
+            convert->firstOut, convert->lastOut, &out)
+          || !toSlot((size_t) convert->inType,
+            convert->firstIn, convert->lastIn, &left))
+      {
+        return false;
+      }
+
+      emit(GateTag::convert_, convert->outType, 0, 0, new_converts.size());
+      new_converts.emplace_back(
+          out, out + (convert->lastOut - convert->firstOut), convert->outType,
+          left, left + (convert->lastIn - convert->firstIn), convert->inType,
+          convert->modulus);
+      new_converters.push_back(this->converters[(size_t) gate->right]);
+      assignRange(
+          (size_t) convert->outType, convert->firstOut, convert->lastOut);
+      break;
+    }
+    case GateTag::newRange:
+    {
+      // Frame memory is already allocated
+      break;
+    }
+    case GateTag::deleteRange:
+    {
+      if(gate->out < first_locals[type]
+          || !toSlot(type, gate->out, gate->left, &out))
+      {
+        return false;
+      }
+
+      emit(GateTag::deleteRange, tag->type,
+          out, out + (gate->left - gate->out), 0);
+      live[type].remove(gate->out, gate->left);
+      break;
+    }
+    case GateTag::call_:
+    {
+      wtk::circuit::FunctionCall const* const call =
+        &this->calls[(size_t) gate->right];
+      Function<Number_T>* const callee = this->callees[(size_t) gate->right];
+
+      wtk::circuit::FunctionCall new_call;
+      new_call.name = call->name;
+      new_call.lineNum = call->lineNum;
+
+      for(size_t j = 0; j < call->outputs.size(); j++)
+      {
+        size_t const out_type = (size_t) callee->signature.outputs[j].type;
+        wire_idx const first = call->outputs[j].first;
+        wire_idx const last = call->outputs[j].last;
+        if(!toSlot(out_type, first, last, &out)) { return false; }
+
+        new_call.outputs.emplace_back(out, out + (last - first));
+        assignRange(out_type, first, last);
+      }
+
+      for(size_t j = 0; j < call->inputs.size(); j++)
+      {
+        size_t const in_type = (size_t) callee->signature.inputs[j].type;
+        wire_idx const first = call->inputs[j].first;
+        wire_idx const last = call->inputs[j].last;
+        if(!toSlot(in_type, first, last, &left)) { return false; }
+
+        new_call.inputs.emplace_back(left, left + (last - first));
+      }
+
+      emit(GateTag::call_, 0, 0, 0, new_calls.size());
+      new_calls.emplace_back(std::move(new_call));
+      new_callees.push_back(callee);
+      break;
+    }
+    case GateTag::copyMulti:
+    {
+      wtk::circuit::CopyMulti const* const multi =
+        &this->copyMultis[(size_t) gate->right];
+
+      size_t const multi_type = (size_t) multi->type;
+      if(!toSlot(multi_type,
+            multi->outputs.first, multi->outputs.last, &out))
+      {
+        return false;
+      }
+
+      for(size_t j = 0; j < multi->inputs.size(); j++)
+      {
+        wire_idx const first = multi->inputs[j].first;
+        wire_idx const last = multi->inputs[j].last;
+        if(!toSlot(multi_type, first, last, &left)) { return false; }
+
+        for(wire_idx k = 0; k <= last - first; k++)
+        {
+          emit(GateTag::copy, multi->type, out + k, left + k, 0);
+        }
+
+        out += 1 + last - first;
+      }
+
+      assignRange(multi_type, multi->outputs.first, multi->outputs.last);
+      break;
+    }
+    case GateTag::publicInMulti: /* fallthrough */
+    case GateTag::privateInMulti:
+    {
+      if(!toSlot(type, gate->out, gate->left, &out)) { return false; }
+
+      GateTag::Operation const op = tag->operation == GateTag::publicInMulti
+        ? GateTag::publicIn : GateTag::privateIn;
+      for(wire_idx k = 0; k <= gate->left - gate->out; k++)
+      {
+        emit(op, tag->type, out + k, 0, 0);
+      }
+
+      assignRange(type, gate->out, gate->left);
+      break;
+    }
+    case GateTag::uninitialized:   /* fallthrough */
+    case GateTag::addBatch:        /* fallthrough */
+    case GateTag::mulBatch:        /* fallthrough */
+    case GateTag::addcBatch:       /* fallthrough */
+    case GateTag::mulcBatch:       /* fallthrough */
+    case GateTag::assertZeroBatch:
+    {
+      log_assert(false, "uninitialized gate");
+      return false;
+    }
+    }
+  }
+
+  // Outputs which aren't assigned are a runtime error, left to the fallback.
+  for(size_t t = 0; t < num_types; t++)
+  {
+    if(new_frames[t].outputsLength > 0 && !outputs_assigned[t].hasAll(
+          0, new_frames[t].outputsLength - 1))
+    {
+      return false;
+    }
+
+    bool found = true;
+    live[t].forEach([&](wire_idx const first, wire_idx const last)
+        {
+          wire_idx slot = 0;
+          found = toSlot(t, first, last, &slot) && found;
+          new_frames[t].live.emplace_back(slot, 1 + last - first);
+        });
+    log_assert(found); (void) found;
+  }
+
+  // Allocate the frames
+  for(size_t t = 0; t < num_types; t++)
+  {
+    new_frames[t].frame.resize(1 + num_params[t], nullptr);
+
+    if(locals_lengths[t] > 0)
+    {
+      new_frames[t].frame[0] = interpreter->interpreters[t]->allocateFrame(
+          (size_t) locals_lengths[t]);
+
+      if(new_frames[t].frame[0] == nullptr)
+      {
+        for(size_t u = 0; u < t; u++) { free(new_frames[u].frame[0]); }
+        return false;
+      }
+    }
+  }
+
+  this->tags = std::move(new_tags);
+  this->gates = std::move(new_gates);
+  this->converts = std::move(new_converts);
+  this->converters = std::move(new_converters);
+  this->calls = std::move(new_calls);
+  this->callees = std::move(new_callees);
+  this->lineRuns = std::move(new_line_runs);
+  std::vector<wtk::circuit::CopyMulti>().swap(this->copyMultis);
+  this->frames = std::move(new_frames);
+  this->places.resize(num_types, 0);
+
+  return true;
+}
+
+template<typename Number_T>
+size_t CompiledFunction<Number_T>::bytes() const
+{
+  size_t ret = this->GatesFunction<Number_T>::bytes()
+    + this->frames.capacity() * sizeof(TypeFrame)
+    + this->places.capacity() * sizeof(wire_idx);
+
+  for(size_t i = 0; i < this->frames.size(); i++)
+  {
+    ret += this->frames[i].frame.capacity() * sizeof(void*)
+      + this->frames[i].live.capacity()
+        * sizeof(std::pair<wire_idx, wire_idx>);
+  }
+
+  return ret;
+}
+
+template<typename Number_T>
+bool CompiledFunction<Number_T>::evaluate(
+    Interpreter<Number_T>* const interpreter)
+{
+  if(UNLIKELY(!this->compiled))
+  {
+    return this->GatesFunction<Number_T>::evaluate(interpreter);
+  }
+
+  ProfileGuard guard(interpreter->profiler, this, this->signature.name.c_str());
+  guard.gates = this->gates.size() - this->batches;
+
+  // Alias the parameters from the caller.
+  for(size_t t = 0; t < this->frames.size(); t++)
+  {
+    for(size_t j = 1; j < this->frames[t].frame.size(); j++)
+    {
+      this->frames[t].frame[j] =
+        interpreter->interpreters[t]->frameParameter(j - 1);
+    }
+  }
+
+  size_t line_num = 0;
+  size_t next_run = 0;
+
+  for(size_t i = 0; i < this->gates.size(); i++)
+  {
+    // Batches skip over line runs, so the cursor may need to catch up.
+    while(next_run < this->lineRuns.size()
+        && this->lineRuns[next_run].first <= i)
+    {
+      line_num = this->lineRuns[next_run].lineNum;
+      next_run++;
+    }
+
+    GateTag const* const tag = &this->tags[i];
+    Gate const* const gate = &this->gates[i];
+    interpreter->lineNum = line_num;
+
+    TypeInterpreter<Number_T>* const type_interpreter =
+      interpreter->interpreters[(size_t) tag->type].get();
+    void* const* const frame = this->frames[(size_t) tag->type].frame.data();
+    type_interpreter->lineNum = line_num;
+
+    switch(tag->operation)
+    {
+    case GateTag::add:
+    {
+      type_interpreter->frameAddGate(frame, gate->out, gate->left, gate->right);
+      break;
+    }
+    case GateTag::mul:
+    {
+      type_interpreter->frameMulGate(frame, gate->out, gate->left, gate->right);
+      break;
+    }
+    case GateTag::copy:
+    {
+      type_interpreter->frameCopy(frame, gate->out, gate->left);
+      break;
+    }
+    case GateTag::assertZero:
+    {
+      type_interpreter->frameAssertZero(frame, gate->left);
+      break;
+    }
+    case GateTag::publicIn:
+    {
+      if(UNLIKELY(!type_interpreter->framePublicIn(frame, gate->out)))
+      {
+        return false;
+      }
+      break;
+    }
+    case GateTag::privateIn:
+    {
+      if(UNLIKELY(!type_interpreter->framePrivateIn(frame, gate->out)))
+      {
+        return false;
+      }
+      break;
+    }
+    case GateTag::addc:
+    {
+      type_interpreter->frameAddcGate(frame, gate->out, gate->left,
+          this->prepared[(size_t) gate->right]);
+      break;
+    }
+    case GateTag::mulc:
+    {
+      type_interpreter->frameMulcGate(frame, gate->out, gate->left,
+          this->prepared[(size_t) gate->right]);
+      break;
+    }
+    case GateTag::assign:
+    {
+      type_interpreter->frameAssign(
+          frame, gate->out, this->prepared[(size_t) gate->right]);
+      break;
+    }
+    case GateTag::convert_:
+    {
+      ConvertGate const* const convert =
+        &this->converts[(size_t) gate->right];
+      Converter<Number_T>* const converter =
+        this->converters[(size_t) gate->right];
+
+      size_t const out_type = (size_t) convert->outType;
+      size_t const in_type = (size_t) convert->inType;
+
+      converter->lineNum = line_num;
+      converter->convertFrame(
+          interpreter->interpreters[out_type]->frameWires(
+            this->frames[out_type].frame.data(), convert->firstOut),
+          interpreter->interpreters[in_type]->frameWires(
+            this->frames[in_type].frame.data(), convert->firstIn),
+          convert->modulus);
+      break;
+    }
+    case GateTag::deleteRange:
+    {
+      type_interpreter->frameDestroy(
+          frame, gate->out, 1 + gate->left - gate->out);
+      break;
+    }
+    case GateTag::call_:
+    {
+      if(UNLIKELY(!this->invokeFrame(interpreter,
+              &this->calls[(size_t) gate->right],
+              this->callees[(size_t) gate->right], line_num)))
+      {
+        return false;
+      }
+      break;
+    }
+    case GateTag::addBatch:
+    {
+      type_interpreter->frameAddGates(frame, gate + 1, (size_t) gate->out);
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::mulBatch:
+    {
+      type_interpreter->frameMulGates(frame, gate + 1, (size_t) gate->out);
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::addcBatch:
+    {
+      type_interpreter->frameAddcGates(frame, gate + 1, (size_t) gate->out,
+          this->prepared.data());
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::mulcBatch:
+    {
+      type_interpreter->frameMulcGates(frame, gate + 1, (size_t) gate->out,
+          this->prepared.data());
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::assertZeroBatch:
+    {
+      type_interpreter->frameAssertZeros(
+          frame, gate + 1, (size_t) gate->out);
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::uninitialized: /* fallthrough */
+    case GateTag::newRange:      /* fallthrough */
+    case GateTag::copyMulti:     /* fallthrough */
+    case GateTag::publicInMulti: /* fallthrough */
+    case GateTag::privateInMulti:
+    {
+      log_assert(false, "gate is not compiled");
+      return false;
+    }
+    }
+  }
+
+  for(size_t t = 0; t < this->frames.size(); t++)
+  {
+    TypeInterpreter<Number_T>* const type_interpreter =
+      interpreter->interpreters[t].get();
+    TypeFrame const* const type_frame = &this->frames[t];
+
+    type_interpreter->frameAssigned(type_frame->outputsLength);
+
+    for(size_t j = 0; j < type_frame->live.size(); j++)
+    {
+      type_interpreter->frameDestroy(type_frame->frame.data(),
+          type_frame->live[j].first, type_frame->live[j].second);
+    }
+  }
+
+  return true;
+}
+
+template<typename Number_T>
+bool CompiledFunction<Number_T>::invokeFrame(
+    Interpreter<Number_T>* const interpreter,
+    wtk::circuit::FunctionCall const* const call,
+    Function<Number_T>* const function, size_t const line_num)
+{
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(interpreter->trace)
+  {
+    log_info("    %s:%zu: %s@call(%s)", interpreter->fileName, line_num,
+        interpreter->indent.get(), call->name.c_str());
+    interpreter->indent.inc();
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+  interpreter->lineNum = line_num;
+  interpreter->pushScopes(function);
+  std::fill(this->places.begin(), this->places.end(), 0);
+
+  for(size_t i = 0; i < call->outputs.size(); i++)
+  {
+    size_t const type = (size_t) function->signature.outputs[i].type;
+    TypeInterpreter<Number_T>* const type_interpreter =
+      interpreter->interpreters[type].get();
+
+    type_interpreter->mapFrameOutput(type_interpreter->frameWires(
+          this->frames[type].frame.data(), call->outputs[i].first),
+        function->signature.outputs[i].length);
+  }
+
+  for(size_t i = 0; i < call->inputs.size(); i++)
+  {
+    size_t const type = (size_t) function->signature.inputs[i].type;
+    TypeInterpreter<Number_T>* const type_interpreter =
+      interpreter->interpreters[type].get();
+
+    type_interpreter->mapFrameInput(type_interpreter->frameWires(
+          this->frames[type].frame.data(), call->inputs[i].first),
+        function->signature.inputs[i].length);
+  }
+
+  bool ret = true;
+  if(UNLIKELY(!function->evaluate(interpreter)))
+  {
+    ret = false;
+  }
+
+  for(size_t i = 0; i < call->outputs.size(); i++)
+  {
+    size_t const type = (size_t) function->signature.outputs[i].type;
+
+    interpreter->interpreters[type]->lineNum = line_num;
+    if(UNLIKELY(!interpreter->interpreters[type]->checkFrameOutput(
+        function->signature.outputs[i].length, &this->places[type])))
+    {
+      ret = false;
+    }
+  }
+
+  interpreter->popScopes(function);
+  interpreter->lineNum = line_num;
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(interpreter->trace)
+  {
+    interpreter->indent.dec();
+    log_info("    %s:%zu: %s@end (%s)", interpreter->fileName, line_num,
+        interpreter->indent.get(), call->name.c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+  return ret;
+}
+
+template<typename Number_T>
+CompiledFunction<Number_T>::~CompiledFunction()
+{
+  for(size_t t = 0; t < this->frames.size(); t++)
+  {
+    free(this->frames[t].frame[0]);
+  }
+}
+
+template<typename Number_T>
+RegularFunction<Number_T>* CompiledFunctionFactory<Number_T>::createFunction(
+    wtk::circuit::FunctionSignature&& sig)
+{
+  return this->compiledFunctionPool.allocate(1, std::move(sig));
+}
+
+} } // namespace wtk::nails
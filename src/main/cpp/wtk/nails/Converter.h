@@ -42,6 +42,11 @@ public:
       wire_idx const first_in, wire_idx const last_in,
       TypeInterpreter<Number_T>* const interpreter_in, bool modulus) = 0;
 
+  // Callback for convert gates within a compiled function's frame. The
+  // ranges' lengths were checked by the function's typeCheck().
+  virtual void convertFrame(
+      void* const out_wires, void const* const in_wires, bool modulus) = 0;
+
   virtual ~Converter() = default;
 };
 
@@ -68,6 +73,9 @@ public:
       wire_idx const first_in, wire_idx const last_in,
       TypeInterpreter<Number_T>* const interpreter_in, bool modulus) final;
 
+  void convertFrame(
+      void* const out_wires, void const* const in_wires, bool modulus) final;
+
   ~LeadConverter() = default;
 };
 
@@ -13,11 +13,9 @@ bool LeadConverter<Number_T, OutWire_T, InWire_T>::convert(
     TypeInterpreter<Number_T>* const interpreter_in, bool modulus)
 {
   Scope<OutWire_T>* const out_scope =
-    static_cast<LeadTypeInterpreter<Number_T, OutWire_T>* const>(
-        interpreter_out)->top();
+    static_cast<Scope<OutWire_T>*>(interpreter_out->topScope());
   Scope<InWire_T>* const in_scope =
-    static_cast<LeadTypeInterpreter<Number_T, InWire_T>* const>(
-        interpreter_in)->top();
+    static_cast<Scope<InWire_T>*>(interpreter_in->topScope());
 
   ScopeError err = ScopeError::success;
 
@@ -56,4 +54,20 @@ bool LeadConverter<Number_T, OutWire_T, InWire_T>::convert(
   return true;
 }
 
+template<typename Number_T, typename OutWire_T, typename InWire_T>
+void LeadConverter<Number_T, OutWire_T, InWire_T>::convertFrame(
+    void* const out_wires, void const* const in_wires, bool modulus)
+{
+  OutWire_T* const outs = static_cast<OutWire_T*>(out_wires);
+
+  for(size_t i = 0; i < this->converter->outLength; i++)
+  {
+    new(outs + i) OutWire_T();
+  }
+
+  this->converter->lineNum = this->lineNum;
+  this->converter->convert(
+      outs, static_cast<InWire_T const*>(in_wires), modulus);
+}
+
 } } // namespace wtk::nails
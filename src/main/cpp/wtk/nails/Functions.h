@@ -6,21 +6,30 @@
 #define WTK_NAILS_FUNCTIONS_H_
 
 #include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_set>
 #include <vector>
 #include <string>
 
 #include <wtk/indexes.h>
+#include <wtk/TypeBackend.h>
 #include <wtk/utils/Pool.h>
 #include <wtk/utils/SkipList.h>
 
 #include <wtk/circuit/Data.h>
 
+#include <wtk/nails/Profiler.h>
+
 namespace wtk {
 namespace nails {
 
 template<typename Number_T>
 struct Interpreter;
 
+template<typename Number_T>
+class Converter;
+
 /**
  * The function is a top-level abstraction for all functions (regular or
  * plugin), which establishes polymorphism for identifying and evaluating
@@ -44,6 +53,38 @@ struct Function
    */
   virtual bool evaluate(Interpreter<Number_T>* const interpreter) = 0;
 
+  /**
+   * Indicates if the function may be evaluated by several threads at once,
+   * each with its own forked Interpreter (see MapOperation).
+   */
+  virtual bool threadSafe() const { return false; }
+
+  /**
+   * If the function is pure, with outputs which depend only on its inputs,
+   * returns the types which it uses (its parameters and its gates, including
+   * those of its callees). Otherwise returns nullptr. Calls to a pure
+   * function may be memoized (see Memoizer).
+   */
+  virtual std::vector<type_idx> const* pureTypes() const { return nullptr; }
+
+  /**
+   * Returns the types which the function uses (its parameters, its gates
+   * and conversions, and those of its callees), or nullptr if they are
+   * unknown (e.g. for a plugin). Evaluating a call touches only the scopes
+   * of these types (see Interpreter::pushScopes()).
+   */
+  virtual std::vector<type_idx> const* usedTypes() const
+  {
+    return this->pureTypes();
+  }
+
+  /**
+   * Approximate bytes held by the function for its body (e.g. recorded
+   * gates), for memory accounting. This excludes the function object itself
+   * and any memory held within its constants.
+   */
+  virtual size_t bytes() const { return 0; }
+
   Function(wtk::circuit::FunctionSignature&& sig)
     : signature(std::move(sig)) { }
 
@@ -143,12 +184,17 @@ struct FunctionFactory
  * The GatesFunction the default Function implementation is based on recording
  * the sequence of gates, and repeating them when invoked.
  *
- * The Gate struct is largely internal to the GatesFunction.
+ * Gates are recorded compactly, for cache density during replay. Each gate is
+ * a 2-byte GateTag (operation and type) and a parallel 24-byte Gate record of
+ * operands. Anything larger (constants, conversions, function calls and
+ * multi-wire copies) is held in a side table of the GatesFunction and
+ * referenced by index from the Gate record.
+ *
+ * The GateTag and Gate structs are largely internal to the GatesFunction.
  */
-template<typename Number_T>
-struct Gate
+struct GateTag
 {
-  enum Operation
+  enum Operation : uint8_t
   {
     uninitialized,
     // Normal
@@ -173,147 +219,141 @@ struct Gate
     copyMulti,
     // Multi Wire Input
     publicInMulti,
-    privateInMulti
+    privateInMulti,
+    // Batch headers (see GatesFunction::batch())
+    addBatch,
+    mulBatch,
+    addcBatch,
+    mulcBatch,
+    assertZeroBatch
   };
 
   Operation operation = uninitialized;
 
-  struct NormalGate
-  {
-    wire_idx out;
-    wire_idx left;
-    wire_idx right;
-
-    type_idx type;
-
-    NormalGate(
-        wire_idx const o, wire_idx const l, wire_idx const r, type_idx const t)
-      : out(o), left(l), right(r), type(t) { }
-  };
-
-  struct ConstantGate
-  {
-    wire_idx out;
-    wire_idx left;
-
-    Number_T right;
-
-    type_idx type;
+  type_idx type = 0;
 
-    ConstantGate(
-        wire_idx const o, wire_idx const l, Number_T&& r, type_idx const t)
-      : out(o), left(l), right(r), type(t) { }
-  };
+  GateTag(Operation const op, type_idx const t) : operation(op), type(t) { }
+};
 
-  struct ConvertGate
-  {
-    wire_idx firstOut;
-    wire_idx lastOut;
+/**
+ * Operands of a recorded gate. Their meaning depends on the GateTag.
+ *  - add, mul: out, left, right
+ *  - copy: out, left
+ *  - assertZero: left
+ *  - publicIn, privateIn: out
+ *  - addc, mulc: out, left, right (index of the constant)
+ *  - assign: out, right (index of the constant)
+ *  - convert_: right (index of the ConvertGate)
+ *  - newRange, deleteRange: out (first), left (last)
+ *  - call_: right (index of the FunctionCall)
+ *  - copyMulti: right (index of the CopyMulti)
+ *  - publicInMulti, privateInMulti: out (first), left (last)
+ *  - addBatch, mulBatch, addcBatch, mulcBatch, assertZeroBatch: out (the
+ *    number of gates which follow in the batch)
+ */
+struct Gate
+{
+  wire_idx out;
+  wire_idx left;
+  wire_idx right;
 
-    wire_idx firstIn;
-    wire_idx lastIn;
+  Gate(wire_idx const o, wire_idx const l, wire_idx const r)
+    : out(o), left(l), right(r) { }
+};
 
-    type_idx outType;
-    type_idx inType;
+static_assert(sizeof(GateTag) == 2, "GateTag should be packed");
+static_assert(sizeof(Gate) == 24, "Gate should be packed");
 
-    bool modulus;
+/**
+ * Side table entry for a convert gate.
+ */
+struct ConvertGate
+{
+  wire_idx firstOut;
+  wire_idx lastOut;
 
-    ConvertGate(wire_idx const fo, wire_idx const lo, type_idx const ot,
-        wire_idx const fi, wire_idx const li, type_idx const it, bool const m)
-      : firstOut(fo), lastOut(lo), firstIn(fi), lastIn(li),
-         outType(ot), inType(it), modulus(m) { }
-  };
+  wire_idx firstIn;
+  wire_idx lastIn;
 
-  struct MemoryGate
-  {
-    wire_idx first;
-    wire_idx last;
+  type_idx outType;
+  type_idx inType;
 
-    type_idx type;
+  bool modulus;
 
-    MemoryGate(wire_idx const f, wire_idx const l, type_idx const t)
-      : first(f), last(l), type(t) { }
-  };
+  ConvertGate(wire_idx const fo, wire_idx const lo, type_idx const ot,
+      wire_idx const fi, wire_idx const li, type_idx const it, bool const m)
+    : firstOut(fo), lastOut(lo), firstIn(fi), lastIn(li),
+       outType(ot), inType(it), modulus(m) { }
+};
 
-  struct MultiInput
+/**
+ * The GatesFunction is the default function implementation.
+ *
+ * It records a list of gates during build, then repeats the list on each
+ * invoke. Runs of independent add, mul, addc, mulc and assert_zero gates
+ * are batched for the TypeBackend's batch callbacks (see batch()).
+ */
+template<typename Number_T>
+struct GatesFunction : public RegularFunction<Number_T>
+{
+  // This is the list of gates, as parallel arrays of tags and operands.
+  std::vector<GateTag> tags;
+  std::vector<Gate> gates;
+
+  // Side tables, indexed from the Gate records.
+  std::vector<Number_T> constants;
+  std::vector<ConvertGate> converts;
+  std::vector<wtk::circuit::FunctionCall> calls;
+  std::vector<wtk::circuit::CopyMulti> copyMultis;
+
+  // Callees and converters, parallel to calls and converts, resolved once
+  // by typeCheck() so that replay may skip name and spec lookups.
+  std::vector<Function<Number_T>*> callees;
+  std::vector<Converter<Number_T>*> converters;
+
+  // Line numbers are run-length encoded as the index of the first gate in
+  // each run, and the run's line number.
+  struct LineRun
   {
-    wtk::circuit::Range outputs;
-    type_idx type;
+    size_t first;
+    size_t lineNum;
 
-    MultiInput(wtk::circuit::Range&& o, type_idx const t)
-      : outputs(std::move(o)), type(t) { }
+    LineRun(size_t const f, size_t const ln) : first(f), lineNum(ln) { }
   };
 
-  // This union is tagged by the gate's type
-  union
-  {
-    NormalGate normal;
-    ConstantGate constant;
-    ConvertGate convert;
-    MemoryGate memory;
-    wtk::circuit::FunctionCall call;
-    wtk::circuit::CopyMulti multiCopy;
-    MultiInput multiInput;
-  };
-
-  // Records each gate's line number (for error reporting).
-  size_t lineNum;
-
-  // normal constructor
-  Gate(Operation const op,
-      wire_idx const o, wire_idx const l, wire_idx const r,
-      type_idx const t, size_t const ln);
-
-  // constant constructor
-  Gate(Operation const op,
-      wire_idx const o, wire_idx const l, Number_T&& r,
-      type_idx const t, size_t const ln, bool);
+  std::vector<LineRun> lineRuns;
 
-  // convert constructor
-  Gate(wire_idx const fo, wire_idx const lo, type_idx const ot,
-      wire_idx const fi, wire_idx const li, type_idx const it,
-      bool m, size_t const ln);
+  // Constants prepared by their type's backend (by typeCheck()), coindexed
+  // with the constants, and the backends which release them. The backends
+  // must outlive the function, but the Interpreter need not.
+  std::vector<void*> prepared;
+  std::vector<wtk::TypeBackendEraser<Number_T>*> preparers;
 
-  // memory constructor
-  Gate(Operation const op,
-      wire_idx const f, wire_idx const l, type_idx const t, size_t const ln);
+  // Number of batch headers among the gates.
+  size_t batches = 0;
 
-  // invoke constructor
-  Gate(wtk::circuit::FunctionCall&& c);
+  // Set by typeCheck() if the function neither reads inputs nor converts,
+  // and calls only thread-safe functions.
+  bool concurrent = false;
 
-  // multi copy constructor
-  Gate(wtk::circuit::CopyMulti&& m, size_t const ln);
+  // Set by typeCheck() if the function neither reads inputs nor converts,
+  // and calls only pure functions.
+  bool pure = false;
 
-  // multi wire input gate constructor
-  Gate(Operation const op,
-      wtk::circuit::Range&& r, type_idx const t, size_t const ln);
+  // Set by typeCheck() unless the function calls a function whose types are
+  // unknown, along with the types it uses (sorted).
+  bool typesKnown = false;
+  std::vector<type_idx> types;
 
-  // No copying
-  Gate(Gate const&) = delete;
-  Gate& operator=(Gate const&) = delete;
-
-  // Only move construction
-  Gate(Gate&& move);
-  Gate& operator=(Gate&&) = delete;
-
-  ~Gate();
-};
-
-/**
- * The GatesFunction is the default function implementation.
- *
- * It records a list of gates during build, then repeats the list on each
- * invoke.
- */
-template<typename Number_T>
-struct GatesFunction : public RegularFunction<Number_T>
-{
-  // This is the list of gates
-  std::vector<Gate<Number_T>> gates;
+  // Append a gate (and its line number) to the list.
+  void record(GateTag::Operation const op, type_idx const type,
+      wire_idx const out, wire_idx const left, wire_idx const right);
 
   GatesFunction(wtk::circuit::FunctionSignature&& sig)
     : RegularFunction<Number_T>(std::move(sig)) { }
 
+  size_t bytes() const override;
+
   // Record gates
   bool addGate(wire_idx const out,
       wire_idx const left, wire_idx const right, type_idx const type) override;
@@ -361,8 +401,44 @@ struct GatesFunction : public RegularFunction<Number_T>
 
   bool typeCheck(Interpreter<Number_T> const* const interpreter) override;
 
+  // The checks of typeCheck(), which also resolves callees and converters
+  // and prepares constants, but does not batch the gates.
+  // In trusted mode (see Interpreter::enableTrusted()) the gates are known
+  // to be valid, so they are not checked, and only resolve() and
+  // summarize() are done.
+  bool checkGates(Interpreter<Number_T> const* const interpreter);
+
+  // Resolve the callees and converters, without checking the gates.
+  bool resolve(Interpreter<Number_T> const* const interpreter);
+
+  // Find the concurrent, pure and types properties, and prepare().
+  void summarize(Interpreter<Number_T> const* const interpreter);
+
+  // Prepare the constants with the TypeBackends.
+  void prepare(Interpreter<Number_T> const* const interpreter);
+
+  // Group runs of independent gates with the same operation and type behind
+  // a batch header, for the TypeBackend's batch callbacks.
+  void batch();
+
+  static GateTag::Operation batchOperation(GateTag::Operation const op);
+
   // Evaluate the function
   bool evaluate(Interpreter<Number_T>* const interpreter) override;
+
+  bool threadSafe() const override { return this->concurrent; }
+
+  std::vector<type_idx> const* pureTypes() const override
+  {
+    return this->pure ? &this->types : nullptr;
+  }
+
+  std::vector<type_idx> const* usedTypes() const override
+  {
+    return this->typesKnown ? &this->types : nullptr;
+  }
+
+  ~GatesFunction();
 };
 
 /**
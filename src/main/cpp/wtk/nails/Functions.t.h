@@ -6,166 +6,25 @@ namespace wtk {
 namespace nails {
 
 template<typename Number_T>
-Gate<Number_T>::Gate(Operation const op,
-    wire_idx const o, wire_idx const l, wire_idx const r,
-    type_idx const t, size_t const ln)
-  : operation(op), normal(o, l, r, t), lineNum(ln) { }
-
-template<typename Number_T>
-Gate<Number_T>::Gate(Operation const op,
-    wire_idx const o, wire_idx const l, Number_T&& r,
-    type_idx const t, size_t const ln, bool)
-  : operation(op), constant(o, l, std::move(r), t), lineNum(ln) { }
-
-template<typename Number_T>
-Gate<Number_T>::Gate(
-    wire_idx const fo, wire_idx const lo, type_idx const ot,
-    wire_idx const fi, wire_idx const li, type_idx const it, bool const m,
-    size_t const ln)
-  : operation(convert_), convert(fo, lo, ot, fi, li, it, m), lineNum(ln) { }
-
-template<typename Number_T>
-Gate<Number_T>::Gate(Operation const op,
-    wire_idx const f, wire_idx const l, type_idx const t, size_t const ln)
-  : operation(op), memory(f, l, t), lineNum(ln) { }
-
-template<typename Number_T>
-Gate<Number_T>::Gate(wtk::circuit::FunctionCall&& c)
-  : operation(call_), call(c), lineNum(c.lineNum) { }
-
-template<typename Number_T>
-Gate<Number_T>::Gate(wtk::circuit::CopyMulti&& m, size_t const ln)
-  : operation(copyMulti), multiCopy(std::move(m)), lineNum(ln) { }
-
-template<typename Number_T>
-Gate<Number_T>::Gate(Operation const op, wtk::circuit::Range&& r,
-    type_idx const t, size_t const ln)
-  : operation(op), multiInput(std::move(r), t), lineNum(ln) { }
-
-template<typename Number_T>
-Gate<Number_T>::Gate(Gate&& move)
+void GatesFunction<Number_T>::record(
+    GateTag::Operation const op, type_idx const type,
+    wire_idx const out, wire_idx const left, wire_idx const right)
 {
-  this->operation = move.operation;
-  switch(move.operation)
-  {
-  case uninitialized:
-  {
-    break;
-  }
-  case add:        /* fallthrough */
-  case mul:        /* fallthrough */
-  case copy:       /* fallthrough */
-  case assertZero: /* fallthrough */
-  case publicIn:   /* fallthrough */
-  case privateIn:
-  {
-    new(&this->normal) NormalGate(std::move(move.normal));
-    break;
-  }
-  case addc: /* fallthrough */
-  case mulc: /* fallthrough */
-  case assign:
-  {
-    new(&this->constant) ConstantGate(std::move(move.constant));
-    break;
-  }
-  case convert_:
-  {
-    new(&this->convert) ConvertGate(std::move(move.convert));
-    break;
-  }
-  case newRange: /* fallthrough */
-  case deleteRange:
-  {
-    new(&this->memory) MemoryGate(std::move(move.memory));
-    break;
-  }
-  case call_:
-  {
-    new(&this->call) wtk::circuit::FunctionCall(std::move(move.call));
-    break;
-  }
-  case copyMulti:
+  if(this->lineRuns.size() == 0
+      || this->lineRuns.back().lineNum != this->lineNum)
   {
-    new(&this->multiCopy) wtk::circuit::CopyMulti(std::move(move.multiCopy));
-    break;
-  }
-  case publicInMulti: /* fallthrough */
-  case privateInMulti:
-  {
-    new(&this->multiInput) MultiInput(std::move(move.multiInput));
-    break;
-  }
+    this->lineRuns.emplace_back(this->gates.size(), this->lineNum);
   }
 
-  this->lineNum = move.lineNum;
-  move.lineNum = 0;
-
-  move.operation = uninitialized;
-}
-
-template<typename Number_T>
-Gate<Number_T>::~Gate()
-{
-  switch(this->operation)
-  {
-  case uninitialized:
-  {
-    break;
-  }
-  case add:        /* fallthrough */
-  case mul:        /* fallthrough */
-  case copy:       /* fallthrough */
-  case assertZero: /* fallthrough */
-  case publicIn:   /* fallthrough */
-  case privateIn:
-  {
-    this->normal.~NormalGate();
-    break;
-  }
-  case addc: /* fallthrough */
-  case mulc: /* fallthrough */
-  case assign:
-  {
-    this->constant.~ConstantGate();
-    break;
-  }
-  case convert_:
-  {
-    this->convert.~ConvertGate();
-    break;
-  }
-  case newRange: /* fallthrough */
-  case deleteRange:
-  {
-    this->memory.~MemoryGate();
-    break;
-  }
-  case call_:
-  {
-    this->call.~FunctionCall();
-    break;
-  }
-  case copyMulti:
-  {
-    this->multiCopy.~CopyMulti();
-    break;
-  }
-  case publicInMulti: /* fallthrough */
-  case privateInMulti:
-  {
-    this->multiInput.~MultiInput();
-    break;
-  }
-  }
+  this->tags.emplace_back(op, type);
+  this->gates.emplace_back(out, left, right);
 }
 
 template<typename Number_T>
 bool GatesFunction<Number_T>::addGate(wire_idx const out,
     wire_idx const left, wire_idx const right, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::add, out, left, right, type, this->lineNum);
+  this->record(GateTag::add, type, out, left, right);
 
   return true;
 }
@@ -174,8 +33,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::mulGate(wire_idx const out,
     wire_idx const left, wire_idx const right, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::mul, out, left, right, type, this->lineNum);
+  this->record(GateTag::mul, type, out, left, right);
 
   return true;
 }
@@ -184,8 +42,8 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::addcGate(wire_idx const out,
     wire_idx const left, Number_T&& right, type_idx const type)
 {
-  this->gates.emplace_back(Gate<Number_T>::addc,
-      out, left, std::move(right), type, this->lineNum, true);
+  this->record(GateTag::addc, type, out, left, this->constants.size());
+  this->constants.emplace_back(std::move(right));
 
   return true;
 }
@@ -194,8 +52,8 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::mulcGate(wire_idx const out,
     wire_idx const left, Number_T&& right, type_idx const type)
 {
-  this->gates.emplace_back(Gate<Number_T>::mulc,
-      out, left, std::move(right), type, this->lineNum, true);
+  this->record(GateTag::mulc, type, out, left, this->constants.size());
+  this->constants.emplace_back(std::move(right));
 
   return true;
 }
@@ -204,8 +62,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::copy(wire_idx const out,
     wire_idx const left, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::copy, out, left, 0, type, this->lineNum);
+  this->record(GateTag::copy, type, out, left, 0);
 
   return true;
 }
@@ -213,7 +70,8 @@ bool GatesFunction<Number_T>::copy(wire_idx const out,
 template<typename Number_T>
 bool GatesFunction<Number_T>::copyMulti(wtk::circuit::CopyMulti* multi)
 {
-  this->gates.emplace_back(std::move(*multi), this->lineNum);
+  this->record(GateTag::copyMulti, multi->type, 0, 0, this->copyMultis.size());
+  this->copyMultis.emplace_back(std::move(*multi));
 
   return true;
 }
@@ -222,8 +80,8 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::assign(wire_idx const out,
     Number_T&& left, type_idx const type)
 {
-  this->gates.emplace_back(Gate<Number_T>::assign,
-      out, 0, std::move(left), type, this->lineNum, true);
+  this->record(GateTag::assign, type, out, 0, this->constants.size());
+  this->constants.emplace_back(std::move(left));
 
   return true;
 }
@@ -232,8 +90,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::assertZero(
     wire_idx const left, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::assertZero, 0, left, 0, type, this->lineNum);
+  this->record(GateTag::assertZero, type, 0, left, 0);
 
   return true;
 }
@@ -242,8 +99,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::publicIn(
     wire_idx const out, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::publicIn, out, 0, 0, type, this->lineNum);
+  this->record(GateTag::publicIn, type, out, 0, 0);
 
   return true;
 }
@@ -252,8 +108,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::publicInMulti(
     wtk::circuit::Range* out, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::publicInMulti, std::move(*out), type, this->lineNum);
+  this->record(GateTag::publicInMulti, type, out->first, out->last, 0);
 
   return true;
 }
@@ -262,8 +117,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::privateIn(
     wire_idx const out, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::privateIn, out, 0, 0, type, this->lineNum);
+  this->record(GateTag::privateIn, type, out, 0, 0);
 
   return true;
 }
@@ -272,8 +126,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::privateInMulti(
     wtk::circuit::Range* out, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::privateInMulti, std::move(*out), type, this->lineNum);
+  this->record(GateTag::privateInMulti, type, out->first, out->last, 0);
 
   return true;
 }
@@ -284,9 +137,9 @@ bool GatesFunction<Number_T>::convert(
     wire_idx const first_in, wire_idx const last_in, type_idx const in_type,
     bool const m)
 {
-  this->gates.emplace_back(
-      first_out, last_out, out_type,
-      first_in, last_in, in_type, m, this->lineNum);
+  this->record(GateTag::convert_, out_type, 0, 0, this->converts.size());
+  this->converts.emplace_back(
+      first_out, last_out, out_type, first_in, last_in, in_type, m);
 
   return true;
 }
@@ -295,8 +148,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::newRange(
     wire_idx const first, wire_idx const last, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::newRange, first, last, type, this->lineNum);
+  this->record(GateTag::newRange, type, first, last, 0);
 
   return true;
 }
@@ -305,8 +157,7 @@ template<typename Number_T>
 bool GatesFunction<Number_T>::deleteRange(
     wire_idx const first, wire_idx const last, type_idx const type)
 {
-  this->gates.emplace_back(
-      Gate<Number_T>::deleteRange, first, last, type, this->lineNum);
+  this->record(GateTag::deleteRange, type, first, last, 0);
 
   return true;
 }
@@ -314,7 +165,8 @@ bool GatesFunction<Number_T>::deleteRange(
 template<typename Number_T>
 bool GatesFunction<Number_T>::invoke(wtk::circuit::FunctionCall&& call)
 {
-  this->gates.emplace_back(std::move(call));
+  this->record(GateTag::call_, 0, 0, 0, this->calls.size());
+  this->calls.emplace_back(std::move(call));
 
   return true;
 }
@@ -322,6 +174,16 @@ bool GatesFunction<Number_T>::invoke(wtk::circuit::FunctionCall&& call)
 template<typename Number_T>
 bool GatesFunction<Number_T>::typeCheck(
     Interpreter<Number_T> const* const interpreter)
+{
+  if(UNLIKELY(!this->checkGates(interpreter))) { return false; }
+
+  this->batch();
+  return true;
+}
+
+template<typename Number_T>
+bool GatesFunction<Number_T>::checkGates(
+    Interpreter<Number_T> const* const interpreter)
 {
   char const* const file_name = interpreter->fileName;
   size_t const num_fields = interpreter->interpreters.size();
@@ -331,6 +193,17 @@ bool GatesFunction<Number_T>::typeCheck(
     allocations(num_fields);
   std::vector<size_t> remap_counts(num_fields, 0);
 
+  this->callees.assign(this->calls.size(), nullptr);
+  this->converters.assign(this->converts.size(), nullptr);
+
+  if(interpreter->trusted)
+  {
+    if(UNLIKELY(!this->resolve(interpreter))) { return false; }
+
+    this->summarize(interpreter);
+    return true;
+  }
+
   auto checkInputRange = [file_name, num_fields, &actives, &allocations]
     (wire_idx const first, wire_idx const last, size_t const type,
         size_t const line_num) -> bool
@@ -556,232 +429,252 @@ bool GatesFunction<Number_T>::typeCheck(
     }
   }
 
+  size_t line_num = 0;
+  size_t next_run = 0;
+
   for(size_t i = 0; i < this->gates.size(); i++)
   {
-    Gate<Number_T> const* const gate = &this->gates[i];
+    if(next_run < this->lineRuns.size() && this->lineRuns[next_run].first == i)
+    {
+      line_num = this->lineRuns[next_run].lineNum;
+      next_run++;
+    }
 
-    switch(gate->operation)
+    GateTag const* const tag = &this->tags[i];
+    Gate const* const gate = &this->gates[i];
+
+    switch(tag->operation)
     {
-    case Gate<Number_T>::uninitialized:
+    case GateTag::uninitialized:   /* fallthrough */
+    case GateTag::addBatch:        /* fallthrough */
+    case GateTag::mulBatch:        /* fallthrough */
+    case GateTag::addcBatch:       /* fallthrough */
+    case GateTag::mulcBatch:       /* fallthrough */
+    case GateTag::assertZeroBatch:
     {
       log_assert(false, "uninitalized gate");
       break;
     }
-    case Gate<Number_T>::add: /* fallthrough */
-    case Gate<Number_T>::mul:
+    case GateTag::add: /* fallthrough */
+    case GateTag::mul:
     {
-      size_t const type = (size_t) gate->normal.type;
-      if(UNLIKELY(!actives[type].has(gate->normal.left)))
+      size_t const type = (size_t) tag->type;
+      if(UNLIKELY(!actives[type].has(gate->left)))
       {
         log_error("%s:%zu: Wire not yet assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.left);
+            file_name, line_num, gate->left);
         return false;
       }
 
-      if(UNLIKELY(!actives[type].has(gate->normal.right)))
+      if(UNLIKELY(!actives[type].has(gate->right)))
       {
         log_error("%s:%zu: Wire not yet assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.right);
+            file_name, line_num, gate->right);
         return false;
       }
 
-      if(UNLIKELY(!actives[type].insert(gate->normal.out)))
+      if(UNLIKELY(!actives[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire already assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
-      if(UNLIKELY(!assigns[type].insert(gate->normal.out)))
+      if(UNLIKELY(!assigns[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire assigned but deleted $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
       break;
     }
-    case Gate<Number_T>::copy:
+    case GateTag::copy:
     {
-      size_t const type = (size_t) gate->normal.type;
-      if(UNLIKELY(!actives[type].has(gate->normal.left)))
+      size_t const type = (size_t) tag->type;
+      if(UNLIKELY(!actives[type].has(gate->left)))
       {
         log_error("%s:%zu: Wire not yet assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.left);
+            file_name, line_num, gate->left);
         return false;
       }
 
-      if(UNLIKELY(!actives[type].insert(gate->normal.out)))
+      if(UNLIKELY(!actives[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire already assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
-      if(UNLIKELY(!assigns[type].insert(gate->normal.out)))
+      if(UNLIKELY(!assigns[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire assigned but deleted $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
       break;
     }
-    case Gate<Number_T>::assertZero:
+    case GateTag::assertZero:
     {
-      size_t const type = (size_t) gate->normal.type;
-      if(UNLIKELY(!actives[type].has(gate->normal.left)))
+      size_t const type = (size_t) tag->type;
+      if(UNLIKELY(!actives[type].has(gate->left)))
       {
         log_error("%s:%zu: Wire not yet assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.left);
+            file_name, line_num, gate->left);
         return false;
       }
       break;
     }
-    case Gate<Number_T>::publicIn: /* fallthrough */
-    case Gate<Number_T>::privateIn:
+    case GateTag::publicIn: /* fallthrough */
+    case GateTag::privateIn:
     {
-      size_t const type = (size_t) gate->normal.type;
-      if(UNLIKELY(!actives[type].insert(gate->normal.out)))
+      size_t const type = (size_t) tag->type;
+      if(UNLIKELY(!actives[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire already assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
-      if(UNLIKELY(!assigns[type].insert(gate->normal.out)))
+      if(UNLIKELY(!assigns[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire assigned but deleted $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->normal.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
       break;
     }
-    case Gate<Number_T>::addc: /* fallthrough */
-    case Gate<Number_T>::mulc:
+    case GateTag::addc: /* fallthrough */
+    case GateTag::mulc:
     {
-      size_t const type = (size_t) gate->constant.type;
-      if(UNLIKELY(!actives[type].has(gate->constant.left)))
+      size_t const type = (size_t) tag->type;
+      if(UNLIKELY(!actives[type].has(gate->left)))
       {
         log_error("%s:%zu: Wire not yet assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->constant.left);
+            file_name, line_num, gate->left);
         return false;
       }
 
-      if(UNLIKELY(
-          !interpreter->interpreters[type]->checkNumber(gate->constant.right)))
+      if(UNLIKELY(!interpreter->interpreters[type]->checkNumber(
+              this->constants[(size_t) gate->right])))
       {
         log_error("%s:%zu: (constant value %s) invalid field element.",
-            file_name, gate->lineNum,
-            wtk::utils::dec(gate->constant.right).c_str());
+            file_name, line_num,
+            wtk::utils::dec(this->constants[(size_t) gate->right]).c_str());
         return false;
       }
 
-      if(UNLIKELY(!actives[type].insert(gate->constant.out)))
+      if(UNLIKELY(!actives[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire already assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->constant.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
-      if(UNLIKELY(!assigns[type].insert(gate->constant.out)))
+      if(UNLIKELY(!assigns[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire assigned but deleted $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->constant.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
       break;
     }
-    case Gate<Number_T>::assign:
+    case GateTag::assign:
     {
-      size_t const type = (size_t) gate->constant.type;
-      if(UNLIKELY(
-          !interpreter->interpreters[type]->checkNumber(gate->constant.right)))
+      size_t const type = (size_t) tag->type;
+      if(UNLIKELY(!interpreter->interpreters[type]->checkNumber(
+              this->constants[(size_t) gate->right])))
       {
         log_error("%s:%zu: (constant value %s) invalid field element.",
-            file_name, gate->lineNum,
-            wtk::utils::dec(gate->constant.right).c_str());
+            file_name, line_num,
+            wtk::utils::dec(this->constants[(size_t) gate->right]).c_str());
         return false;
       }
 
-      if(UNLIKELY(!actives[type].insert(gate->constant.out)))
+      if(UNLIKELY(!actives[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire already assigned $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->constant.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
-      if(UNLIKELY(!assigns[type].insert(gate->constant.out)))
+      if(UNLIKELY(!assigns[type].insert(gate->out)))
       {
         log_error("%s:%zu: Wire assigned but deleted $%" PRIu64 ".",
-            file_name, gate->lineNum, gate->constant.out);
+            file_name, line_num, gate->out);
         return false;
       }
 
       break;
     }
-    case Gate<Number_T>::convert_:
+    case GateTag::convert_:
     {
-      if(UNLIKELY(!checkInputRange(gate->convert.firstIn, gate->convert.lastIn,
-          (size_t) gate->convert.inType, gate->lineNum)))
+      ConvertGate const* const convert =
+        &this->converts[(size_t) gate->right];
+
+      if(UNLIKELY(!checkInputRange(convert->firstIn, convert->lastIn,
+          (size_t) convert->inType, line_num)))
       {
         return false;
       }
 
       if(UNLIKELY(!checkOutputRange(
-          gate->convert.firstOut, gate->convert.lastOut,
-          (size_t) gate->convert.outType, gate->lineNum)))
+          convert->firstOut, convert->lastOut,
+          (size_t) convert->outType, line_num)))
       {
         return false;
       }
 
-      wtk::circuit::ConversionSpec spec(gate->convert.outType,
-          1 + gate->convert.lastOut - gate->convert.firstOut,
-          gate->convert.inType,
-          1 + gate->convert.lastIn - gate->convert.firstIn);
+      wtk::circuit::ConversionSpec spec(convert->outType,
+          1 + convert->lastOut - convert->firstOut,
+          convert->inType,
+          1 + convert->lastIn - convert->firstIn);
 
-      if(UNLIKELY(
-          interpreter->converters.find(spec) == interpreter->converters.end()))
+      auto finder = interpreter->converters.find(spec);
+      if(UNLIKELY(finder == interpreter->converters.end()))
       {
         log_error("%s:%zu: No such conversion "
-            "@convert(@out: %u:%zu, @in: %u:%zu)", file_name, gate->lineNum,
+            "@convert(@out: %u:%zu, @in: %u:%zu)", file_name, line_num,
             (unsigned int) spec.outType, spec.outLength,
             (unsigned int) spec.inType, spec.inLength);
         return false;
       }
 
+      this->converters[(size_t) gate->right] = finder->second.get();
+
       break;
     }
-    case Gate<Number_T>::newRange:
+    case GateTag::newRange:
     {
       if(UNLIKELY(!checkNewRange(
-          gate->memory.first, gate->memory.last, (size_t) gate->memory.type,
-          gate->lineNum)))
+          gate->out, gate->left, (size_t) tag->type,
+          line_num)))
       {
         return false;
       }
 
       break;
     }
-    case Gate<Number_T>::deleteRange:
+    case GateTag::deleteRange:
     {
-      size_t const type = (size_t) gate->memory.type;
-      wire_idx const first = gate->memory.first;
-      wire_idx const last = gate->memory.last;
+      size_t const type = (size_t) tag->type;
+      wire_idx const first = gate->out;
+      wire_idx const last = gate->left;
 
       if(UNLIKELY(first > last))
       {
         log_error("%s:%zu: Invalid range ($%" PRIu64 " ...$%" PRIu64 ")",
-            file_name, gate->lineNum, first, last);
+            file_name, line_num, first, last);
         return false;
       }
 
       if(UNLIKELY(!actives[type].remove(first, last)))
       {
         log_error("%s:%zu: Cannot delete non-assigned wires "
-            "(%zu: $%" PRIu64 " ... $%" PRIu64 ")", file_name, gate->lineNum,
+            "(%zu: $%" PRIu64 " ... $%" PRIu64 ")", file_name, line_num,
             type, first, last);
         return false;
       }
@@ -804,7 +697,7 @@ bool GatesFunction<Number_T>::typeCheck(
         else
         {
           log_error("%s:%zu: Delete cannot divide ranges "
-              "(%zu: $%" PRIu64 " ... $%" PRIu64 ")", file_name, gate->lineNum,
+              "(%zu: $%" PRIu64 " ... $%" PRIu64 ")", file_name, line_num,
               type, first, last);
           return false;
         }
@@ -812,73 +705,79 @@ bool GatesFunction<Number_T>::typeCheck(
 
       break;
     }
-    case Gate<Number_T>::call_:
+    case GateTag::call_:
     {
-      auto finder = interpreter->functions.find(gate->call.name.c_str());
+      wtk::circuit::FunctionCall const* const call =
+        &this->calls[(size_t) gate->right];
+
+      auto finder = interpreter->functions.find(call->name.c_str());
       if(finder == interpreter->functions.end())
       {
         log_error("%s:%zu: Function \'%s\' is not defined", file_name,
-            gate->lineNum, gate->call.name.c_str());
+            line_num, call->name.c_str());
         return false;
       }
+
+      this->callees[(size_t) gate->right] = finder->second;
+
       wtk::circuit::FunctionSignature const* const signature =
         &finder->second->signature;
 
-      if(UNLIKELY(signature->inputs.size() != gate->call.inputs.size()))
+      if(UNLIKELY(signature->inputs.size() != call->inputs.size()))
       {
         log_info("%s:%zu: Wrong number of inputs to function \'%s\': "
             "%zu, expected %zu",
-            file_name, gate->lineNum, signature->name.c_str(),
-            gate->call.inputs.size(), signature->inputs.size());
+            file_name, line_num, signature->name.c_str(),
+            call->inputs.size(), signature->inputs.size());
         return false;
       }
 
       for(size_t i = 0; i < signature->inputs.size(); i++)
       {
         size_t const type = (size_t) signature->inputs[i].type;
-        wire_idx const first = gate->call.inputs[i].first;
-        wire_idx const last = gate->call.inputs[i].last;
+        wire_idx const first = call->inputs[i].first;
+        wire_idx const last = call->inputs[i].last;
         size_t len = (size_t) (1 + last - first);
 
         if(UNLIKELY(len != signature->inputs[i].length))
         {
           log_error("%s:%zu: Input range (%zu: $%" PRIu64 " ... $%" PRIu64 ")"
               " has the incorrect length (expected %zu)", file_name,
-              gate->lineNum, type, first, last, signature->inputs[i].length);
+              line_num, type, first, last, signature->inputs[i].length);
           return false;
         }
 
-        if(UNLIKELY(!checkInputRange(first, last, type, gate->lineNum)))
+        if(UNLIKELY(!checkInputRange(first, last, type, line_num)))
         {
           return false;
         }
       }
 
-      if(UNLIKELY(signature->outputs.size() != gate->call.outputs.size()))
+      if(UNLIKELY(signature->outputs.size() != call->outputs.size()))
       {
         log_info("%s:%zu: Wrong number of outputs to function \'%s\': "
             "%zu, expected %zu",
-            file_name, gate->lineNum, signature->name.c_str(),
-            gate->call.outputs.size(), signature->outputs.size());
+            file_name, line_num, signature->name.c_str(),
+            call->outputs.size(), signature->outputs.size());
         return false;
       }
 
       for(size_t i = 0; i < signature->outputs.size(); i++)
       {
         size_t const type = (size_t) signature->outputs[i].type;
-        wire_idx const first = gate->call.outputs[i].first;
-        wire_idx const last = gate->call.outputs[i].last;
+        wire_idx const first = call->outputs[i].first;
+        wire_idx const last = call->outputs[i].last;
         size_t len = (size_t) (1 + last - first);
 
         if(UNLIKELY(len != signature->outputs[i].length))
         {
           log_error("%s:%zu: Output range (%zu: $%" PRIu64 " ... $%" PRIu64 ")"
               " has the incorrect length (expected %zu)", file_name,
-              gate->lineNum, type, first, last, signature->outputs[i].length);
+              line_num, type, first, last, signature->outputs[i].length);
           return false;
         }
 
-        if(UNLIKELY(!checkOutputRange(first, last, type, gate->lineNum)))
+        if(UNLIKELY(!checkOutputRange(first, last, type, line_num)))
         {
           return false;
         }
@@ -886,37 +785,40 @@ bool GatesFunction<Number_T>::typeCheck(
 
       break;
     }
-    case Gate<Number_T>::copyMulti:
+    case GateTag::copyMulti:
     {
-      size_t const type = (size_t) gate->multiCopy.type;
-      for(size_t i = 0; i < gate->multiCopy.inputs.size(); i++)
+      wtk::circuit::CopyMulti const* const multi =
+        &this->copyMultis[(size_t) gate->right];
+
+      size_t const type = (size_t) multi->type;
+      for(size_t i = 0; i < multi->inputs.size(); i++)
       {
-        wire_idx const first = gate->multiCopy.inputs[i].first;
-        wire_idx const last = gate->multiCopy.inputs[i].last;
+        wire_idx const first = multi->inputs[i].first;
+        wire_idx const last = multi->inputs[i].last;
 
-        if(UNLIKELY(!checkInputRange(first, last, type, gate->lineNum)))
+        if(UNLIKELY(!checkInputRange(first, last, type, line_num)))
         {
           return false;
         }
       }
 
-      wire_idx const o_first = gate->multiCopy.outputs.first;
-      wire_idx const o_last = gate->multiCopy.outputs.last;
+      wire_idx const o_first = multi->outputs.first;
+      wire_idx const o_last = multi->outputs.last;
 
-      if(UNLIKELY(!checkOutputRange(o_first, o_last, type, gate->lineNum)))
+      if(UNLIKELY(!checkOutputRange(o_first, o_last, type, line_num)))
       {
         return false;
       }
 
       break;
     }
-    case Gate<Number_T>::publicInMulti: /* fallthrough */
-    case Gate<Number_T>::privateInMulti:
+    case GateTag::publicInMulti: /* fallthrough */
+    case GateTag::privateInMulti:
     {
-      size_t const type = (size_t) gate->normal.type;
-      wire_idx const first = gate->multiInput.outputs.first;
-      wire_idx const last = gate->multiInput.outputs.last;
-      if(UNLIKELY(!checkOutputRange(first, last, type, gate->lineNum)))
+      size_t const type = (size_t) tag->type;
+      wire_idx const first = gate->out;
+      wire_idx const last = gate->left;
+      if(UNLIKELY(!checkOutputRange(first, last, type, line_num)))
       {
         return false;
       }
@@ -926,203 +828,620 @@ bool GatesFunction<Number_T>::typeCheck(
     }
   }
 
+  this->summarize(interpreter);
   return true;
 }
 
+template<typename Number_T>
+bool GatesFunction<Number_T>::resolve(
+    Interpreter<Number_T> const* const interpreter)
+{
+  char const* const file_name = interpreter->fileName;
+  size_t line_num = 0;
+  size_t next_run = 0;
+
+  for(size_t i = 0; i < this->gates.size(); i++)
+  {
+    if(next_run < this->lineRuns.size() && this->lineRuns[next_run].first == i)
+    {
+      line_num = this->lineRuns[next_run].lineNum;
+      next_run++;
+    }
+
+    switch(this->tags[i].operation)
+    {
+    case GateTag::convert_:
+    {
+      ConvertGate const* const convert =
+        &this->converts[(size_t) this->gates[i].right];
+
+      wtk::circuit::ConversionSpec spec(convert->outType,
+          1 + convert->lastOut - convert->firstOut,
+          convert->inType,
+          1 + convert->lastIn - convert->firstIn);
+
+      auto finder = interpreter->converters.find(spec);
+      if(UNLIKELY(finder == interpreter->converters.end()))
+      {
+        log_error("%s:%zu: No such conversion "
+            "@convert(@out: %u:%zu, @in: %u:%zu)", file_name, line_num,
+            (unsigned int) spec.outType, spec.outLength,
+            (unsigned int) spec.inType, spec.inLength);
+        return false;
+      }
+
+      this->converters[(size_t) this->gates[i].right] = finder->second.get();
+      break;
+    }
+    case GateTag::call_:
+    {
+      wtk::circuit::FunctionCall const* const call =
+        &this->calls[(size_t) this->gates[i].right];
+
+      auto finder = interpreter->functions.find(call->name.c_str());
+      if(finder == interpreter->functions.end())
+      {
+        log_error("%s:%zu: Function \'%s\' is not defined", file_name,
+            line_num, call->name.c_str());
+        return false;
+      }
+
+      this->callees[(size_t) this->gates[i].right] = finder->second;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+    }
+  }
+
+  return true;
+}
+
+template<typename Number_T>
+void GatesFunction<Number_T>::summarize(
+    Interpreter<Number_T> const* const interpreter)
+{
+  // Inputs must be read in order, and converters aren't thread-safe.
+  // Neither may be memoized (see pureTypes()).
+  this->concurrent = true;
+  for(size_t i = 0; i < this->tags.size(); i++)
+  {
+    switch(this->tags[i].operation)
+    {
+    case GateTag::publicIn:       /* fallthrough */
+    case GateTag::privateIn:      /* fallthrough */
+    case GateTag::publicInMulti:  /* fallthrough */
+    case GateTag::privateInMulti: /* fallthrough */
+    case GateTag::convert_:
+    {
+      this->concurrent = false;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+    }
+  }
+
+  this->pure = this->concurrent;
+
+  for(size_t i = 0; i < this->callees.size(); i++)
+  {
+    if(!this->callees[i]->threadSafe()) { this->concurrent = false; }
+  }
+
+  this->typesKnown = true;
+  this->types.clear();
+
+  for(size_t i = 0; i < this->callees.size(); i++)
+  {
+    if(this->callees[i]->pureTypes() == nullptr) { this->pure = false; }
+
+    std::vector<type_idx> const* const callee_types =
+      this->callees[i]->usedTypes();
+    if(callee_types == nullptr) { this->typesKnown = false; }
+    else
+    {
+      this->types.insert(
+          this->types.end(), callee_types->begin(), callee_types->end());
+    }
+  }
+
+  if(this->typesKnown)
+  {
+    for(size_t i = 0; i < this->signature.outputs.size(); i++)
+    {
+      this->types.push_back(this->signature.outputs[i].type);
+    }
+
+    for(size_t i = 0; i < this->signature.inputs.size(); i++)
+    {
+      this->types.push_back(this->signature.inputs[i].type);
+    }
+
+    for(size_t i = 0; i < this->tags.size(); i++)
+    {
+      switch(this->tags[i].operation)
+      {
+      case GateTag::call_:
+      {
+        break;
+      }
+      case GateTag::convert_:
+      {
+        ConvertGate const* const convert =
+          &this->converts[(size_t) this->gates[i].right];
+        this->types.push_back(convert->outType);
+        this->types.push_back(convert->inType);
+        break;
+      }
+      case GateTag::copyMulti:
+      {
+        this->types.push_back(
+            this->copyMultis[(size_t) this->gates[i].right].type);
+        break;
+      }
+      default:
+      {
+        this->types.push_back(this->tags[i].type);
+        break;
+      }
+      }
+    }
+
+    std::sort(this->types.begin(), this->types.end());
+    this->types.erase(std::unique(this->types.begin(), this->types.end()),
+        this->types.end());
+  }
+  else
+  {
+    this->pure = false;
+    this->types.clear();
+  }
+
+  this->prepare(interpreter);
+}
+
+template<typename Number_T>
+void GatesFunction<Number_T>::prepare(
+    Interpreter<Number_T> const* const interpreter)
+{
+  this->prepared.assign(this->constants.size(), nullptr);
+  this->preparers.assign(this->constants.size(), nullptr);
+
+  for(size_t i = 0; i < this->tags.size(); i++)
+  {
+    GateTag::Operation const op = this->tags[i].operation;
+    if(op == GateTag::addc || op == GateTag::mulc || op == GateTag::assign)
+    {
+      size_t const idx = (size_t) this->gates[i].right;
+      type_idx const type = this->tags[i].type;
+
+      this->prepared[idx] = interpreter->interpreters[(size_t) type]
+        ->prepareConstant(this->constants[idx]);
+      this->preparers[idx] =
+        interpreter->interpreters[(size_t) type]->erasedBackend();
+    }
+  }
+}
+
+template<typename Number_T>
+GateTag::Operation GatesFunction<Number_T>::batchOperation(
+    GateTag::Operation const op)
+{
+  switch(op)
+  {
+  case GateTag::add: return GateTag::addBatch;
+  case GateTag::mul: return GateTag::mulBatch;
+  case GateTag::addc: return GateTag::addcBatch;
+  case GateTag::mulc: return GateTag::mulcBatch;
+  case GateTag::assertZero: return GateTag::assertZeroBatch;
+  default: return GateTag::uninitialized;
+  }
+}
+
+template<typename Number_T>
+void GatesFunction<Number_T>::batch()
+{
+  std::vector<GateTag> new_tags;
+  std::vector<Gate> new_gates;
+  std::vector<LineRun> new_line_runs;
+  new_tags.reserve(this->tags.size());
+  new_gates.reserve(this->gates.size());
+
+  // Outputs of the current batch, which later gates must not use.
+  std::unordered_set<wire_idx> outputs;
+
+  size_t next_run = 0;
+  size_t i = 0;
+  while(i < this->tags.size())
+  {
+    GateTag::Operation const op = this->tags[i].operation;
+    type_idx const type = this->tags[i].type;
+    GateTag::Operation const batch_op = batchOperation(op);
+
+    size_t j = i + 1;
+    if(batch_op != GateTag::uninitialized)
+    {
+      outputs.clear();
+      if(op != GateTag::assertZero) { outputs.insert(this->gates[i].out); }
+
+      while(j < this->tags.size() && this->tags[j].operation == op
+          && this->tags[j].type == type)
+      {
+        Gate const* const gate = &this->gates[j];
+        if(op != GateTag::assertZero)
+        {
+          if(outputs.find(gate->left) != outputs.end()
+              || ((op == GateTag::add || op == GateTag::mul)
+                && outputs.find(gate->right) != outputs.end()))
+          {
+            break;
+          }
+
+          outputs.insert(gate->out);
+        }
+
+        j++;
+      }
+    }
+
+    for(size_t k = i; k < j; k++)
+    {
+      while(next_run < this->lineRuns.size()
+          && this->lineRuns[next_run].first <= k)
+      {
+        new_line_runs.emplace_back(
+            new_gates.size(), this->lineRuns[next_run].lineNum);
+        next_run++;
+      }
+
+      if(k == i && j - i > 1)
+      {
+        new_tags.emplace_back(batch_op, type);
+        new_gates.emplace_back(j - i, 0, 0);
+        this->batches++;
+      }
+
+      new_tags.push_back(this->tags[k]);
+      new_gates.push_back(this->gates[k]);
+    }
+
+    i = j;
+  }
+
+  this->tags = std::move(new_tags);
+  this->gates = std::move(new_gates);
+  this->lineRuns = std::move(new_line_runs);
+}
+
+template<typename Number_T>
+size_t GatesFunction<Number_T>::bytes() const
+{
+  size_t ret = this->tags.capacity() * sizeof(GateTag)
+    + this->gates.capacity() * sizeof(Gate)
+    + this->constants.capacity() * sizeof(Number_T)
+    + this->converts.capacity() * sizeof(ConvertGate)
+    + this->calls.capacity() * sizeof(wtk::circuit::FunctionCall)
+    + this->copyMultis.capacity() * sizeof(wtk::circuit::CopyMulti)
+    + this->callees.capacity() * sizeof(Function<Number_T>*)
+    + this->converters.capacity() * sizeof(Converter<Number_T>*)
+    + this->lineRuns.capacity() * sizeof(LineRun)
+    + this->prepared.capacity() * sizeof(void*)
+    + this->preparers.capacity() * sizeof(void*);
+
+  for(size_t i = 0; i < this->calls.size(); i++)
+  {
+    ret += (this->calls[i].outputs.capacity()
+        + this->calls[i].inputs.capacity()) * sizeof(wtk::circuit::Range);
+  }
+
+  for(size_t i = 0; i < this->copyMultis.size(); i++)
+  {
+    ret += this->copyMultis[i].inputs.capacity() * sizeof(wtk::circuit::Range);
+  }
+
+  return ret;
+}
+
 template<typename Number_T>
 bool GatesFunction<Number_T>::evaluate(
     Interpreter<Number_T>* const interpreter)
 {
+  ProfileGuard guard(interpreter->profiler, this, this->signature.name.c_str());
+  guard.gates = this->gates.size() - this->batches;
+
+  bool const batching = interpreter->batching();
+
+  size_t line_num = 0;
+  size_t next_run = 0;
+
   for(size_t i = 0; i < this->gates.size(); i++)
   {
-    Gate<Number_T> const* const gate = &this->gates[i];
-    interpreter->lineNum = gate->lineNum;
+    // Batches skip over line runs, so the cursor may need to catch up.
+    while(next_run < this->lineRuns.size()
+        && this->lineRuns[next_run].first <= i)
+    {
+      line_num = this->lineRuns[next_run].lineNum;
+      next_run++;
+    }
+
+    GateTag const* const tag = &this->tags[i];
+    Gate const* const gate = &this->gates[i];
+    interpreter->lineNum = line_num;
 
-    switch(gate->operation)
+    switch(tag->operation)
     {
-    case Gate<Number_T>::uninitialized:
+    case GateTag::uninitialized:
     {
       log_assert(false, "uninitialized gate");
       break;
     }
-    case Gate<Number_T>::add:
+    // Unless batching, the header is skipped and its gates follow singly.
+    case GateTag::addBatch:
     {
-      log_debug("%zu: add gate", gate->lineNum);
+      if(!batching) { break; }
 
-      if(UNLIKELY(!interpreter->addGate(gate->normal.out,
-            gate->normal.left, gate->normal.right, gate->normal.type)))
+      log_debug("%zu: add batch", line_num);
+
+      if(UNLIKELY(!interpreter->addGates(
+            gate + 1, (size_t) gate->out, tag->type)))
+      {
+        return false;
+      }
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::mulBatch:
+    {
+      if(!batching) { break; }
+
+      log_debug("%zu: mul batch", line_num);
+
+      if(UNLIKELY(!interpreter->mulGates(
+            gate + 1, (size_t) gate->out, tag->type)))
       {
         return false;
       }
+      i += (size_t) gate->out;
       break;
     }
-    case Gate<Number_T>::mul:
+    case GateTag::addcBatch:
     {
-      log_debug("%zu: mul gate", gate->lineNum);
+      if(!batching) { break; }
+
+      log_debug("%zu: addc batch", line_num);
+
+      if(UNLIKELY(!interpreter->addcGates(gate + 1, (size_t) gate->out,
+            this->prepared.data(), tag->type)))
+      {
+        return false;
+      }
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::mulcBatch:
+    {
+      if(!batching) { break; }
+
+      log_debug("%zu: mulc batch", line_num);
 
-      if(UNLIKELY(!interpreter->mulGate(gate->normal.out,
-            gate->normal.left, gate->normal.right, gate->normal.type)))
+      if(UNLIKELY(!interpreter->mulcGates(gate + 1, (size_t) gate->out,
+            this->prepared.data(), tag->type)))
       {
         return false;
       }
+      i += (size_t) gate->out;
       break;
     }
-    case Gate<Number_T>::copy:
+    case GateTag::assertZeroBatch:
     {
-      log_debug("%zu: copy gate", gate->lineNum);
+      if(!batching) { break; }
+
+      log_debug("%zu: assert zero batch", line_num);
+
+      if(UNLIKELY(!interpreter->assertZeros(
+            gate + 1, (size_t) gate->out, tag->type)))
+      {
+        return false;
+      }
+      i += (size_t) gate->out;
+      break;
+    }
+    case GateTag::add:
+    {
+      log_debug("%zu: add gate", line_num);
+
+      if(UNLIKELY(!interpreter->addGate(gate->out,
+            gate->left, gate->right, tag->type)))
+      {
+        return false;
+      }
+      break;
+    }
+    case GateTag::mul:
+    {
+      log_debug("%zu: mul gate", line_num);
+
+      if(UNLIKELY(!interpreter->mulGate(gate->out,
+            gate->left, gate->right, tag->type)))
+      {
+        return false;
+      }
+      break;
+    }
+    case GateTag::copy:
+    {
+      log_debug("%zu: copy gate", line_num);
 
       if(UNLIKELY(!interpreter->copy(
-            gate->normal.out, gate->normal.left, gate->normal.type)))
+            gate->out, gate->left, tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::assertZero:
+    case GateTag::assertZero:
     {
-      log_debug("%zu: assert zero gate", gate->lineNum);
+      log_debug("%zu: assert zero gate", line_num);
 
       if(UNLIKELY(!interpreter->assertZero(
-            gate->normal.left, gate->normal.type)))
+            gate->left, tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::publicIn:
+    case GateTag::publicIn:
     {
-      log_debug("%zu: public input gate", gate->lineNum);
+      log_debug("%zu: public input gate", line_num);
 
       if(UNLIKELY(!interpreter->publicIn(
-            gate->normal.out, gate->normal.type)))
+            gate->out, tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::privateIn:
+    case GateTag::privateIn:
     {
-      log_debug("%zu: private input gate", gate->lineNum);
+      log_debug("%zu: private input gate", line_num);
 
       if(UNLIKELY(!interpreter->privateIn(
-            gate->normal.out, gate->normal.type)))
+            gate->out, tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::addc:
+    case GateTag::addc:
     {
-      log_debug("%zu: addc gate", gate->lineNum);
+      log_debug("%zu: addc gate", line_num);
 
-      Number_T copy(gate->constant.right);
-      if(UNLIKELY(!interpreter->addcGate(
-            gate->constant.out, gate->constant.left, std::move(copy),
-            gate->constant.type)))
+      if(UNLIKELY(!interpreter->addcPrepared(gate->out, gate->left,
+            this->prepared[(size_t) gate->right],
+            this->constants[(size_t) gate->right], tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::mulc:
+    case GateTag::mulc:
     {
-      log_debug("%zu: mulc gate", gate->lineNum);
+      log_debug("%zu: mulc gate", line_num);
 
-      Number_T copy(gate->constant.right);
-      if(UNLIKELY(!interpreter->mulcGate(
-            gate->constant.out, gate->constant.left, std::move(copy),
-            gate->constant.type)))
+      if(UNLIKELY(!interpreter->mulcPrepared(gate->out, gate->left,
+            this->prepared[(size_t) gate->right],
+            this->constants[(size_t) gate->right], tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::assign:
+    case GateTag::assign:
     {
-      log_debug("%zu: assign gate", gate->lineNum);
+      log_debug("%zu: assign gate", line_num);
 
-      Number_T copy(gate->constant.right);
-      if(UNLIKELY(!interpreter->assign(
-            gate->constant.out, std::move(copy), gate->constant.type)))
+      if(UNLIKELY(!interpreter->assignPrepared(gate->out,
+            this->prepared[(size_t) gate->right],
+            this->constants[(size_t) gate->right], tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::convert_:
+    case GateTag::convert_:
     {
-      log_debug("%zu: convert gate", gate->lineNum);
+      ConvertGate const* const convert =
+        &this->converts[(size_t) gate->right];
+
+      log_debug("%zu: convert gate", line_num);
 
       if(UNLIKELY(!interpreter->convert(
-            gate->convert.firstOut, gate->convert.lastOut,
-            gate->convert.outType,
-            gate->convert.firstIn, gate->convert.lastIn,
-            gate->convert.inType, gate->convert.modulus)))
+            convert->firstOut, convert->lastOut,
+            convert->outType,
+            convert->firstIn, convert->lastIn,
+            convert->inType, convert->modulus,
+            this->converters[(size_t) gate->right])))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::newRange:
+    case GateTag::newRange:
     {
-      log_debug("%zu: new range", gate->lineNum);
+      log_debug("%zu: new range", line_num);
 
       if(UNLIKELY(!interpreter->newRange(
-            gate->memory.first, gate->memory.last, gate->memory.type)))
+            gate->out, gate->left, tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::deleteRange:
+    case GateTag::deleteRange:
     {
-      log_debug("%zu: delete range", gate->lineNum);
+      log_debug("%zu: delete range", line_num);
 
       if(UNLIKELY(!interpreter->deleteRange(
-            gate->memory.first, gate->memory.last, gate->memory.type)))
+            gate->out, gate->left, tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::call_:
+    case GateTag::call_:
     {
+      wtk::circuit::FunctionCall const* const call =
+        &this->calls[(size_t) gate->right];
+
       log_debug("%zu: function call: %s",
-          gate->lineNum, gate->call.name.c_str());
+          line_num, call->name.c_str());
 
-      if(UNLIKELY(!interpreter->invoke(&gate->call)))
+      if(UNLIKELY(!interpreter->invoke(
+            call, this->callees[(size_t) gate->right])))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::copyMulti:
+    case GateTag::copyMulti:
     {
-      log_debug("%zu: copy multi gate", gate->lineNum);
+      wtk::circuit::CopyMulti const* const multi =
+        &this->copyMultis[(size_t) gate->right];
+
+      log_debug("%zu: copy multi gate", line_num);
 
-      if(UNLIKELY(!interpreter->copyMulti(&gate->multiCopy)))
+      if(UNLIKELY(!interpreter->copyMulti(multi)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::publicInMulti:
+    case GateTag::publicInMulti:
     {
-      log_debug("%zu: public input multi gate", gate->lineNum);
+      wtk::circuit::Range const outputs(gate->out, gate->left);
+
+      log_debug("%zu: public input multi gate", line_num);
 
       if(UNLIKELY(!interpreter->publicInMulti(
-            &gate->multiInput.outputs, gate->multiInput.type)))
+            &outputs, tag->type)))
       {
         return false;
       }
       break;
     }
-    case Gate<Number_T>::privateInMulti:
+    case GateTag::privateInMulti:
     {
-      log_debug("%zu: private input multi gate", gate->lineNum);
+      wtk::circuit::Range const outputs(gate->out, gate->left);
+
+      log_debug("%zu: private input multi gate", line_num);
 
       if(UNLIKELY(!interpreter->privateInMulti(
-            &gate->multiInput.outputs, gate->multiInput.type)))
+            &outputs, tag->type)))
       {
         return false;
       }
@@ -1134,6 +1453,18 @@ bool GatesFunction<Number_T>::evaluate(
   return true;
 }
 
+template<typename Number_T>
+GatesFunction<Number_T>::~GatesFunction()
+{
+  for(size_t i = 0; i < this->prepared.size(); i++)
+  {
+    if(this->prepared[i] != nullptr)
+    {
+      this->preparers[i]->releaseConstant(this->prepared[i]);
+    }
+  }
+}
+
 template<typename Number_T>
 RegularFunction<Number_T>* GatesFunctionFactory<Number_T>::createFunction(
     wtk::circuit::FunctionSignature&& sig)
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <vector>
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 #include <wtk/indexes.h>
@@ -18,6 +19,9 @@
 #include <wtk/nails/TypeInterpreter.h>
 #include <wtk/nails/Converter.h>
 #include <wtk/nails/Functions.h>
+#include <wtk/nails/TypeWorker.h>
+#include <wtk/nails/Profiler.h>
+#include <wtk/nails/Memoizer.h>
 
 #ifdef WTK_NAILS_ENABLE_TRACES
 #include <wtk/utils/Indent.h>
@@ -58,21 +62,107 @@ struct Interpreter
    */
   Interpreter(char const* const fn) : fileName(fn) { }
 
+  // Trusted mode skips wire validity checks (see Scope::trusted).
+  bool trusted = false;
+
+  /**
+   * Enable trusted mode for all types, including those added later. This
+   * should only be used for a relation which has already been validated,
+   * e.g. as recorded by a certificate from wtk::utils::checkCertificate().
+   */
+  void enableTrusted();
+
+  // Parallel mode evaluates each type on its own thread.
+  bool parallel = false;
+
+  // Interpreters for the calls queued to each type's worker (see invoke()),
+  // created as needed. They borrow this one's TypeInterpreters, and are
+  // declared before the workers, so that they are destroyed after them.
+  std::vector<std::unique_ptr<Interpreter<Number_T>>> callers;
+
+  // Indicates that the TypeInterpreters are borrowed from another
+  // Interpreter, so they are not destroyed with this one.
+  bool borrowed = false;
+
+  // A worker for each type, in parallel mode. These are declared after the
+  // interpreters, so that they are destroyed first.
+  std::vector<std::unique_ptr<TypeWorker<Number_T>>> workers;
+
+  // Depth of function calls. A call is evaluated by a single thread (the
+  // caller's, or a worker's if queued to it), so workers are not used within
+  // calls.
+  size_t callDepth = 0;
+
+  /**
+   * Enable parallel mode for all types, including those added later. Each
+   * type's gates are evaluated by its own worker thread (see TypeWorker),
+   * synchronizing only at conversions and function calls. A call waits only
+   * for the workers of the types which the function uses (all of them for a
+   * plugin), and a call which uses a single type is queued to that type's
+   * worker. Each TypeBackend is used only by its own type's thread, aside
+   * from TypeBackendEraser::prepareConstant(), but a backend must not share
+   * unsynchronized state with any other type's backend.
+   *
+   * Gate failures are reported at the next synchronization point, so the
+   * caller must use synchronize() after the relation is finished.
+   */
+  void enableParallel();
+
+  /**
+   * Wait for all type workers to finish their queued gates. Returns false if
+   * any gate has failed. Does nothing unless parallel mode is enabled.
+   */
+  bool synchronize();
+
+  // Indicates if gates are to be queued for workers.
+  bool queueing() const
+  {
+    return !this->workers.empty() && this->callDepth == 0;
+  }
+
+  // Indicates if batches of gates may be evaluated together, rather than
+  // queued singly for workers or traced gate by gate.
+  bool batching() const
+  {
+    return !this->queueing()
+#ifdef WTK_NAILS_ENABLE_TRACES
+      && !this->traceDetail
+#endif//WTK_NAILS_ENABLE_TRACES
+      ;
+  }
+
+  // An optional profiler for function calls, owned by the caller, who must
+  // finish() it after the relation. It is not used by forked Interpreters.
+  Profiler* profiler = nullptr;
+
+  // An optional cache of pure function calls, owned by the caller. Only
+  // calls from the top level or from uncompiled functions are memoized, and
+  // not while tracing. It is not used by forked Interpreters.
+  Memoizer<Number_T>* memoizer = nullptr;
+
 #ifdef WTK_NAILS_ENABLE_TRACES
   bool trace = false;
   bool traceDetail = false;
   wtk::utils::Indent indent;
 
   void enableTrace();
+
+  /**
+   * Trace each gate, for all types including those added later. Gates are
+   * traced by each type's LeadTypeInterpreter, so types whose policy rules
+   * out traces are not traced (see Policy.h). This must not be combined
+   * with parallel mode.
+   */
   void enableTraceDetail();
 #endif//WTK_NAILS_ENABLE_TRACES
 
   /**
    * Add a type to the interpreter.
    *
-   * The order of invocation defines the type's type index.
+   * The order of invocation defines the type's type index. The Policy_T
+   * selects the checks done for each of the type's gates (see Policy.h).
    */
-  template<typename Wire_T>
+  template<typename Wire_T, typename Policy_T = CheckedPolicy>
   void addType(wtk::TypeBackend<Number_T, Wire_T>* const tb,
       wtk::InputStream<Number_T>* const public_in,
       wtk::InputStream<Number_T>* const private_in);
@@ -108,8 +198,41 @@ struct Interpreter
   bool assign(
       wire_idx const out, Number_T&& left, type_idx const type);
 
+  /**
+   * As addcGate(), mulcGate() and assign(), but with a constant prepared by
+   * the type's backend and already checked (e.g. by a GatesFunction's
+   * typeCheck()). The value is used only for traces, or when the gate must
+   * be queued for a worker.
+   */
+  bool addcPrepared(wire_idx const out, wire_idx const left,
+      void const* right, Number_T const& value, type_idx const type);
+
+  bool mulcPrepared(wire_idx const out, wire_idx const left,
+      void const* right, Number_T const& value, type_idx const type);
+
+  bool assignPrepared(wire_idx const out,
+      void const* right, Number_T const& value, type_idx const type);
+
   bool assertZero(wire_idx const left, type_idx const type);
 
+  /**
+   * Evaluate a batch of independent gates of a single type and operation
+   * (see GatesFunction::batch()), with operands as in the Gate record and
+   * already checked. Constants are prepared, and indexed by the Gate's
+   * right operand. These may only be used while batching().
+   */
+  bool addGates(Gate const* gates, size_t const n, type_idx const type);
+
+  bool mulGates(Gate const* gates, size_t const n, type_idx const type);
+
+  bool addcGates(Gate const* gates, size_t const n,
+      void* const* constants, type_idx const type);
+
+  bool mulcGates(Gate const* gates, size_t const n,
+      void* const* constants, type_idx const type);
+
+  bool assertZeros(Gate const* gates, size_t const n, type_idx const type);
+
   bool publicIn(wire_idx const out, type_idx const type);
 
   bool publicInMulti(
@@ -126,6 +249,17 @@ struct Interpreter
       wire_idx const first_in, wire_idx const last_in,
       type_idx const in_type, bool modulus);
 
+  /**
+   * Convert with a pre-resolved converter (e.g. by a GatesFunction's
+   * typeCheck()), skipping the ConversionSpec lookup.
+   */
+  bool convert(
+      wire_idx const first_out, wire_idx const last_out,
+      type_idx const out_type,
+      wire_idx const first_in, wire_idx const last_in,
+      type_idx const in_type, bool modulus,
+      Converter<Number_T>* const converter);
+
   bool newRange(
       wire_idx const first, wire_idx const last, type_idx const type);
 
@@ -134,7 +268,45 @@ struct Interpreter
 
   bool invoke(wtk::circuit::FunctionCall const* const call);
 
-  ~Interpreter() = default;
+  /**
+   * Invoke a pre-resolved function, skipping the name lookup and the checks
+   * of the call against the function's signature. The caller must have
+   * already checked the call (e.g. in a GatesFunction's typeCheck()).
+   */
+  bool invoke(wtk::circuit::FunctionCall const* const call,
+      Function<Number_T>* const function);
+
+  /**
+   * Push (or pop) a scope for each type which the function uses (see
+   * Function::usedTypes()), or for every type if they are unknown.
+   */
+  void pushScopes(Function<Number_T> const* const function);
+
+  void popScopes(Function<Number_T> const* const function);
+
+private:
+  // Wait for the workers of the given types, or of all types if nullptr.
+  bool synchronizeTypes(std::vector<type_idx> const* const types);
+
+  // Queue a call which uses a single type to that type's worker.
+  bool queueCall(wtk::circuit::FunctionCall const* const call,
+      Function<Number_T>* const function, type_idx const type);
+
+  /**
+   * Push the call's scope, evaluate the function, check its outputs and pop
+   * the scope. If outputs is non-null, the function's outputs are assigned
+   * from it (in order of the signature) instead of evaluating the function.
+   */
+  bool evaluateCall(wtk::circuit::FunctionCall const* const call,
+      Function<Number_T>* const function, Number_T const* outputs);
+
+  // Invoke a pure function through the memoizer.
+  bool memoizeCall(wtk::circuit::FunctionCall const* const call,
+      Function<Number_T>* const function);
+
+public:
+
+  ~Interpreter();
 };
 
 } } // namespace wtk::nails
@@ -17,18 +17,75 @@ template<typename Number_T>
 void Interpreter<Number_T>::enableTraceDetail()
 {
   this->traceDetail = true;
+
+  for(size_t i = 0; i < this->interpreters.size(); i++)
+  {
+    this->interpreters[i]->enableTraceDetail((type_idx) i, &this->indent);
+  }
 }
 #endif//WTK_NAILS_ENABLE_TRACES
 
 template<typename Number_T>
-template<typename Wire_T>
+void Interpreter<Number_T>::enableTrusted()
+{
+  this->trusted = true;
+
+  for(size_t i = 0; i < this->interpreters.size(); i++)
+  {
+    this->interpreters[i]->enableTrusted();
+  }
+}
+
+template<typename Number_T>
+void Interpreter<Number_T>::enableParallel()
+{
+  for(size_t i = this->workers.size(); i < this->interpreters.size(); i++)
+  {
+    this->workers.emplace_back(
+        new TypeWorker<Number_T>(this->interpreters[i].get()));
+  }
+
+  this->parallel = true;
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::synchronize()
+{
+  bool ret = true;
+  for(size_t i = 0; i < this->workers.size(); i++)
+  {
+    if(UNLIKELY(!this->workers[i]->synchronize())) { ret = false; }
+  }
+
+  return ret;
+}
+
+template<typename Number_T>
+template<typename Wire_T, typename Policy_T>
 void Interpreter<Number_T>::addType(
     wtk::TypeBackend<Number_T, Wire_T>* const tb,
     wtk::InputStream<Number_T>* const public_in,
     wtk::InputStream<Number_T>* const private_in)
 {
-  this->interpreters.emplace_back(new LeadTypeInterpreter<Number_T, Wire_T>(
+  this->interpreters.emplace_back(
+      new LeadTypeInterpreter<Number_T, Wire_T, Policy_T>(
         this->fileName, tb, public_in, private_in));
+
+  if(this->trusted) { this->interpreters.back()->enableTrusted(); }
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->traceDetail)
+  {
+    this->interpreters.back()->enableTraceDetail(
+        (type_idx) (this->interpreters.size() - 1), &this->indent);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+  if(this->parallel)
+  {
+    this->workers.emplace_back(
+        new TypeWorker<Number_T>(this->interpreters.back().get()));
+  }
 }
 
 template<typename Number_T>
@@ -61,14 +118,11 @@ bool Interpreter<Number_T>::addGate(wire_idx const out,
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- @add(%" PRIu8 ": $%" PRIu64 ", $%"
-        PRIu64 ");", this->fileName, this->lineNum, this->indent.get(),
-        out, type, left, right);
+    return this->workers[(size_t) type]->addGate(
+        out, left, right, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->addGate(out, left, right);
@@ -80,14 +134,11 @@ bool Interpreter<Number_T>::mulGate(wire_idx const out,
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- @mul(%" PRIu8 ": $%" PRIu64 ", $%"
-        PRIu64 ");", this->fileName, this->lineNum, this->indent.get(),
-        out, type, left, right);
+    return this->workers[(size_t) type]->mulGate(
+        out, left, right, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->mulGate(out, left, right);
@@ -99,14 +150,11 @@ bool Interpreter<Number_T>::addcGate(wire_idx const out,
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- @addc(%" PRIu8 ": $%" PRIu64
-        ", < %s >);", this->fileName, this->lineNum, this->indent.get(),
-        out, type, left, wtk::utils::dec(right).c_str());
+    return this->workers[(size_t) type]->addcGate(
+        out, left, std::move(right), this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->addcGate(
@@ -119,14 +167,11 @@ bool Interpreter<Number_T>::mulcGate(wire_idx const out,
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- @mulc(%" PRIu8 ": $%" PRIu64
-        ", < %s >);", this->fileName, this->lineNum, this->indent.get(),
-        out, type, left, wtk::utils::dec(right).c_str());
+    return this->workers[(size_t) type]->mulcGate(
+        out, left, std::move(right), this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->mulcGate(
@@ -139,13 +184,10 @@ bool Interpreter<Number_T>::copy(
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- %" PRIu8 ": $%" PRIu64 ";",
-        this->fileName, this->lineNum, this->indent.get(), out, type, left);
+    return this->workers[(size_t) type]->copy(out, left, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->copy(out, left);
@@ -157,34 +199,11 @@ bool Interpreter<Number_T>::copyMulti(
 {
   log_assert(multi->type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    std::string s = "$";
-    s += wtk::utils::dec(multi->outputs.first);
-
-    if(multi->outputs.first != multi->outputs.last)
-    {
-      s += " ... $" + wtk::utils::dec(multi->outputs.last);
-    }
-
-    s += " <- " + wtk::utils::dec(multi->type) + ": ";
-
-    std::string comma = "";
-    for(size_t i = 0; i < multi->inputs.size(); i++)
-    {
-      s += comma + "$" + wtk::utils::dec(multi->inputs[i].first);
-      comma = ", ";
-      if(multi->inputs[i].first != multi->inputs[i].last)
-      {
-        s += " ... $" + wtk::utils::dec(multi->inputs[i].last);
-      }
-    }
-
-    log_info("    %s:%zu: %s%s;",
-        this->fileName, this->lineNum, this->indent.get(), s.c_str());
+    return this->workers[(size_t) multi->type]->copyMulti(
+        multi, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) multi->type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) multi->type]->copyMulti(multi);
@@ -196,49 +215,151 @@ bool Interpreter<Number_T>::assign(
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- %" PRIu8 ": < %s >);",
-        this->fileName, this->lineNum, this->indent.get(), out, type,
-        wtk::utils::dec(left).c_str());
+    return this->workers[(size_t) type]->assign(
+        out, std::move(left), this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->assign(out, std::move(left));
 }
 
+template<typename Number_T>
+bool Interpreter<Number_T>::addcPrepared(
+    wire_idx const out, wire_idx const left, void const* right,
+    Number_T const& value, type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+
+  if(this->queueing())
+  {
+    Number_T copy(value);
+    return this->workers[(size_t) type]->addcGate(
+        out, left, std::move(copy), this->lineNum);
+  }
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->addcPrepared(
+      out, left, right, value);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::mulcPrepared(
+    wire_idx const out, wire_idx const left, void const* right,
+    Number_T const& value, type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+
+  if(this->queueing())
+  {
+    Number_T copy(value);
+    return this->workers[(size_t) type]->mulcGate(
+        out, left, std::move(copy), this->lineNum);
+  }
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->mulcPrepared(
+      out, left, right, value);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::assignPrepared(wire_idx const out,
+    void const* right, Number_T const& value, type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+
+  if(this->queueing())
+  {
+    Number_T copy(value);
+    return this->workers[(size_t) type]->assign(
+        out, std::move(copy), this->lineNum);
+  }
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->assignPrepared(
+      out, right, value);
+}
+
 template<typename Number_T>
 bool Interpreter<Number_T>::assertZero(
     wire_idx const left, type_idx const type)
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s@assert_zero(%" PRIu8 ": $%" PRIu64 ");",
-        this->fileName, this->lineNum, this->indent.get(), type, left);
+    return this->workers[(size_t) type]->assertZero(left, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->assertZero(left);
 }
 
+template<typename Number_T>
+bool Interpreter<Number_T>::addGates(Gate const* gates, size_t const n,
+    type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+  log_assert(this->batching());
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->addGates(gates, n);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::mulGates(Gate const* gates, size_t const n,
+    type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+  log_assert(this->batching());
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->mulGates(gates, n);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::addcGates(Gate const* gates, size_t const n,
+    void* const* constants, type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+  log_assert(this->batching());
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->addcGates(gates, n, constants);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::mulcGates(Gate const* gates, size_t const n,
+    void* const* constants, type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+  log_assert(this->batching());
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->mulcGates(gates, n, constants);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::assertZeros(Gate const* gates, size_t const n,
+    type_idx const type)
+{
+  log_assert(type < this->interpreters.size());
+  log_assert(this->batching());
+
+  this->interpreters[(size_t) type]->lineNum = this->lineNum;
+  return this->interpreters[(size_t) type]->assertZeros(gates, n);
+}
+
 template<typename Number_T>
 bool Interpreter<Number_T>::publicIn(wire_idx const out, type_idx const type)
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- @public(%" PRIu8 ");",
-        this->fileName, this->lineNum, this->indent.get(), out, type);
+    return this->workers[(size_t) type]->publicIn(out, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->publicIn(out);
@@ -250,22 +371,10 @@ bool Interpreter<Number_T>::publicInMulti(
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    if(out->first == out->last)
-    {
-      log_info("    %s:%zu: %s$%" PRIu64 " <- @public(%" PRIu8 ");",
-          this->fileName, this->lineNum, this->indent.get(), out->first, type);
-    }
-    else
-    {
-      log_info("    %s:%zu: %s$%" PRIu64 " ... $%" PRIu64 "<- @public(%"
-          PRIu8 ");", this->fileName, this->lineNum, this->indent.get(),
-          out->first, out->last, type);
-    }
+    return this->workers[(size_t) type]->publicInMulti(out, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->publicInMulti(out);
@@ -276,13 +385,10 @@ bool Interpreter<Number_T>::privateIn(wire_idx const out, type_idx const type)
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s$%" PRIu64 " <- @private(%" PRIu8 ");",
-        this->fileName, this->lineNum, this->indent.get(), out, type);
+    return this->workers[(size_t) type]->privateIn(out, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->privateIn(out);
@@ -294,22 +400,10 @@ bool Interpreter<Number_T>::privateInMulti(
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    if(out->first == out->last)
-    {
-      log_info("    %s:%zu: %s$%" PRIu64 " <- @private(%" PRIu8 ");",
-          this->fileName, this->lineNum, this->indent.get(), out->first, type);
-    }
-    else
-    {
-      log_info("    %s:%zu: %s$%" PRIu64 " ... $%" PRIu64 "<- @private(%"
-          PRIu8 ");", this->fileName, this->lineNum, this->indent.get(),
-          out->first, out->last, type);
-    }
+    return this->workers[(size_t) type]->privateInMulti(out, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->privateInMulti(out);
@@ -321,6 +415,31 @@ bool Interpreter<Number_T>::convert(
     type_idx const out_type,
     wire_idx const first_in, wire_idx const last_in,
     type_idx const in_type, bool modulus)
+{
+  wtk::circuit::ConversionSpec spec(
+      out_type, 1 + last_out - first_out, in_type, 1 + last_in - first_in);
+
+  auto finder = this->converters.find(spec);
+  if(UNLIKELY(finder == this->converters.end()))
+  {
+    log_error("%s:%zu: No such conversion: "
+        "@convert(@out: %u:%zu, @in: %u:%zu)", this->fileName, this->lineNum,
+        (unsigned int) spec.outType, spec.outLength,
+        (unsigned int) spec.inType, spec.inLength);
+    return false;
+  }
+
+  return this->convert(first_out, last_out, out_type,
+      first_in, last_in, in_type, modulus, finder->second.get());
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::convert(
+    wire_idx const first_out, wire_idx const last_out,
+    type_idx const out_type,
+    wire_idx const first_in, wire_idx const last_in,
+    type_idx const in_type, bool modulus,
+    Converter<Number_T>* const converter)
 {
   log_assert(out_type < this->interpreters.size());
   log_assert(in_type < this->interpreters.size());
@@ -336,20 +455,15 @@ bool Interpreter<Number_T>::convert(
   }
 #endif//WTK_NAILS_ENABLE_TRACES
 
-  wtk::circuit::ConversionSpec spec(
-      out_type, 1 + last_out - first_out, in_type, 1 + last_in - first_in);
-
-  auto finder = this->converters.find(spec);
-  if(finder == this->converters.end())
+  if(this->queueing())
   {
-    log_error("%s:%zu: No such conversion: "
-        "@convert(@out: %u:%zu, @in: %u:%zu)", this->fileName, this->lineNum,
-        (unsigned int) spec.outType, spec.outLength,
-        (unsigned int) spec.inType, spec.inLength);
+    bool const out_ok = this->workers[(size_t) out_type]->synchronize();
+    bool const in_ok = this->workers[(size_t) in_type]->synchronize();
+    if(UNLIKELY(!out_ok || !in_ok)) { return false; }
   }
 
-  finder->second->lineNum = this->lineNum;
-  return finder->second->convert(
+  converter->lineNum = this->lineNum;
+  return converter->convert(
       first_out, last_out, this->interpreters[(size_t) out_type].get(),
       first_in, last_in, this->interpreters[(size_t) in_type].get(), modulus);
 }
@@ -360,13 +474,10 @@ bool Interpreter<Number_T>::newRange(
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s@new(%" PRIu8 ": $%" PRIu64 " ... $%" PRIu64 ");",
-        this->fileName, this->lineNum, this->indent.get(), type, first, last);
+    return this->workers[(size_t) type]->newRange(first, last, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->newRange(first, last);
@@ -378,14 +489,11 @@ bool Interpreter<Number_T>::deleteRange(
 {
   log_assert(type < this->interpreters.size());
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->traceDetail)
+  if(this->queueing())
   {
-    log_info("    %s:%zu: %s@delete(%" PRIu8 ": $%" PRIu64 " ... $%"
-        PRIu64 ");", this->fileName, this->lineNum, this->indent.get(), type,
-        first, last);
+    return this->workers[(size_t) type]->deleteRange(
+        first, last, this->lineNum);
   }
-#endif//WTK_NAILS_ENABLE_TRACES
 
   this->interpreters[(size_t) type]->lineNum = this->lineNum;
   return this->interpreters[(size_t) type]->deleteRange(first, last);
@@ -395,15 +503,6 @@ template<typename Number_T>
 bool Interpreter<Number_T>::invoke(
     wtk::circuit::FunctionCall const* const call)
 {
-#ifdef WTK_NAILS_ENABLE_TRACES
-  if(this->trace)
-  {
-    log_info("    %s:%zu: %s@call(%s)", this->fileName, this->lineNum,
-        this->indent.get(), call->name.c_str());
-    this->indent.inc();
-  }
-#endif//WTK_NAILS_ENABLE_TRACES
-
   auto finder = this->functions.find(call->name.c_str());
   if(UNLIKELY(finder == this->functions.end()))
   {
@@ -427,16 +526,10 @@ bool Interpreter<Number_T>::invoke(
   {
     log_error("%s:%zu: Call to \'%s\' has %zu input parameters (expected %zu)",
         this->fileName, this->lineNum, call->name.c_str(),
-        call->inputs.size(), function->signature.outputs.size());
+        call->inputs.size(), function->signature.inputs.size());
     return false;
   }
 
-  for(size_t i = 0; i < this->interpreters.size(); i++)
-  {
-    this->interpreters[i]->lineNum = this->lineNum;
-    this->interpreters[i]->push();
-  }
-
   for(size_t i = 0; i < call->outputs.size(); i++)
   {
     log_assert(function->signature.outputs[i].type < this->interpreters.size());
@@ -459,13 +552,6 @@ bool Interpreter<Number_T>::invoke(
           function->signature.outputs[i].length);
       return false;
     }
-
-    if(UNLIKELY(
-        !this->interpreters[(size_t) function->signature.outputs[i].type]
-        ->mapOutput(call->outputs[i].first, call->outputs[i].last)))
-    {
-      return false;
-    }
   }
 
   for(size_t i = 0; i < call->inputs.size(); i++)
@@ -490,7 +576,215 @@ bool Interpreter<Number_T>::invoke(
           function->signature.inputs[i].length);
       return false;
     }
+  }
+
+  return this->invoke(call, function);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::invoke(
+    wtk::circuit::FunctionCall const* const call,
+    Function<Number_T>* const function)
+{
+  bool const memoize = this->memoizer != nullptr
+    && function->pureTypes() != nullptr
+#ifdef WTK_NAILS_ENABLE_TRACES
+    && !this->trace
+#endif//WTK_NAILS_ENABLE_TRACES
+    ;
+
+  if(this->queueing())
+  {
+    std::vector<type_idx> const* const types = function->usedTypes();
+
+    // A call of a single type may be evaluated by its worker, unless it is
+    // to be memoized or profiled by this thread.
+    if(types != nullptr && types->size() == 1 && !memoize
+        && this->profiler == nullptr)
+    {
+      return this->queueCall(call, function, (*types)[0]);
+    }
+
+    // Otherwise only the workers of its types must finish first, since the
+    // call touches no other type.
+    if(UNLIKELY(!this->synchronizeTypes(types))) { return false; }
+  }
+
+  if(memoize) { return this->memoizeCall(call, function); }
+
+  return this->evaluateCall(call, function, nullptr);
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::synchronizeTypes(
+    std::vector<type_idx> const* const types)
+{
+  if(types == nullptr) { return this->synchronize(); }
+
+  bool ret = true;
+  for(size_t i = 0; i < types->size(); i++)
+  {
+    if(UNLIKELY(!this->workers[(size_t) (*types)[i]]->synchronize()))
+    {
+      ret = false;
+    }
+  }
+
+  return ret;
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::queueCall(
+    wtk::circuit::FunctionCall const* const call,
+    Function<Number_T>* const function, type_idx const type)
+{
+  if(this->callers.size() < this->workers.size())
+  {
+    this->callers.resize(this->workers.size());
+  }
+
+  std::unique_ptr<Interpreter<Number_T>>& caller =
+    this->callers[(size_t) type];
+  if(caller == nullptr)
+  {
+    caller.reset(new Interpreter<Number_T>(this->fileName));
+    caller->borrowed = true;
+
+    for(size_t i = 0; i < this->interpreters.size(); i++)
+    {
+      caller->interpreters.emplace_back(this->interpreters[i].get());
+    }
+  }
+
+  return this->workers[(size_t) type]->call(
+      call, function, caller.get(), this->lineNum);
+}
+
+template<typename Number_T>
+void Interpreter<Number_T>::pushScopes(
+    Function<Number_T> const* const function)
+{
+  std::vector<type_idx> const* const types = function->usedTypes();
+  size_t const n = types == nullptr ? this->interpreters.size() : types->size();
+
+  for(size_t i = 0; i < n; i++)
+  {
+    size_t const type = types == nullptr ? i : (size_t) (*types)[i];
+    this->interpreters[type]->lineNum = this->lineNum;
+    this->interpreters[type]->push();
+  }
+}
 
+template<typename Number_T>
+void Interpreter<Number_T>::popScopes(
+    Function<Number_T> const* const function)
+{
+  std::vector<type_idx> const* const types = function->usedTypes();
+  size_t const n = types == nullptr ? this->interpreters.size() : types->size();
+
+  for(size_t i = 0; i < n; i++)
+  {
+    size_t const type = types == nullptr ? i : (size_t) (*types)[i];
+    this->interpreters[type]->pop();
+  }
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::memoizeCall(
+    wtk::circuit::FunctionCall const* const call,
+    Function<Number_T>* const function)
+{
+  std::vector<type_idx> const* const types = function->pureTypes();
+
+  bool memoizable = true;
+  for(size_t i = 0; i < types->size() && memoizable; i++)
+  {
+    memoizable = this->interpreters[(size_t) (*types)[i]]->memoizable();
+  }
+
+  // The key is the function's address, followed by its inputs' values.
+  std::string key((char const*) &function, sizeof(function));
+  for(size_t i = 0; i < call->inputs.size() && memoizable; i++)
+  {
+    TypeInterpreter<Number_T>* const type_interpreter =
+      this->interpreters[(size_t) function->signature.inputs[i].type].get();
+    type_interpreter->lineNum = this->lineNum;
+    memoizable = type_interpreter->memoKey(
+        call->inputs[i].first, call->inputs[i].last, &key);
+  }
+
+  // Unassigned inputs are reported by the call itself.
+  if(!memoizable) { return this->evaluateCall(call, function, nullptr); }
+
+  MemoEntry<Number_T> const* const hit = this->memoizer->find(key);
+  if(hit != nullptr)
+  {
+    for(size_t i = 0; i < types->size(); i++)
+    {
+      this->interpreters[(size_t) (*types)[i]]->replayMemo(
+          hit->records[i].get());
+    }
+
+    return this->evaluateCall(call, function, hit->outputs.data());
+  }
+
+  MemoEntry<Number_T> entry;
+  for(size_t i = 0; i < types->size(); i++)
+  {
+    entry.records.push_back(
+        this->interpreters[(size_t) (*types)[i]]->beginMemo());
+  }
+
+  bool const ret = this->evaluateCall(call, function, nullptr);
+
+  for(size_t i = 0; i < types->size(); i++)
+  {
+    this->interpreters[(size_t) (*types)[i]]->endMemo(entry.records[i].get());
+  }
+
+  if(ret)
+  {
+    for(size_t i = 0; i < call->outputs.size(); i++)
+    {
+      this->interpreters[(size_t) function->signature.outputs[i].type]
+        ->memoRead(call->outputs[i].first, call->outputs[i].last,
+            &entry.outputs);
+    }
+
+    this->memoizer->insert(std::move(key), std::move(entry));
+  }
+
+  return ret;
+}
+
+template<typename Number_T>
+bool Interpreter<Number_T>::evaluateCall(
+    wtk::circuit::FunctionCall const* const call,
+    Function<Number_T>* const function, Number_T const* outputs)
+{
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->trace)
+  {
+    log_info("    %s:%zu: %s@call(%s)", this->fileName, this->lineNum,
+        this->indent.get(), call->name.c_str());
+    this->indent.inc();
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+  this->pushScopes(function);
+
+  for(size_t i = 0; i < call->outputs.size(); i++)
+  {
+    if(UNLIKELY(
+        !this->interpreters[(size_t) function->signature.outputs[i].type]
+        ->mapOutput(call->outputs[i].first, call->outputs[i].last)))
+    {
+      return false;
+    }
+  }
+
+  for(size_t i = 0; i < call->inputs.size(); i++)
+  {
     if(UNLIKELY(
         !this->interpreters[(size_t) function->signature.inputs[i].type]
         ->mapInput(call->inputs[i].first, call->inputs[i].last)))
@@ -532,9 +826,33 @@ bool Interpreter<Number_T>::invoke(
 #endif//WTK_NAILS_ENABLE_TRACES
 
   bool ret = true;
-  if(UNLIKELY(!function->evaluate(this)))
+  if(outputs == nullptr)
   {
-    ret = false;
+    this->callDepth++;
+    if(UNLIKELY(!function->evaluate(this)))
+    {
+      ret = false;
+    }
+    this->callDepth--;
+  }
+  else
+  {
+    std::vector<wire_idx> assign_places(this->interpreters.size(), 0);
+    for(size_t i = 0; i < function->signature.outputs.size(); i++)
+    {
+      size_t const type = (size_t) function->signature.outputs[i].type;
+      wire_idx const first = assign_places[type];
+      wire_idx const last = first + function->signature.outputs[i].length - 1;
+
+      if(UNLIKELY(
+            !this->interpreters[type]->memoAssign(first, last, outputs)))
+      {
+        ret = false;
+      }
+
+      outputs += function->signature.outputs[i].length;
+      assign_places[type] = last + 1;
+    }
   }
 
   std::vector<wire_idx> places(this->interpreters.size(), 0);
@@ -550,10 +868,7 @@ bool Interpreter<Number_T>::invoke(
     }
   }
 
-  for(size_t i = 0; i < this->interpreters.size(); i++)
-  {
-    this->interpreters[i]->pop();
-  }
+  this->popScopes(function);
 
 #ifdef WTK_NAILS_ENABLE_TRACES
   this->lineNum = trace_line_num;
@@ -568,4 +883,16 @@ bool Interpreter<Number_T>::invoke(
   return ret;
 }
 
+template<typename Number_T>
+Interpreter<Number_T>::~Interpreter()
+{
+  if(this->borrowed)
+  {
+    for(size_t i = 0; i < this->interpreters.size(); i++)
+    {
+      (void) this->interpreters[i].release();
+    }
+  }
+}
+
 } } // namespace wtk::nails
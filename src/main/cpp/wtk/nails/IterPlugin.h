@@ -6,8 +6,10 @@
 #define WTK_NAILS_ITER_PLUGIN_H_
 
 #include <cstddef>
+#include <cstdlib>
 #include <vector>
 #include <memory>
+#include <thread>
 
 #include <wtk/indexes.h>
 #include <wtk/plugins/Plugin.h>
@@ -40,7 +42,13 @@ struct MapOperation : public wtk::plugins::Operation<Number_T>
 {
   Interpreter<Number_T>* const interpreter;
 
-  MapOperation(Interpreter<Number_T>* const i) : interpreter(i) { }
+  // Number of threads for map iterations. Iterations are split across
+  // threads only if the mapped function and all TypeBackends are
+  // thread-safe (see Function::threadSafe() and TypeBackend::threadSafe()).
+  size_t const threads;
+
+  MapOperation(Interpreter<Number_T>* const i, size_t const t = 1)
+    : interpreter(i), threads(t) { }
 
   template<typename Wire_T>
   std::unique_ptr<wtk::plugins::Plugin<Number_T, Wire_T>> makePlugin();
@@ -53,6 +61,20 @@ struct MapOperation : public wtk::plugins::Operation<Number_T>
 
   bool typeCheck(wtk::circuit::FunctionSignature const* const signature,
       wtk::circuit::PluginBinding<Number_T> const* const binding);
+
+  // Fork n Interpreters from the plugin's scope, or return false if any
+  // type can't be forked.
+  bool fork(std::vector<std::unique_ptr<Interpreter<Number_T>>>* const forks,
+      size_t const n);
+
+  // Evaluate iterations iter_first through iter_last - 1, reusing a single
+  // call frame.
+  void iterations(Interpreter<Number_T>* const interp,
+      Function<Number_T>* const func,
+      wtk::circuit::FunctionSignature const* const signature,
+      bool const enumerated, size_t const env_count, wire_idx const iter_count,
+      wire_idx const iter_first, wire_idx const iter_last,
+      Number_T const& enum_max);
 };
 
 } } // namespace wtk::nails
@@ -89,240 +89,370 @@ void MapOperation<Number_T>::evaluate(
     places[type] = last + 1;
   }
 
-  wtk::wire_idx enum_place = UINT64_MAX;
   wtk::type_idx const enum_type =
     (enumerated) ? func_sig->inputs[env_count].type : 0;
-  wtk::wire_idx const enum_length =
-    (enumerated) ? func_sig->inputs[env_count].length : 0;
   Number_T enum_max = (enumerated)
     ? this->interpreter->interpreters[
         (size_t) enum_type]->getMaxValForIterPlugin()
     : 0;
 
-  // loop for iterations
-  for(wtk::wire_idx j = 0; j < iter_count; j++)
-  {
+  // Iterations are data-independent, so they may be split into chunks,
+  // each evaluated by its own thread on a forked Interpreter.
+  bool tracing = false;
 #ifdef WTK_NAILS_ENABLE_TRACES
-    if(this->interpreter->trace)
-    {
-      log_info("       %s:%zu: %siteration %" PRIu64 "",
-          this->interpreter->fileName, this->interpreter->lineNum,
-          this->interpreter->indent.get(), j);
-      log_info("       %s:%zu: %s@call(%s)", this->interpreter->fileName,
-          this->interpreter->lineNum, this->interpreter->indent.get(),
-          func_sig->name.c_str());
-      this->interpreter->indent.inc();
-    }
+  tracing = this->interpreter->trace || this->interpreter->traceDetail;
 #endif//WTK_NAILS_ENABLE_TRACES
-    log_assert(signature->inputs.size() + (enumerated ? 1 : 0)
-        == func_sig->inputs.size());
 
-    // Check if work needs to be done in enumerating the loop index
-    wtk::wire_idx enum_first = 0;
-    wtk::wire_idx enum_last = 0;
-    if(enumerated)
-    {
-      enum_last = enum_place;
-      enum_first = enum_place + 1 - enum_length;
-      enum_place = enum_place - enum_length;
+  size_t const num_threads = (iter_count < (wire_idx) this->threads)
+    ? (size_t) iter_count : this->threads;
+  std::vector<std::unique_ptr<Interpreter<Number_T>>> forks;
 
-      if(enum_length == 1)
-      {
-        Number_T j_num = j;
-        this->interpreter->assign(
-            enum_first, j_num % enum_max, enum_type);
-      }
-      else
+  if(num_threads > 1 && !tracing && func->threadSafe()
+      && this->fork(&forks, num_threads))
+  {
+    auto chunk = [&](size_t const c)
+    {
+      this->iterations(forks[c].get(), func, signature, enumerated,
+          env_count, iter_count, iter_count * c / num_threads,
+          iter_count * (c + 1) / num_threads, enum_max);
+    };
+
+    std::vector<std::thread> pool;
+    for(size_t c = 1; c < num_threads; c++) { pool.emplace_back(chunk, c); }
+    chunk(0);
+    for(size_t c = 0; c < pool.size(); c++) { pool[c].join(); }
+
+    // Each fork assigned a disjoint slice of the outputs.
+    for(size_t c = 0; c < forks.size(); c++)
+    {
+      for(size_t i = 0; i < places.size(); i++)
       {
-        this->interpreter->newRange(enum_first, enum_last, enum_type);
-        wtk::wire_idx alt_j = j;
-        for(wtk::wire_idx i = enum_last; i >= enum_first; i--)
-        {
-          this->interpreter->assign(i, Number_T(alt_j & 1), enum_type);
-          alt_j = alt_j >> 1;
-        }
+        if(places[i] == 0) { continue; }
+        this->interpreter->interpreters[i]->join(
+            forks[c]->interpreters[i].get(), 0, places[i] - 1);
       }
     }
 
-    // Zero out the places vector and push new scopes to each type's stacks
+    return;
+  }
+
+  this->iterations(this->interpreter, func, signature, enumerated,
+      env_count, iter_count, 0, iter_count, enum_max);
+}
+
+template<typename Number_T>
+bool MapOperation<Number_T>::fork(
+    std::vector<std::unique_ptr<Interpreter<Number_T>>>* const forks,
+    size_t const n)
+{
+  for(size_t c = 0; c < n; c++)
+  {
+    forks->emplace_back(new Interpreter<Number_T>(this->interpreter->fileName));
+    forks->back()->lineNum = this->interpreter->lineNum;
+
     for(size_t i = 0; i < this->interpreter->interpreters.size(); i++)
     {
-      places[i] = 0;
-      this->interpreter->interpreters[i]->push();
+      std::unique_ptr<TypeInterpreter<Number_T>> forked =
+        this->interpreter->interpreters[i]->fork();
+      if(forked == nullptr) { return false; }
+
+      forks->back()->interpreters.emplace_back(std::move(forked));
     }
+  }
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-    std::vector<wtk::wire_idx> inside_places(
-        this->interpreter->interpreters.size(), 0);
-#endif//WTK_NAILS_ENABLE_TRACES
+  return true;
+}
 
-    // Remap outputs
-    for(size_t i = 0; i < signature->outputs.size(); i++)
-    {
-      log_assert(signature->outputs[i].type == func_sig->outputs[i].type);
-      log_assert(signature->outputs[i].length
-          == iter_count * func_sig->outputs[i].length);
+template<typename Number_T>
+void MapOperation<Number_T>::iterations(Interpreter<Number_T>* const interp,
+    Function<Number_T>* const func,
+    wtk::circuit::FunctionSignature const* const signature,
+    bool const enumerated, size_t const env_count, wire_idx const iter_count,
+    wire_idx const iter_first, wire_idx const iter_last,
+    Number_T const& enum_max)
+{
+  if(iter_first >= iter_last) { return; }
 
-      size_t const type = (size_t) signature->outputs[i].type;
-      wtk::wire_idx const func_first =
-        places[type] + j * func_sig->outputs[i].length;
-      wtk::wire_idx const func_last =
-        places[type] + (j + 1) * func_sig->outputs[i].length - 1;
+  wtk::circuit::FunctionSignature const* const func_sig = &func->signature;
+  wtk::type_idx const enum_type =
+    (enumerated) ? func_sig->inputs[env_count].type : 0;
+  wtk::wire_idx const enum_length =
+    (enumerated) ? func_sig->inputs[env_count].length : 0;
+  size_t const num_types = interp->interpreters.size();
+
+  log_assert(signature->inputs.size() + (enumerated ? 1 : 0)
+      == func_sig->inputs.size());
+
+  // The callee's frame is mapped once, for the first iteration, and reused
+  // by the remaining iterations. Parameters which are iterated over advance
+  // through the plugin's ranges by their length.
+  struct Param
+  {
+    size_t type;
+    size_t idx;
+    wire_idx length;
+  };
+  std::vector<Param> strided;
+
+  // Caller's wire index of each type's next parameter.
+  std::vector<wtk::wire_idx> places(num_types, 0);
+
+  // Number of parameters (remapped ranges) and wires in each type's frame.
+  std::vector<size_t> params(num_types, 0);
+  std::vector<wtk::wire_idx> frame_places(num_types, 0);
+
+  for(size_t i = 0; i < num_types; i++) { interp->interpreters[i]->push(); }
+
+  // Remap outputs
+  for(size_t i = 0; i < signature->outputs.size(); i++)
+  {
+    log_assert(signature->outputs[i].type == func_sig->outputs[i].type);
+    log_assert(signature->outputs[i].length
+        == iter_count * func_sig->outputs[i].length);
+
+    size_t const type = (size_t) signature->outputs[i].type;
+    wtk::wire_idx const length = func_sig->outputs[i].length;
+    wtk::wire_idx const func_first = places[type] + iter_first * length;
 
-      this->interpreter->interpreters[type]->mapOutput(func_first, func_last);
+    interp->interpreters[type]->mapOutput(
+        func_first, func_first + length - 1);
 
 #ifdef WTK_NAILS_ENABLE_TRACES
-      if(this->interpreter->traceDetail)
-      {
-        wtk::wire_idx f = inside_places[(size_t) func_sig->outputs[i].type];
-        wtk::wire_idx l = f + func_sig->outputs[i].length - 1;
-        log_info("       %s:%zu: %sremapped output: %" PRIu8 ": $%" PRIu64
-            " ... $%" PRIu64 " -> $%" PRIu64 " ... $%" PRIu64 "",
-            this->interpreter->fileName, this->interpreter->lineNum,
-            this->interpreter->indent.get(), func_sig->outputs[i].type,
-            func_first, func_last, f, l);
-        inside_places[(size_t) func_sig->outputs[i].type] = l + 1;
-      }
+    if(interp->traceDetail)
+    {
+      wtk::wire_idx const f = frame_places[type];
+      log_info("       %s:%zu: %sremapped output: %" PRIu8 ": $%" PRIu64
+          " ... $%" PRIu64 " -> $%" PRIu64 " ... $%" PRIu64 "",
+          interp->fileName, interp->lineNum, interp->indent.get(),
+          func_sig->outputs[i].type, func_first, func_first + length - 1,
+          f, f + length - 1);
+    }
 #endif//WTK_NAILS_ENABLE_TRACES
 
-      places[type] += signature->outputs[i].length;
-    }
+    strided.push_back(Param{ type, params[type], length });
 
-    // Remap inputs
-    size_t plugin_place = 0;
-    size_t iter_place = 0;
-    for(size_t i = 0; i < env_count; i++)
-    {
-      log_assert(signature->inputs[plugin_place].type
-          == func_sig->inputs[iter_place].type);
-      log_assert(signature->inputs[plugin_place].length
-          == func_sig->inputs[iter_place].length);
+    places[type] += signature->outputs[i].length;
+    params[type]++;
+    frame_places[type] += length;
+  }
 
-      size_t const type = (size_t) signature->inputs[plugin_place].type;
-      wtk::wire_idx const func_first = places[type];
-      wtk::wire_idx const func_last =
-        func_first + func_sig->inputs[iter_place].length - 1;
+  // Wires after the outputs are inputs, which remain assigned between
+  // iterations.
+  std::vector<wtk::wire_idx> const inputs_first = frame_places;
 
-      this->interpreter->interpreters[type]->mapInput(func_first, func_last);
+  // Remap inputs
+  size_t plugin_place = 0;
+  size_t iter_place = 0;
+  for(size_t i = 0; i < env_count; i++)
+  {
+    log_assert(signature->inputs[plugin_place].type
+        == func_sig->inputs[iter_place].type);
+    log_assert(signature->inputs[plugin_place].length
+        == func_sig->inputs[iter_place].length);
+
+    size_t const type = (size_t) signature->inputs[plugin_place].type;
+    wtk::wire_idx const length = func_sig->inputs[iter_place].length;
+
+    interp->interpreters[type]->mapInput(
+        places[type], places[type] + length - 1);
 
 #ifdef WTK_NAILS_ENABLE_TRACES
-      if(this->interpreter->traceDetail)
-      {
-        wtk::wire_idx f =
-          inside_places[(size_t) func_sig->inputs[iter_place].type];
-        wtk::wire_idx l = f + func_sig->inputs[iter_place].length - 1;
-        log_info("       %s:%zu: %sremapped input: %" PRIu8 ": $%" PRIu64
-            " ... $%" PRIu64 " -> $%" PRIu64 " ... $%" PRIu64 "",
-            this->interpreter->fileName, this->interpreter->lineNum,
-            this->interpreter->indent.get(), func_sig->inputs[iter_place].type,
-            func_first, func_last, f, l);
-        inside_places[(size_t) func_sig->inputs[iter_place].type] = l + 1;
-      }
+    if(interp->traceDetail)
+    {
+      wtk::wire_idx const f = frame_places[type];
+      log_info("       %s:%zu: %sremapped input: %" PRIu8 ": $%" PRIu64
+          " ... $%" PRIu64 " -> $%" PRIu64 " ... $%" PRIu64 "",
+          interp->fileName, interp->lineNum, interp->indent.get(),
+          func_sig->inputs[iter_place].type, places[type],
+          places[type] + length - 1, f, f + length - 1);
+    }
 #endif//WTK_NAILS_ENABLE_TRACES
 
-      places[type] += signature->inputs[iter_place].length;
-      plugin_place++;
-      iter_place++;
-    }
+    places[type] += signature->inputs[plugin_place].length;
+    params[type]++;
+    frame_places[type] += length;
+    plugin_place++;
+    iter_place++;
+  }
 
-    if(enumerated)
-    {
-      this->interpreter->interpreters[enum_type]->mapInput(
-          enum_first, enum_last);
+  // The loop index is held in wires outside of any scope, and reassigned
+  // by each iteration. Bits of a multi-wire index are big-endian.
+  void* enum_wires = nullptr;
+  void* bits[2] = { nullptr, nullptr };
+  TypeInterpreter<Number_T>* const enum_interp = (enumerated)
+    ? interp->interpreters[(size_t) enum_type].get()
+    : nullptr;
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-      if(this->interpreter->traceDetail)
+  auto assign_enum = [&](wtk::wire_idx const j)
+  {
+    if(enum_length == 1)
+    {
+      Number_T j_num = j;
+      void* const value = enum_interp->prepareConstant(j_num % enum_max);
+      enum_interp->frameAssign(&enum_wires, frameSlot(0, 0), value);
+      enum_interp->releaseConstant(value);
+    }
+    else
+    {
+      wtk::wire_idx alt_j = j;
+      for(wtk::wire_idx i = enum_length; i > 0; i--)
       {
-        wtk::wire_idx f =
-          inside_places[(size_t) func_sig->inputs[iter_place].type];
-        wtk::wire_idx l = f + func_sig->inputs[iter_place].length - 1;
-        log_info("       %s:%zu: %sremapped input: %" PRIu8 ": $%" PRIu64
-            " ... $%" PRIu64 " -> $%" PRIu64 " ... $%" PRIu64 "",
-            this->interpreter->fileName, this->interpreter->lineNum,
-            this->interpreter->indent.get(), func_sig->inputs[iter_place].type,
-            enum_first, enum_last, f, l);
-        inside_places[(size_t) func_sig->inputs[iter_place].type] = l + 1;
+        enum_interp->frameAssign(
+            &enum_wires, frameSlot(0, i - 1), bits[alt_j & 1]);
+        alt_j = alt_j >> 1;
       }
-#endif//WTK_NAILS_ENABLE_TRACES
+    }
+  };
+
+  if(enumerated)
+  {
+    enum_wires = enum_interp->allocateFrame((size_t) enum_length);
+    log_assert(enum_wires != nullptr);
 
-      iter_place++;
+    if(enum_length != 1)
+    {
+      bits[0] = enum_interp->prepareConstant(Number_T(0));
+      bits[1] = enum_interp->prepareConstant(Number_T(1));
     }
 
-    for(size_t i = iter_place; i < func_sig->inputs.size(); i++)
+    assign_enum(iter_first);
+    enum_interp->mapFrameInput(enum_wires, (size_t) enum_length);
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+    if(interp->traceDetail)
     {
-      log_assert(signature->inputs[plugin_place].type
-          == func_sig->inputs[iter_place].type);
-      log_assert(signature->inputs[plugin_place].length
-          == func_sig->inputs[iter_place].length * iter_count);
+      wtk::wire_idx const f = frame_places[(size_t) enum_type];
+      log_info("       %s:%zu: %senumerated input: %" PRIu8
+          ": -> $%" PRIu64 " ... $%" PRIu64 "",
+          interp->fileName, interp->lineNum, interp->indent.get(),
+          enum_type, f, f + enum_length - 1);
+    }
+#endif//WTK_NAILS_ENABLE_TRACES
 
-      size_t const type = (size_t) signature->inputs[plugin_place].type;
-      wtk::wire_idx const func_first =
-        places[type] + j * func_sig->inputs[plugin_place].length;
-      wtk::wire_idx const func_last =
-        places[type] + (j + 1) * func_sig->inputs[plugin_place].length - 1;
+    params[(size_t) enum_type]++;
+    frame_places[(size_t) enum_type] += enum_length;
+    iter_place++;
+  }
 
-      this->interpreter->interpreters[type]->mapInput(func_first, func_last);
+  for(size_t i = iter_place; i < func_sig->inputs.size(); i++)
+  {
+    log_assert(signature->inputs[plugin_place].type
+        == func_sig->inputs[iter_place].type);
+    log_assert(signature->inputs[plugin_place].length
+        == func_sig->inputs[iter_place].length * iter_count);
+
+    size_t const type = (size_t) signature->inputs[plugin_place].type;
+    wtk::wire_idx const length = func_sig->inputs[iter_place].length;
+    wtk::wire_idx const func_first = places[type] + iter_first * length;
+
+    interp->interpreters[type]->mapInput(
+        func_first, func_first + length - 1);
 
 #ifdef WTK_NAILS_ENABLE_TRACES
-      if(this->interpreter->traceDetail)
+    if(interp->traceDetail)
+    {
+      wtk::wire_idx const f = frame_places[type];
+      log_info("       %s:%zu: %sremapped input: %" PRIu8 ": $%" PRIu64
+          " ... $%" PRIu64 " -> $%" PRIu64 " ... $%" PRIu64 "",
+          interp->fileName, interp->lineNum, interp->indent.get(),
+          func_sig->inputs[iter_place].type, func_first,
+          func_first + length - 1, f, f + length - 1);
+    }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+    strided.push_back(Param{ type, params[type], length });
+
+    places[type] += signature->inputs[plugin_place].length;
+    params[type]++;
+    frame_places[type] += length;
+    plugin_place++;
+    iter_place++;
+  }
+
+  std::vector<wtk::wire_idx> out_places(num_types, 0);
+  std::vector<wtk::wire_idx> frame_outs(num_types, 0);
+
+  // loop for iterations
+  for(wtk::wire_idx j = iter_first; j < iter_last; j++)
+  {
+    if(j != iter_first)
+    {
+      for(size_t i = 0; i < num_types; i++)
       {
-        wtk::wire_idx f =
-          inside_places[(size_t) func_sig->inputs[iter_place].type];
-        wtk::wire_idx l = f + func_sig->inputs[iter_place].length - 1;
-        log_info("       %s:%zu: %sremapped input: %" PRIu8 ": $%" PRIu64
-            " ... $%" PRIu64 " -> $%" PRIu64 " ... $%" PRIu64 "",
-            this->interpreter->fileName, this->interpreter->lineNum,
-            this->interpreter->indent.get(), func_sig->inputs[iter_place].type,
-            func_first, func_last, f, l);
-        inside_places[(size_t) func_sig->inputs[iter_place].type] = l + 1;
+        interp->interpreters[i]->resetFrame(inputs_first[i]);
       }
-#endif//WTK_NAILS_ENABLE_TRACES
 
-      places[type] += signature->inputs[iter_place].length;
-      plugin_place++;
-      iter_place++;
+      for(size_t i = 0; i < strided.size(); i++)
+      {
+        interp->interpreters[strided[i].type]->advanceFrame(
+            strided[i].idx, strided[i].length);
+      }
+
+      if(enumerated)
+      {
+        enum_interp->frameDestroy(&enum_wires, frameSlot(0, 0), enum_length);
+        assign_enum(j);
+      }
+    }
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+    if(interp->trace)
+    {
+      log_info("       %s:%zu: %siteration %" PRIu64 "",
+          interp->fileName, interp->lineNum, interp->indent.get(), j);
+      log_info("       %s:%zu: %s@call(%s)", interp->fileName,
+          interp->lineNum, interp->indent.get(), func_sig->name.c_str());
+      interp->indent.inc();
     }
+#endif//WTK_NAILS_ENABLE_TRACES
 
     // invoke the function
-    func->evaluate(this->interpreter);
+    func->evaluate(interp);
 
     // check the outputs
-    for(size_t i = 0; i < places.size(); i++) { places[i] = 0; }
-    std::vector<wtk::wire_idx> more_places(places.size(), 0);
+    for(size_t i = 0; i < num_types; i++)
+    {
+      out_places[i] = 0;
+      frame_outs[i] = 0;
+    }
 
     for(size_t i = 0; i < func_sig->outputs.size(); i++)
     {
       size_t const type = (size_t) func_sig->outputs[i].type;
       wtk::wire_idx const func_first =
-        places[type] + j * func_sig->outputs[i].length;
+        out_places[type] + j * func_sig->outputs[i].length;
       wtk::wire_idx const func_last =
-        places[type] + (j + 1) * func_sig->outputs[i].length - 1;
+        out_places[type] + (j + 1) * func_sig->outputs[i].length - 1;
 
-      this->interpreter->interpreters[type]->checkOutput(
-          func_first, func_last, &more_places[type]);
+      interp->interpreters[type]->checkOutput(
+          func_first, func_last, &frame_outs[type]);
 
-      places[i] += signature->outputs[i].length;
+      out_places[type] += signature->outputs[i].length;
     }
 
-    for(size_t i = 0; i < this->interpreter->interpreters.size(); i++)
+#ifdef WTK_NAILS_ENABLE_TRACES
+    if(interp->trace)
     {
-      this->interpreter->interpreters[i]->pop();
+      interp->indent.dec();
+      log_info("       %s:%zu: %s@end (%s)", interp->fileName,
+          interp->lineNum, interp->indent.get(),
+          func_sig->name.c_str());
     }
+#endif//WTK_NAILS_ENABLE_TRACES
+  }
 
-    if(enumerated)
-    {
-      this->interpreter->deleteRange(enum_first, enum_last, enum_type);
-    }
+  for(size_t i = 0; i < num_types; i++) { interp->interpreters[i]->pop(); }
 
-#ifdef WTK_NAILS_ENABLE_TRACES
-    if(this->interpreter->trace)
+  if(enumerated)
+  {
+    enum_interp->frameDestroy(&enum_wires, frameSlot(0, 0), enum_length);
+    free(enum_wires);
+
+    if(enum_length != 1)
     {
-      this->interpreter->indent.dec();
-      log_info("       %s:%zu: %s@end (%s)", this->interpreter->fileName,
-          this->interpreter->lineNum, this->interpreter->indent.get(),
-          func_sig->name.c_str());
+      enum_interp->releaseConstant(bits[0]);
+      enum_interp->releaseConstant(bits[1]);
     }
-#endif//WTK_NAILS_ENABLE_TRACES
   }
 }
 
@@ -0,0 +1,103 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_NAILS_MEMOIZER_H_
+#define WTK_NAILS_MEMOIZER_H_
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <wtk/TypeBackend.h>
+
+namespace wtk {
+namespace nails {
+
+/**
+ * The memoized result of a pure function call (see Function::pureTypes()).
+ */
+template<typename Number_T>
+struct MemoEntry
+{
+  // Values of the call's outputs, in order of the function's signature.
+  std::vector<Number_T> outputs;
+
+  // Side effects of the call, one per type of the function's pureTypes().
+  std::vector<std::unique_ptr<wtk::MemoRecord>> records;
+};
+
+/**
+ * The Memoizer is a least-recently-used cache of pure function calls, for
+ * use by an Interpreter (see Interpreter::memoizer). A key is the function
+ * and the values of the call's inputs, as encoded by each type's backend.
+ *
+ * Its size is bounded by an estimate of the bytes held by each entry. The
+ * estimate counts the fixed size of each output, so it is low for numbers
+ * with heap-allocated limbs.
+ */
+template<typename Number_T>
+class Memoizer
+{
+  struct Node
+  {
+    std::string key;
+    MemoEntry<Number_T> entry;
+    size_t bytes;
+
+    Node(std::string&& k, MemoEntry<Number_T>&& e, size_t const b)
+      : key(std::move(k)), entry(std::move(e)), bytes(b) { }
+  };
+
+  size_t const capacity;
+  size_t size = 0;
+
+  // Most recently used first.
+  std::list<Node> nodes;
+  std::unordered_map<std::string, typename std::list<Node>::iterator> index;
+
+public:
+  size_t hits = 0;
+  size_t misses = 0;
+  size_t evictions = 0;
+
+  // Construct a Memoizer holding up to capacity bytes of entries.
+  Memoizer(size_t const cap) : capacity(cap) { }
+
+  Memoizer(Memoizer const&) = delete;
+  Memoizer& operator=(Memoizer const&) = delete;
+
+  /**
+   * Find the entry for a key, and mark it as most recently used. Returns
+   * nullptr on a miss. The entry is valid until the next insert().
+   */
+  MemoEntry<Number_T> const* find(std::string const& key);
+
+  /**
+   * Insert an entry, evicting the least recently used entries until it
+   * fits. An entry larger than the capacity is discarded.
+   */
+  void insert(std::string&& key, MemoEntry<Number_T>&& entry);
+
+  // Approximate bytes held by the cache's entries.
+  size_t bytes() const { return this->size; }
+
+  // Log the counts of hits, misses and evictions.
+  void print() const;
+};
+
+} } // namespace wtk::nails
+
+#define LOG_IDENTIFIER "wtk::nails"
+#include <stealth_logging.h>
+
+#include <wtk/nails/Memoizer.t.h>
+
+#define LOG_UNINCLUDE
+#include <stealth_logging.h>
+
+#endif//WTK_NAILS_MEMOIZER_H_
@@ -0,0 +1,62 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+namespace wtk {
+namespace nails {
+
+template<typename Number_T>
+MemoEntry<Number_T> const* Memoizer<Number_T>::find(std::string const& key)
+{
+  auto finder = this->index.find(key);
+  if(finder == this->index.end())
+  {
+    this->misses++;
+    return nullptr;
+  }
+
+  this->hits++;
+  this->nodes.splice(this->nodes.begin(), this->nodes, finder->second);
+  return &finder->second->entry;
+}
+
+template<typename Number_T>
+void Memoizer<Number_T>::insert(
+    std::string&& key, MemoEntry<Number_T>&& entry)
+{
+  // The key is held twice, by the node and by the index.
+  size_t bytes = sizeof(Node) + 2 * key.size()
+    + entry.outputs.size() * sizeof(Number_T);
+  for(size_t i = 0; i < entry.records.size(); i++)
+  {
+    if(entry.records[i] != nullptr) { bytes += entry.records[i]->bytes(); }
+  }
+
+  if(bytes > this->capacity || this->index.find(key) != this->index.end())
+  {
+    return;
+  }
+
+  while(this->size + bytes > this->capacity)
+  {
+    this->size -= this->nodes.back().bytes;
+    this->index.erase(this->nodes.back().key);
+    this->nodes.pop_back();
+    this->evictions++;
+  }
+
+  this->nodes.emplace_front(std::move(key), std::move(entry), bytes);
+  this->index.emplace(this->nodes.front().key, this->nodes.begin());
+  this->size += bytes;
+}
+
+template<typename Number_T>
+void Memoizer<Number_T>::print() const
+{
+  log_info("Memoized calls: %zu hits, %zu misses, %zu evictions",
+      this->hits, this->misses, this->evictions);
+  log_info("Memo cache:     %zu entries, %zu bytes",
+      this->nodes.size(), this->size);
+}
+
+} } // namespace wtk::nails
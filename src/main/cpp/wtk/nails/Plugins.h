@@ -11,6 +11,7 @@
 
 #include <wtk/indexes.h>
 #include <wtk/nails/Functions.h>
+#include <wtk/nails/Profiler.h>
 
 #include <wtk/circuit/Data.h>
 #include <wtk/plugins/Plugin.h>
@@ -28,12 +29,47 @@ struct PluginFunction : public Function<Number_T>
   wtk::circuit::PluginBinding<Number_T> const binding;
 
   PluginFunction(wtk::circuit::FunctionSignature&& sig,
-      wtk::circuit::PluginBinding<Number_T>&& b)
-    : Function<Number_T>(std::move(sig)), binding(std::move(b)) { }
+      wtk::circuit::PluginBinding<Number_T>&& b);
 
   wtk::plugins::Operation<Number_T>* operation = nullptr;
 
+  // The binding's plugin and operation, as "plugin.operation" for the
+  // Profiler.
+  std::string const operationName;
+
+  // The layout of a parameter within the function's scope: its type, the
+  // index of its remapped range among those of its type, and its wires.
+  struct Parameter
+  {
+    type_idx type;
+    size_t range;
+    wire_idx first;
+    wire_idx last;
+
+    Parameter(type_idx const t, size_t const r,
+        wire_idx const f, wire_idx const l)
+      : type(t), range(r), first(f), last(l) { }
+  };
+
+  // Computed once from the signature.
+  std::vector<Parameter> outputLayout;
+  std::vector<Parameter> inputLayout;
+
+  // Arguments to the operation, refilled by each call without reallocating.
+  // A plugin function is therefore not reentrant, nor thread-safe.
+  std::vector<wtk::plugins::WiresRefEraser> outputs;
+  std::vector<wtk::plugins::WiresRefEraser> inputs;
+
   bool evaluate(Interpreter<Number_T>* const interpreter) final;
+
+  // Buffers held within the plugin operation are not included.
+  size_t bytes() const final
+  {
+    return (this->outputLayout.capacity() + this->inputLayout.capacity())
+        * sizeof(Parameter)
+      + (this->outputs.capacity() + this->inputs.capacity())
+        * sizeof(wtk::plugins::WiresRefEraser);
+  }
 };
 
 
@@ -5,40 +5,73 @@
 namespace wtk {
 namespace nails {
 
+template<typename Number_T>
+PluginFunction<Number_T>::PluginFunction(
+    wtk::circuit::FunctionSignature&& sig,
+    wtk::circuit::PluginBinding<Number_T>&& b)
+  : Function<Number_T>(std::move(sig)), binding(std::move(b)),
+    operationName(this->binding.name + "." + this->binding.operation)
+{
+  // Wires and remapped ranges of each type so far.
+  std::vector<wtk::wire_idx> places;
+  std::vector<size_t> ranges;
+
+  auto layout = [&places, &ranges](
+      std::vector<wtk::circuit::FunctionSignature::Parameter> const& params,
+      std::vector<Parameter>* const out)
+  {
+    out->reserve(params.size());
+    for(size_t i = 0; i < params.size(); i++)
+    {
+      size_t const type = (size_t) params[i].type;
+      if(type >= places.size())
+      {
+        places.resize(type + 1, 0);
+        ranges.resize(type + 1, 0);
+      }
+
+      out->emplace_back(params[i].type, ranges[type],
+          places[type], places[type] + params[i].length - 1);
+
+      places[type] += params[i].length;
+      ranges[type]++;
+    }
+  };
+
+  layout(this->signature.outputs, &this->outputLayout);
+  layout(this->signature.inputs, &this->inputLayout);
+
+  this->outputs.reserve(this->outputLayout.size());
+  this->inputs.reserve(this->inputLayout.size());
+}
+
 template<typename Number_T>
 bool PluginFunction<Number_T>::evaluate(
     Interpreter<Number_T>* const interpreter)
 {
-  std::vector<size_t> places(interpreter->interpreters.size(), 0);
-
-  std::vector<wtk::plugins::WiresRefEraser> outputs;
-  std::vector<wtk::plugins::WiresRefEraser> inputs;
+  ProfileGuard guard(interpreter->profiler, this,
+      this->signature.name.c_str(), this->operationName.c_str());
 
-  outputs.reserve(this->signature.outputs.size());
-  for(size_t i = 0; i < this->signature.outputs.size(); i++)
+  this->outputs.clear();
+  for(size_t i = 0; i < this->outputLayout.size(); i++)
   {
-    size_t const type = (size_t) this->signature.outputs[i].type;
-    wtk::wire_idx first = places[type];
-    wtk::wire_idx last = places[type] + this->signature.outputs[i].length - 1;
-    places[type] += this->signature.outputs[i].length;
-    outputs.push_back(
-        interpreter->interpreters[type]->pluginOutput(
-          (type_idx) type, first, last));
+    Parameter const* const param = &this->outputLayout[i];
+    this->outputs.push_back(
+        interpreter->interpreters[(size_t) param->type]->pluginOutputRange(
+          param->type, param->range, param->first, param->last));
   }
 
-  inputs.reserve(this->signature.inputs.size());
-  for(size_t i = 0; i < this->signature.inputs.size(); i++)
+  this->inputs.clear();
+  for(size_t i = 0; i < this->inputLayout.size(); i++)
   {
-    size_t const type = (size_t) this->signature.inputs[i].type;
-    wtk::wire_idx first = places[type];
-    wtk::wire_idx last = places[type] + this->signature.inputs[i].length - 1;
-    places[type] += this->signature.inputs[i].length;
-    inputs.push_back(
-        interpreter->interpreters[type]->pluginInput(
-          (type_idx) type, first, last));
+    Parameter const* const param = &this->inputLayout[i];
+    this->inputs.push_back(
+        interpreter->interpreters[(size_t) param->type]->pluginInputRange(
+          param->type, param->range, param->first, param->last));
   }
 
-  this->operation->evaluate(outputs, inputs, &this->signature, &this->binding);
+  this->operation->evaluate(
+      this->outputs, this->inputs, &this->signature, &this->binding);
   return true;
 }
 
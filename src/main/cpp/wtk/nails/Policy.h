@@ -0,0 +1,49 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_NAILS_POLICY_H_
+#define WTK_NAILS_POLICY_H_
+
+namespace wtk {
+namespace nails {
+
+/**
+ * A policy selects, at compile time, the per-gate checks and bookkeeping of
+ * the LeadTypeInterpreter (see Interpreter::addType()). A policy is a struct
+ * with the following static constexpr bool members.
+ *
+ *  - checks: Validate the relation. This covers single-assignment and
+ *    wire existence (see Scope::trusted), gates which retrieve and assign
+ *    the same wire, and constants outside of the type. Without checks the
+ *    relation must already be known to be valid, just as in trusted mode
+ *    (see Interpreter::enableTrusted()). Input values are checked either
+ *    way.
+ *
+ *  - lineNumbers: Set the TypeBackend::lineNum before each gate, for the
+ *    backend's error reporting.
+ *
+ *  - traces: Allow the detailed trace of each gate (see
+ *    Interpreter::enableTraceDetail()). Traces also require
+ *    WTK_NAILS_ENABLE_TRACES.
+ */
+
+// Fully checked evaluation, for checking relations (e.g. FIREALARM).
+struct CheckedPolicy
+{
+  static constexpr bool checks = true;
+  static constexpr bool lineNumbers = true;
+  static constexpr bool traces = true;
+};
+
+// Unchecked evaluation, for previously validated relations.
+struct UncheckedPolicy
+{
+  static constexpr bool checks = false;
+  static constexpr bool lineNumbers = false;
+  static constexpr bool traces = false;
+};
+
+} } // namespace wtk::nails
+
+#endif//WTK_NAILS_POLICY_H_
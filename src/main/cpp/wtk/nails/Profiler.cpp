@@ -0,0 +1,225 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <algorithm>
+#include <unordered_map>
+
+#include <wtk/nails/Profiler.h>
+
+#define LOG_IDENTIFIER "wtk::nails"
+#include <stealth_logging.h>
+
+namespace wtk {
+namespace nails {
+
+Profiler::Profiler(char const* const root_name)
+{
+  this->nodes.emplace_back(nullptr, root_name, "", 0);
+  this->nodes[0].calls = 1;
+  this->stack.emplace_back(0, std::chrono::steady_clock::now());
+}
+
+size_t Profiler::child(size_t const parent, void const* const key,
+    char const* const name, char const* const operation)
+{
+  std::vector<size_t> const& children = this->nodes[parent].children;
+  for(size_t i = 0; i < children.size(); i++)
+  {
+    if(this->nodes[children[i]].key == key) { return children[i]; }
+  }
+
+  size_t const idx = this->nodes.size();
+  this->nodes.emplace_back(
+      key, name, operation == nullptr ? "" : operation, parent);
+  this->nodes[parent].children.push_back(idx);
+  return idx;
+}
+
+void Profiler::enter(void const* const key,
+    char const* const name, char const* const operation)
+{
+  log_assert(!this->stack.empty());
+
+  size_t const node =
+    this->child(this->stack.back().node, key, name, operation);
+  this->stack.emplace_back(node, std::chrono::steady_clock::now());
+}
+
+void Profiler::close(uint64_t const gates)
+{
+  uint64_t const elapsed = (uint64_t)
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - this->stack.back().start).count();
+  uint64_t const callees = this->stack.back().callees;
+
+  Node* const node = &this->nodes[this->stack.back().node];
+  node->gates += gates;
+  node->inclusive += elapsed;
+  node->exclusive += elapsed > callees ? elapsed - callees : 0;
+
+  this->stack.pop_back();
+  if(!this->stack.empty()) { this->stack.back().callees += elapsed; }
+}
+
+void Profiler::exit(uint64_t const gates)
+{
+  log_assert(this->stack.size() > 1, "exit without a matching enter");
+
+  this->nodes[this->stack.back().node].calls++;
+  this->close(gates);
+}
+
+void Profiler::finish()
+{
+  log_assert(this->stack.size() == 1, "finish within a function");
+
+  this->close(0);
+}
+
+namespace {
+
+struct Row
+{
+  std::string name;
+  uint64_t calls = 0;
+  uint64_t gates = 0;
+  uint64_t inclusive = 0;
+  uint64_t exclusive = 0;
+};
+
+void logRows(std::vector<Row>* const rows)
+{
+  std::sort(rows->begin(), rows->end(), [](Row const& a, Row const& b)
+      {
+        return a.exclusive > b.exclusive;
+      });
+
+  log_info("%12s %14s %14s %14s  %s",
+      "calls", "incl (ms)", "excl (ms)", "gates", "name");
+  for(size_t i = 0; i < rows->size(); i++)
+  {
+    Row const* const row = &(*rows)[i];
+    log_info("%12" PRIu64 " %14.3f %14.3f %14" PRIu64 "  %s", row->calls,
+        (double) row->inclusive / 1.0e6, (double) row->exclusive / 1.0e6,
+        row->gates, row->name.c_str());
+  }
+}
+
+} // namespace
+
+void Profiler::report() const
+{
+  log_assert(this->stack.empty(), "report before finish");
+
+  // Functions, aggregated over each of their places in the call tree.
+  // Functions are never reentered, so inclusive times do not overlap.
+  std::vector<Row> functions;
+  std::unordered_map<void const*, size_t> function_rows;
+
+  // Plugin operations, aggregated over each function which they back.
+  std::vector<Row> operations;
+  std::unordered_map<std::string, size_t> operation_rows;
+
+  for(size_t i = 0; i < this->nodes.size(); i++)
+  {
+    Node const* const node = &this->nodes[i];
+
+    auto finder = function_rows.find(node->key);
+    if(finder == function_rows.end())
+    {
+      finder = function_rows.emplace(node->key, functions.size()).first;
+      functions.emplace_back();
+      functions.back().name = node->name;
+      if(!node->operation.empty())
+      {
+        functions.back().name += "[" + node->operation + "]";
+      }
+    }
+
+    Row* row = &functions[finder->second];
+    row->calls += node->calls;
+    row->gates += node->gates;
+    row->inclusive += node->inclusive;
+    row->exclusive += node->exclusive;
+
+    if(!node->operation.empty())
+    {
+      auto op_finder = operation_rows.find(node->operation);
+      if(op_finder == operation_rows.end())
+      {
+        op_finder =
+          operation_rows.emplace(node->operation, operations.size()).first;
+        operations.emplace_back();
+        operations.back().name = node->operation;
+      }
+
+      row = &operations[op_finder->second];
+      row->calls += node->calls;
+      row->gates += node->gates;
+      row->inclusive += node->inclusive;
+      row->exclusive += node->exclusive;
+    }
+  }
+
+  log_info("Function Profile");
+  logRows(&functions);
+
+  if(!operations.empty())
+  {
+    log_info("Plugin Operation Profile");
+    logRows(&operations);
+  }
+}
+
+void Profiler::path(size_t const node, std::string* const out) const
+{
+  if(node != 0)
+  {
+    this->path(this->nodes[node].parent, out);
+    out->push_back(';');
+  }
+
+  *out += this->nodes[node].name;
+  if(!this->nodes[node].operation.empty())
+  {
+    *out += "[" + this->nodes[node].operation + "]";
+  }
+}
+
+bool Profiler::writeFolded(char const* const file_name) const
+{
+  log_assert(this->stack.empty(), "writeFolded before finish");
+
+  FILE* const file = fopen(file_name, "w");
+  if(file == nullptr)
+  {
+    log_error("Could not open profile \'%s\' for writing", file_name);
+    return false;
+  }
+
+  bool success = true;
+  std::string line;
+  for(size_t i = 0; i < this->nodes.size() && success; i++)
+  {
+    uint64_t const micros = this->nodes[i].exclusive / 1000;
+    if(micros == 0) { continue; }
+
+    line.clear();
+    this->path(i, &line);
+    success = 0 <= fprintf(file, "%s %" PRIu64 "\n", line.c_str(), micros);
+  }
+
+  if(0 != fclose(file)) { success = false; }
+
+  if(!success)
+  {
+    log_error("Could not write profile \'%s\'", file_name);
+  }
+
+  return success;
+}
+
+} } // namespace wtk::nails
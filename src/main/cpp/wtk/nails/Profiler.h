@@ -0,0 +1,159 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_NAILS_PROFILER_H_
+#define WTK_NAILS_PROFILER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace wtk {
+namespace nails {
+
+/**
+ * The Profiler records the call tree of functions and plugin operations
+ * evaluated by an Interpreter (see Interpreter::profiler). Each node of the
+ * tree is a function, under the chain of functions which called it, and
+ * keeps its call count, inclusive and exclusive wall time, and the count of
+ * gates evaluated directly by the function's body.
+ *
+ * Evaluation calls enter() and exit() (usually with a ProfileGuard) at each
+ * function boundary. A node's children are found by comparing keys (the
+ * Function's address), so that names are only copied when a node is first
+ * created, and the overhead of each call is two clock reads.
+ *
+ * Forked Interpreters (see MapOperation) are not profiled, and their time
+ * is attributed to the map operation which forked them. Top-level gates
+ * are attributed to the root by time only.
+ */
+class Profiler
+{
+  struct Node
+  {
+    // The Function, or nullptr for the root.
+    void const* key;
+
+    // The function's name, and the plugin operation backing it (if any).
+    std::string name;
+    std::string operation;
+
+    size_t parent;
+    std::vector<size_t> children;
+
+    uint64_t calls = 0;
+    uint64_t gates = 0;
+
+    // Wall times, in nanoseconds.
+    uint64_t inclusive = 0;
+    uint64_t exclusive = 0;
+
+    Node(void const* const k, char const* const n, char const* const op,
+        size_t const p)
+      : key(k), name(n), operation(op), parent(p) { }
+  };
+
+  struct Frame
+  {
+    size_t node;
+    std::chrono::steady_clock::time_point start;
+
+    // Inclusive time of the frame's callees.
+    uint64_t callees = 0;
+
+    Frame(size_t const n, std::chrono::steady_clock::time_point const s)
+      : node(n), start(s) { }
+  };
+
+  // nodes[0] is the root, named for the relation.
+  std::vector<Node> nodes;
+  std::vector<Frame> stack;
+
+  size_t child(size_t const parent, void const* const key,
+      char const* const name, char const* const operation);
+
+  // Close a frame, attributing the given gates to its node.
+  void close(uint64_t const gates);
+
+  // Append the path from the root to a node, separated by semicolons.
+  void path(size_t const node, std::string* const out) const;
+
+public:
+  /**
+   * Construct a Profiler, and start timing the root. The root_name should
+   * be that of the relation.
+   */
+  Profiler(char const* const root_name);
+
+  /**
+   * Enter a function, given its key (e.g. its address), its name, and the
+   * name of its plugin operation (or nullptr for a regular function).
+   */
+  void enter(void const* const key,
+      char const* const name, char const* const operation);
+
+  /**
+   * Exit the most recently entered function, having evaluated the given
+   * number of gates directly (excluding those of its callees).
+   */
+  void exit(uint64_t const gates);
+
+  /**
+   * Stop timing the root. All functions must have been exited. The
+   * Profiler may only be reported on after finishing.
+   */
+  void finish();
+
+  /**
+   * Log a table of each function and each plugin operation, sorted by
+   * exclusive time.
+   */
+  void report() const;
+
+  /**
+   * Write the call tree as folded stacks, one line per node, with its
+   * exclusive time in microseconds. The format is accepted by flamegraph
+   * tools (e.g. flamegraph.pl and speedscope). Returns false on failure.
+   */
+  bool writeFolded(char const* const file_name) const;
+};
+
+/**
+ * A ProfileGuard enters a function in its constructor and exits it in its
+ * destructor, so that each return of a function's evaluation is covered.
+ * It does nothing if the profiler is nullptr.
+ */
+class ProfileGuard
+{
+  Profiler* const profiler;
+
+public:
+  // Gates evaluated by the function, to be set before the guard is
+  // destroyed.
+  uint64_t gates = 0;
+
+  ProfileGuard(Profiler* const p, void const* const key,
+      char const* const name, char const* const operation = nullptr)
+    : profiler(p)
+  {
+    if(this->profiler != nullptr)
+    {
+      this->profiler->enter(key, name, operation);
+    }
+  }
+
+  ProfileGuard(ProfileGuard const&) = delete;
+  ProfileGuard& operator=(ProfileGuard const&) = delete;
+
+  ~ProfileGuard()
+  {
+    if(this->profiler != nullptr) { this->profiler->exit(this->gates); }
+  }
+};
+
+} } // namespace wtk::nails
+
+#endif//WTK_NAILS_PROFILER_H_
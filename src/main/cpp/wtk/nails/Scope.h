@@ -16,6 +16,7 @@
 #include <wtk/utils/hints.h>
 #include <wtk/utils/SkipList.h>
 #include <wtk/utils/NumUtils.h>
+#include <wtk/utils/MemStats.h>
 
 namespace wtk {
 namespace nails {
@@ -100,6 +101,29 @@ struct Scope
   // indices >= firstLocal must be local.
   wire_idx firstLocal = 0;
 
+  // In trusted mode the relation is known to be valid (see
+  // wtk::utils::checkCertificate()), so the single-assignment, deletion and
+  // existence checks are skipped and the assigned set is not maintained.
+  // The active set is still kept because it governs wire destruction.
+  bool trusted = false;
+
+  // Optional accounting for the scope's local wire storage (see setStats()).
+  wtk::utils::MemStats* wireStats = nullptr;
+
+  /**
+   * Account for the local wire storage and the assigned and active
+   * SkipLists in the given stats. This must be called before any local wire
+   * is allocated.
+   */
+  void setStats(wtk::utils::MemStats* const wires,
+      wtk::utils::MemStats* const skip_lists);
+
+  // Allocate (uninitialized) local wire storage, or return nullptr.
+  Wire_T* allocateWires(size_t const length);
+
+  // Account for the release of a local range's storage.
+  void releaseWires(Range<Wire_T> const* const range);
+
   // Given a wire index, this function finds corresponding range's index.
   size_t findRange(wire_idx idx) const;
 
@@ -152,6 +176,17 @@ struct Scope
    */
   void mapInputs(size_t const length, Wire_T* const wires);
 
+  /**
+   * Destroys the local wires and forgets all assignments, keeping only the
+   * remapped ranges, so that the scope may be reused for another call to
+   * the same function. Remapped wires from inputs_first onward are marked
+   * assigned again.
+   */
+  void reset(wire_idx const inputs_first);
+
+  // Destroys the active local wires.
+  void destroyLocals();
+
   std::string toString() const;
 
   Scope() = default;
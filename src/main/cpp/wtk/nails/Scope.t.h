@@ -77,6 +77,36 @@ size_t Scope<Wire_T>::findRange(wire_idx idx) const
   return l;
 }
 
+template<typename Wire_T>
+void Scope<Wire_T>::setStats(wtk::utils::MemStats* const wires,
+    wtk::utils::MemStats* const skip_lists)
+{
+  this->wireStats = wires;
+  this->assigned.setStats(skip_lists);
+  this->active.setStats(skip_lists);
+}
+
+template<typename Wire_T>
+Wire_T* Scope<Wire_T>::allocateWires(size_t const length)
+{
+  Wire_T* const wires = (Wire_T*) malloc(sizeof(Wire_T) * length);
+  if(this->wireStats != nullptr && wires != nullptr)
+  {
+    this->wireStats->allocate(sizeof(Wire_T) * length);
+  }
+
+  return wires;
+}
+
+template<typename Wire_T>
+void Scope<Wire_T>::releaseWires(Range<Wire_T> const* const range)
+{
+  if(this->wireStats != nullptr && !range->remapped)
+  {
+    this->wireStats->release(sizeof(Wire_T) * range->length);
+  }
+}
+
 template<typename Wire_T>
 Wire_T* Scope<Wire_T>::newRange(
     wire_idx const first, wire_idx const last, ScopeError* const err)
@@ -100,7 +130,7 @@ Wire_T* Scope<Wire_T>::newRange(
   if(this->offsets.size() == 0)
   {
     // No existing ranges, so make the first one
-    Wire_T* wires = (Wire_T*) malloc(sizeof(Wire_T) * length);
+    Wire_T* wires = this->allocateWires(length);
     if(wires == nullptr)
     {
       *err = ScopeError::outOfMem;
@@ -115,7 +145,7 @@ Wire_T* Scope<Wire_T>::newRange(
   else
   {
     if(UNLIKELY(UNLIKELY(first < this->firstLocal)
-          || UNLIKELY(this->assigned.has(first, last))))
+          || UNLIKELY(!this->trusted && this->assigned.has(first, last))))
     {
       *err = ScopeError::alreadyExists;
       return nullptr;
@@ -133,7 +163,7 @@ Wire_T* Scope<Wire_T>::newRange(
         return nullptr;
       }
 
-      Wire_T* wires = (Wire_T*) malloc(sizeof(Wire_T) * length);
+      Wire_T* wires = this->allocateWires(length);
       if(wires == nullptr) { *err = ScopeError::outOfMem; return nullptr; }
 
       this->offsets.insert(this->offsets.begin(), first);
@@ -153,7 +183,7 @@ Wire_T* Scope<Wire_T>::newRange(
         return nullptr;
       }
 
-      Wire_T* wires = (Wire_T*) malloc(sizeof(Wire_T) * length);
+      Wire_T* wires = this->allocateWires(length);
       if(wires == nullptr) { *err = ScopeError::outOfMem; return nullptr; }
 
       this->offsets.insert(iter_offset(this->offsets.begin(), idx + 1), first);
@@ -173,8 +203,7 @@ Wire_T* Scope<Wire_T>::newRange(
         this->active.forRange(last + 1, prev_last, [&](wire_idx f, wire_idx l)
             {
               size_t const new_len = (size_t) (1 + l - f);
-              Wire_T* const new_wires =
-                (Wire_T*) malloc(sizeof(Wire_T) * new_len);
+              Wire_T* const new_wires = this->allocateWires(new_len);
               if(new_wires == nullptr) { split_err = ScopeError::outOfMem; }
 
               for(wire_idx i = f; i <= l; i++)
@@ -208,7 +237,7 @@ Wire_T* Scope<Wire_T>::newRange(
         return nullptr;
       }
 
-      Wire_T* wires = (Wire_T*) malloc(sizeof(Wire_T) * length);
+      Wire_T* wires = this->allocateWires(length);
       if(wires == nullptr) { *err = ScopeError::outOfMem; return nullptr; }
 
       this->offsets.push_back(first);
@@ -227,8 +256,7 @@ Wire_T* Scope<Wire_T>::newRange(
         this->active.forRange(last + 1, prev_last, [&](wire_idx f, wire_idx l)
             {
               size_t const new_len = (size_t) (1 + l - f);
-              Wire_T* const new_wires =
-                (Wire_T*) malloc(sizeof(Wire_T) * new_len);
+              Wire_T* const new_wires = this->allocateWires(new_len);
               if(new_wires == nullptr) { split_err = ScopeError::outOfMem; }
 
               for(wire_idx i = f; i <= l; i++)
@@ -272,7 +300,7 @@ ScopeError Scope<Wire_T>::deleteRange(
     return ScopeError::cannotDeleteRemap;
   }
 
-  if(UNLIKELY(!this->active.hasAll(first, last)))
+  if(UNLIKELY(!this->trusted && !this->active.hasAll(first, last)))
   {
     if(this->assigned.hasAll(first, last))
     {
@@ -346,6 +374,7 @@ ScopeError Scope<Wire_T>::deleteRange(
 
     if(do_delete)
     {
+      this->releaseWires(&this->ranges[idx]);
       this->offsets.erase(iter_offset(this->offsets.begin(), idx));
       this->ranges.erase(iter_offset(this->ranges.begin(), idx));
     }
@@ -371,7 +400,7 @@ Wire_T const* Scope<Wire_T>::retrieve(
       this->assigned.toString().c_str(), this->active.toString().c_str(),
       this->toString().c_str());
 
-  if(UNLIKELY(!this->active.has(wire)))
+  if(UNLIKELY(!this->trusted && !this->active.has(wire)))
   {
     if(this->assigned.has(wire))
     {
@@ -403,7 +432,7 @@ Wire_T* Scope<Wire_T>::assign(
       this->assigned.toString().c_str(), this->active.toString().c_str(),
       this->toString().c_str());
 
-  if(UNLIKELY(this->assigned.has(wire)))
+  if(UNLIKELY(!this->trusted && this->assigned.has(wire)))
   {
     *err = ScopeError::alreadyExists;
     return nullptr;
@@ -411,7 +440,7 @@ Wire_T* Scope<Wire_T>::assign(
 
   if(UNLIKELY(this->offsets.size() == 0))
   {
-    Wire_T* wires = (Wire_T*) malloc(sizeof(Wire_T) * RANGE_DEFAULT_SIZE);
+    Wire_T* wires = this->allocateWires(RANGE_DEFAULT_SIZE);
     if(wires == nullptr)
     {
       *err = ScopeError::outOfMem;
@@ -430,7 +459,7 @@ Wire_T* Scope<Wire_T>::assign(
     }
 
     new(wires) Wire_T();
-    this->assigned.insert(wire);
+    if(!this->trusted) { this->assigned.insert(wire); }
     this->active.insert(wire);
     return wires;
   }
@@ -444,13 +473,13 @@ Wire_T* Scope<Wire_T>::assign(
     Wire_T* ret =
       this->ranges[idx].wires + (size_t) (wire - this->offsets[idx]);
     new(ret) Wire_T();
-    this->assigned.insert(wire);
+    if(!this->trusted) { this->assigned.insert(wire); }
     this->active.insert(wire);
     return ret;
   }
   else if(idx == 0 && wire < this->offsets[0])
   {
-    Wire_T* wires = (Wire_T*) malloc(sizeof(Wire_T) * RANGE_DEFAULT_SIZE);
+    Wire_T* wires = this->allocateWires(RANGE_DEFAULT_SIZE);
     if(wires == nullptr)
     {
       *err = ScopeError::outOfMem;
@@ -469,7 +498,7 @@ Wire_T* Scope<Wire_T>::assign(
     }
 
     new(wires) Wire_T();
-    this->assigned.insert(wire);
+    if(!this->trusted) { this->assigned.insert(wire); }
     this->active.insert(wire);
     return wires;
   }
@@ -491,7 +520,7 @@ Wire_T* Scope<Wire_T>::assign(
         : growth_last;
 
       size_t const new_size = (size_t) adj_growth - first + 1;
-      Wire_T* new_wires = (Wire_T*) malloc(sizeof(Wire_T) * new_size);
+      Wire_T* new_wires = this->allocateWires(new_size);
       if(new_wires == nullptr)
       {
         *err = ScopeError::outOfMem;
@@ -508,18 +537,19 @@ Wire_T* Scope<Wire_T>::assign(
             }
           });
 
+      this->releaseWires(&this->ranges[idx]);
       free(this->ranges[idx].wires);
       this->ranges[idx].wires = new_wires;
       this->ranges[idx].length = new_size;
 
       new(new_wires + wire - first) Wire_T();
-      this->assigned.insert(wire);
+      if(!this->trusted) { this->assigned.insert(wire); }
       this->active.insert(wire);
       return new_wires + wire - first;
     }
     else
     {
-      Wire_T* wires = (Wire_T*) malloc(sizeof(Wire_T) * RANGE_DEFAULT_SIZE);
+      Wire_T* wires = this->allocateWires(RANGE_DEFAULT_SIZE);
       if(wires == nullptr)
       {
         *err = ScopeError::outOfMem;
@@ -540,7 +570,7 @@ Wire_T* Scope<Wire_T>::assign(
       }
 
       new(wires) Wire_T();
-      this->assigned.insert(wire);
+      if(!this->trusted) { this->assigned.insert(wire); }
       this->active.insert(wire);
       return wires;
     }
@@ -557,7 +587,7 @@ Wire_T* Scope<Wire_T>::findOutputs(
       this->assigned.toString().c_str(), this->active.toString().c_str(),
       this->toString().c_str());
 
-  if(UNLIKELY(this->assigned.has(first, last)))
+  if(UNLIKELY(!this->trusted && this->assigned.has(first, last)))
   {
     *err = ScopeError::alreadyExists;
     return nullptr;
@@ -594,7 +624,7 @@ Wire_T* Scope<Wire_T>::findInputs(
       this->assigned.toString().c_str(), this->active.toString().c_str(),
       this->toString().c_str());
 
-  if(UNLIKELY(!this->active.hasAll(first, last)))
+  if(UNLIKELY(!this->trusted && !this->active.hasAll(first, last)))
   {
     if(this->assigned.hasAll(first, last))
     {
@@ -650,7 +680,7 @@ void Scope<Wire_T>::mapInputs(size_t const length, Wire_T* const wires)
   this->mapOutputs(length, wires);
   wire_idx last = this->firstLocal - 1;
 
-  this->assigned.insert(first, last);
+  if(!this->trusted) { this->assigned.insert(first, last); }
   this->active.insert(first, last);
 }
 
@@ -672,11 +702,58 @@ std::string Scope<Wire_T>::toString() const
   return ret;
 }
 
+template<typename Wire_T>
+void Scope<Wire_T>::reset(wire_idx const inputs_first)
+{
+  log_debug("reset");
+  this->destroyLocals();
+
+  // Remapped ranges precede the local ranges.
+  size_t params = 0;
+  while(params < this->ranges.size() && this->ranges[params].remapped)
+  {
+    params++;
+  }
+
+  for(size_t i = params; i < this->ranges.size(); i++)
+  {
+    this->releaseWires(&this->ranges[i]);
+  }
+
+  this->ranges.erase(
+      iter_offset(this->ranges.begin(), params), this->ranges.end());
+  this->offsets.erase(
+      iter_offset(this->offsets.begin(), params), this->offsets.end());
+
+  this->assigned.clear();
+  this->active.clear();
+
+  if(inputs_first < this->firstLocal)
+  {
+    if(!this->trusted)
+    {
+      this->assigned.insert(inputs_first, this->firstLocal - 1);
+    }
+    this->active.insert(inputs_first, this->firstLocal - 1);
+  }
+}
+
 template<typename Wire_T>
 Scope<Wire_T>::~Scope()
 {
-  log_assert(this->offsets.size() == this->ranges.size());
   log_debug("destruct");
+  this->destroyLocals();
+
+  for(size_t i = 0; i < this->ranges.size(); i++)
+  {
+    this->releaseWires(&this->ranges[i]);
+  }
+}
+
+template<typename Wire_T>
+void Scope<Wire_T>::destroyLocals()
+{
+  log_assert(this->offsets.size() == this->ranges.size());
   log_debug("\nassigned: %s\n  active: %s\n  ranges: %s\n",
       this->assigned.toString().c_str(), this->active.toString().c_str(),
       this->toString().c_str());
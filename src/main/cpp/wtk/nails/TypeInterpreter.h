@@ -7,6 +7,7 @@
 
 #include <cstddef>
 #include <vector>
+#include <string>
 #include <cstdint>
 #include <cinttypes>
 #include <memory>
@@ -15,13 +16,39 @@
 #include <wtk/TypeBackend.h>
 #include <wtk/Parser.h>
 #include <wtk/utils/NumUtils.h>
+#include <wtk/utils/hints.h>
+#include <wtk/utils/MemStats.h>
 #include <wtk/plugins/Plugin.h>
 
 #include <wtk/nails/Scope.h>
+#include <wtk/nails/Functions.h>
+#include <wtk/nails/Policy.h>
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+#include <wtk/utils/Indent.h>
+#endif//WTK_NAILS_ENABLE_TRACES
 
 namespace wtk {
 namespace nails {
 
+/**
+ * Compiled functions (see CompiledFunction) address wires by a "slot"
+ * rather than by wire index. A frame is an array of base pointers, one for
+ * the function's locals and one for each of its parameters of a given type.
+ * The upper bits of a slot select the frame segment (0 for locals and
+ * 1 + n for the n'th parameter), and the lower bits are an offset within it.
+ */
+constexpr size_t FRAME_SEGMENT_SHIFT = 48;
+constexpr wire_idx FRAME_OFFSET_MASK =
+  (((wire_idx) 1) << FRAME_SEGMENT_SHIFT) - 1;
+constexpr size_t FRAME_MAX_SEGMENTS =
+  ((size_t) 1) << (64 - FRAME_SEGMENT_SHIFT);
+
+ALWAYS_INLINE inline wire_idx frameSlot(size_t const seg, wire_idx const off)
+{
+  return (((wire_idx) seg) << FRAME_SEGMENT_SHIFT) | off;
+}
+
 /**
  * The type interpreter interprets gates within a single field.
  *
@@ -35,8 +62,27 @@ public:
   char const* const fileName;
   size_t lineNum = 0;
 
+  // Memory accounting for the type's scopes: their local wire storage, and
+  // the ranges of their assigned and active SkipLists. They are updated by
+  // the type's own thread (see TypeWorker).
+  wtk::utils::MemStats wireStats;
+  wtk::utils::MemStats skipListStats;
+
   TypeInterpreter(char const* const fn);
 
+  // Skip wire validity checks in this and all future scopes.
+  virtual void enableTrusted() = 0;
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+  /**
+   * Trace each gate, naming the type by the given index and indenting by
+   * the Interpreter's indent. This does nothing unless the policy allows
+   * traces (see Policy.h).
+   */
+  virtual void enableTraceDetail(
+      type_idx const type, wtk::utils::Indent const* const indent) = 0;
+#endif//WTK_NAILS_ENABLE_TRACES
+
   // Stack operations (inter function)
   virtual void push() = 0;
 
@@ -89,13 +135,181 @@ public:
   virtual wtk::plugins::WiresRefEraser pluginInput(
       type_idx const type, wire_idx const first, wire_idx const last) = 0;
 
+  // As pluginOutput() and pluginInput(), but for the top scope's idx'th
+  // remapped range, which spans first through last, skipping the lookup.
+  virtual wtk::plugins::WiresRefEraser pluginOutputRange(type_idx const type,
+      size_t const idx, wire_idx const first, wire_idx const last) = 0;
+
+  virtual wtk::plugins::WiresRefEraser pluginInputRange(type_idx const type,
+      size_t const idx, wire_idx const first, wire_idx const last) = 0;
+
+  // Retrieve the top Scope<Wire_T>, type-erased (e.g. for the Converter).
+  virtual void* topScope() = 0;
+
   virtual void iterPluginHack(wire_idx const first, wire_idx const last) = 0;
   virtual Number_T getMaxValForIterPlugin() = 0;
 
+  /**
+   * Create a TypeInterpreter for use by another thread, whose bottom scope
+   * aliases the wires of this one's top scope (e.g. the map plugin's scope,
+   * see MapOperation). Returns nullptr if the backend is not thread-safe or
+   * the top scope has local wires.
+   */
+  virtual std::unique_ptr<TypeInterpreter<Number_T>> fork() = 0;
+
+  /**
+   * Merge the wires from first through last assigned by a fork's bottom
+   * scope into this one's top scope. They must be unassigned in the top.
+   */
+  virtual void join(TypeInterpreter<Number_T>* const forked,
+      wire_idx const first, wire_idx const last) = 0;
+
+  // Memoization of pure function calls (see Memoizer). These forward to
+  // the backend, which must support memoization.
+  virtual bool memoizable() = 0;
+
+  /**
+   * Append the values of the top scope's wires first through last to a
+   * memoization key. Returns false if any is not assigned.
+   */
+  virtual bool memoKey(
+      wire_idx const first, wire_idx const last, std::string* const key) = 0;
+
+  // Append the values of the top scope's wires first through last.
+  virtual void memoRead(wire_idx const first, wire_idx const last,
+      std::vector<Number_T>* const values) = 0;
+
+  /**
+   * Assign the top scope's wires first through last from memoized values,
+   * in place of evaluating a call. Returns false on a scope error.
+   */
+  virtual bool memoAssign(wire_idx const first, wire_idx const last,
+      Number_T const* const values) = 0;
+
+  virtual std::unique_ptr<wtk::MemoRecord> beginMemo() = 0;
+
+  virtual void endMemo(wtk::MemoRecord* const record) = 0;
+
+  virtual void replayMemo(wtk::MemoRecord const* const record) = 0;
+
+  // Prepare a constant for repeated use (see
+  // TypeBackendEraser::prepareConstant).
+  virtual void* prepareConstant(Number_T const& value) = 0;
+
+  virtual void releaseConstant(void* constant) = 0;
+
+  // The backend, which may release prepared constants after this is gone.
+  virtual wtk::TypeBackendEraser<Number_T>* erasedBackend() const = 0;
+
+  // As addcGate(), mulcGate() and assign(), but with a prepared constant
+  // which the caller has already checked (e.g. a GatesFunction's
+  // typeCheck()). The value is used only for traces.
+  virtual bool addcPrepared(wire_idx const out, wire_idx const left,
+      void const* right, Number_T const& value) = 0;
+
+  virtual bool mulcPrepared(wire_idx const out, wire_idx const left,
+      void const* right, Number_T const& value) = 0;
+
+  virtual bool assignPrepared(wire_idx const out,
+      void const* right, Number_T const& value) = 0;
+
+  // Batches of independent gates (see GatesFunction::batch()), with operands
+  // as in the Gate record, which the caller has already checked. Constants
+  // are prepared, and indexed by the Gate's right operand.
+  virtual bool addGates(Gate const* gates, size_t const n) = 0;
+
+  virtual bool mulGates(Gate const* gates, size_t const n) = 0;
+
+  virtual bool addcGates(
+      Gate const* gates, size_t const n, void* const* constants) = 0;
+
+  virtual bool mulcGates(
+      Gate const* gates, size_t const n, void* const* constants) = 0;
+
+  virtual bool assertZeros(Gate const* gates, size_t const n) = 0;
+
+  // Compiled function frame operations. These skip the checks which the
+  // function's typeCheck() has already done, and use no Scope. Frames are
+  // described at FRAME_SEGMENT_SHIFT. Constants are prepared.
+  virtual void* allocateFrame(size_t const length) = 0;
+
+  // Retrieve the wires of the top scope's n'th remapped parameter.
+  virtual void* frameParameter(size_t const idx) = 0;
+
+  // Mark the first length wires of the top scope as assigned.
+  virtual void frameAssigned(wire_idx const length) = 0;
+
+  virtual void* frameWires(void* const* frame, wire_idx const slot) = 0;
+
+  virtual void frameDestroy(
+      void* const* frame, wire_idx const slot, wire_idx const length) = 0;
+
+  virtual void frameAddGate(void* const* frame,
+      wire_idx const out, wire_idx const left, wire_idx const right) = 0;
+
+  virtual void frameMulGate(void* const* frame,
+      wire_idx const out, wire_idx const left, wire_idx const right) = 0;
+
+  virtual void frameAddcGate(void* const* frame,
+      wire_idx const out, wire_idx const left, void const* right) = 0;
+
+  virtual void frameMulcGate(void* const* frame,
+      wire_idx const out, wire_idx const left, void const* right) = 0;
+
+  virtual void frameCopy(
+      void* const* frame, wire_idx const out, wire_idx const left) = 0;
+
+  virtual void frameAssign(
+      void* const* frame, wire_idx const out, void const* right) = 0;
+
+  virtual void frameAssertZero(void* const* frame, wire_idx const left) = 0;
+
+  // Batches of independent gates, each gate's operands are slots as in the
+  // Gate record. Prepared constants are indexed by the Gate's right operand.
+  virtual void frameAddGates(
+      void* const* frame, Gate const* gates, size_t const n) = 0;
+
+  virtual void frameMulGates(
+      void* const* frame, Gate const* gates, size_t const n) = 0;
+
+  virtual void frameAddcGates(void* const* frame, Gate const* gates,
+      size_t const n, void* const* constants) = 0;
+
+  virtual void frameMulcGates(void* const* frame, Gate const* gates,
+      size_t const n, void* const* constants) = 0;
+
+  virtual void frameAssertZeros(
+      void* const* frame, Gate const* gates, size_t const n) = 0;
+
+  virtual bool framePublicIn(void* const* frame, wire_idx const out) = 0;
+
+  virtual bool framePrivateIn(void* const* frame, wire_idx const out) = 0;
+
+  // Map frame wires into a pushed scope, for calling out of a frame.
+  virtual void mapFrameOutput(void* const wires, size_t const length) = 0;
+
+  virtual void mapFrameInput(void* const wires, size_t const length) = 0;
+
+  virtual bool checkFrameOutput(size_t const length, wire_idx* place) = 0;
+
+  // Reuse the top scope for another call to the same function (see
+  // Scope::reset()), keeping its inputs from inputs_first onward.
+  virtual void resetFrame(wire_idx const inputs_first) = 0;
+
+  // Move the top scope's n'th remapped parameter stride wires further into
+  // the caller's range.
+  virtual void advanceFrame(size_t const idx, wire_idx const stride) = 0;
+
   virtual ~TypeInterpreter() = default;
 };
 
-template<typename Number_T, typename Wire_T>
+/**
+ * The LeadTypeInterpreter is the non-type-erased TypeInterpreter. Its
+ * Policy_T selects the checks and bookkeeping done for each gate (see
+ * CheckedPolicy).
+ */
+template<typename Number_T, typename Wire_T,
+  typename Policy_T = CheckedPolicy>
 class LeadTypeInterpreter : public TypeInterpreter<Number_T>
 {
 public:
@@ -103,12 +317,49 @@ public:
 
   Number_T maxVal;
 
+  // Bound on stream inputs (see TypeBackend::maxInputValue()).
+  Number_T maxInputVal;
+
   InputStream<Number_T>* const publicInStream;
 
   InputStream<Number_T>* const privateInStream;
 
   std::vector<Scope<Wire_T>> stack;
 
+  bool trusted = false;
+
+  // Indicates that this is a fork (see fork()), sharing its backend with
+  // other threads.
+  bool forked = false;
+
+  // Set the backend's line number, unless it is shared with other threads.
+  void setBackendLine()
+  {
+    if(Policy_T::lineNumbers && !this->forked)
+    {
+      this->backend->lineNum = this->lineNum;
+    }
+  }
+
+  // Indicates that checks are skipped, by the policy or by trusted mode.
+  bool unchecked() const { return !Policy_T::checks || this->trusted; }
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+  // The type index and indent for detailed traces, which are enabled only
+  // if the indent is non-null.
+  type_idx traceType = 0;
+  wtk::utils::Indent const* traceIndent = nullptr;
+
+  // Indicates that each gate is traced, which the policy may rule out.
+  bool tracing() const
+  {
+    return Policy_T::traces && this->traceIndent != nullptr;
+  }
+
+  void enableTraceDetail(
+      type_idx const type, wtk::utils::Indent const* const indent) final;
+#endif//WTK_NAILS_ENABLE_TRACES
+
   LeadTypeInterpreter(char const* const fn,
       TypeBackend<Number_T, Wire_T>* const f,
       InputStream<Number_T>* const ins, InputStream<Number_T>* const wit);
@@ -116,6 +367,8 @@ public:
   // Operations on the stack of scopes.
   Scope<Wire_T>* top();
 
+  void enableTrusted() final;
+
   void push() final;
 
   bool mapOutput(wire_idx first, wire_idx last) final;
@@ -167,8 +420,148 @@ public:
   wtk::plugins::WiresRefEraser pluginInput(
       type_idx const type, wire_idx const first, wire_idx const last) final;
 
+  wtk::plugins::WiresRefEraser pluginOutputRange(type_idx const type,
+      size_t const idx, wire_idx const first, wire_idx const last) final;
+
+  wtk::plugins::WiresRefEraser pluginInputRange(type_idx const type,
+      size_t const idx, wire_idx const first, wire_idx const last) final;
+
+  void* topScope() final;
+
   void iterPluginHack(wire_idx const first, wire_idx const last) final;
   Number_T getMaxValForIterPlugin() final;
+
+  std::unique_ptr<TypeInterpreter<Number_T>> fork() final;
+
+  void join(TypeInterpreter<Number_T>* const forked,
+      wire_idx const first, wire_idx const last) final;
+
+  bool memoizable() final;
+
+  bool memoKey(wire_idx const first, wire_idx const last,
+      std::string* const key) final;
+
+  void memoRead(wire_idx const first, wire_idx const last,
+      std::vector<Number_T>* const values) final;
+
+  bool memoAssign(wire_idx const first, wire_idx const last,
+      Number_T const* const values) final;
+
+  std::unique_ptr<wtk::MemoRecord> beginMemo() final;
+
+  void endMemo(wtk::MemoRecord* const record) final;
+
+  void replayMemo(wtk::MemoRecord const* const record) final;
+
+  // Compiled function frame operations.
+  Wire_T* frameWire(void* const* frame, wire_idx const slot);
+
+  bool nextInput(InputStream<Number_T>* const stream,
+      char const* const name, Number_T* const val);
+
+  void* prepareConstant(Number_T const& value) final;
+
+  void releaseConstant(void* constant) final;
+
+  wtk::TypeBackendEraser<Number_T>* erasedBackend() const final;
+
+  bool addcPrepared(wire_idx const out, wire_idx const left,
+      void const* right, Number_T const& value) final;
+
+  bool mulcPrepared(wire_idx const out, wire_idx const left,
+      void const* right, Number_T const& value) final;
+
+  bool assignPrepared(wire_idx const out,
+      void const* right, Number_T const& value) final;
+
+  // Scratch space for batches
+  std::vector<Wire_T*> batchOuts;
+  std::vector<Wire_T const*> batchLefts;
+  std::vector<Wire_T const*> batchRights;
+  std::vector<void const*> batchConstants;
+
+  // Find the wires of a batch in the top scope.
+  bool scopeBatch(Gate const* gates, size_t const n,
+      bool const outputs, bool const rights);
+
+  // Gather a batch's prepared constants.
+  void batchPrepared(
+      Gate const* gates, size_t const n, void* const* constants);
+
+  bool addGates(Gate const* gates, size_t const n) final;
+
+  bool mulGates(Gate const* gates, size_t const n) final;
+
+  bool addcGates(
+      Gate const* gates, size_t const n, void* const* constants) final;
+
+  bool mulcGates(
+      Gate const* gates, size_t const n, void* const* constants) final;
+
+  bool assertZeros(Gate const* gates, size_t const n) final;
+
+  void* allocateFrame(size_t const length) final;
+
+  void* frameParameter(size_t const idx) final;
+
+  void frameAssigned(wire_idx const length) final;
+
+  void* frameWires(void* const* frame, wire_idx const slot) final;
+
+  void frameDestroy(
+      void* const* frame, wire_idx const slot, wire_idx const length) final;
+
+  void frameAddGate(void* const* frame,
+      wire_idx const out, wire_idx const left, wire_idx const right) final;
+
+  void frameMulGate(void* const* frame,
+      wire_idx const out, wire_idx const left, wire_idx const right) final;
+
+  void frameAddcGate(void* const* frame,
+      wire_idx const out, wire_idx const left, void const* right) final;
+
+  void frameMulcGate(void* const* frame,
+      wire_idx const out, wire_idx const left, void const* right) final;
+
+  void frameCopy(
+      void* const* frame, wire_idx const out, wire_idx const left) final;
+
+  void frameAssign(
+      void* const* frame, wire_idx const out, void const* right) final;
+
+  void frameAssertZero(void* const* frame, wire_idx const left) final;
+
+  void frameBatch(void* const* frame, Gate const* gates, size_t const n,
+      bool const outputs, bool const rights);
+
+  void frameAddGates(
+      void* const* frame, Gate const* gates, size_t const n) final;
+
+  void frameMulGates(
+      void* const* frame, Gate const* gates, size_t const n) final;
+
+  void frameAddcGates(void* const* frame, Gate const* gates,
+      size_t const n, void* const* constants) final;
+
+  void frameMulcGates(void* const* frame, Gate const* gates,
+      size_t const n, void* const* constants) final;
+
+  void frameAssertZeros(
+      void* const* frame, Gate const* gates, size_t const n) final;
+
+  bool framePublicIn(void* const* frame, wire_idx const out) final;
+
+  bool framePrivateIn(void* const* frame, wire_idx const out) final;
+
+  void mapFrameOutput(void* const wires, size_t const length) final;
+
+  void mapFrameInput(void* const wires, size_t const length) final;
+
+  bool checkFrameOutput(size_t const length, wire_idx* place) final;
+
+  void resetFrame(wire_idx const inputs_first) final;
+
+  void advanceFrame(size_t const idx, wire_idx const stride) final;
 };
 
 } } // namespace nails
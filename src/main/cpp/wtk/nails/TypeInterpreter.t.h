@@ -9,27 +9,58 @@ template<typename Number_T>
 TypeInterpreter<Number_T>::TypeInterpreter(char const* const fn)
   : fileName(fn) { }
 
-template<typename Number_T, typename Wire_T>
-LeadTypeInterpreter<Number_T, Wire_T>::LeadTypeInterpreter(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::LeadTypeInterpreter(
     char const* const fn, TypeBackend<Number_T, Wire_T>* const tb,
     InputStream<Number_T>* const ins, InputStream<Number_T>* const wit)
   : TypeInterpreter<Number_T>(fn), backend(tb), maxVal(tb->type->maxValue()),
-    publicInStream(ins), privateInStream(wit), stack(1) { }
+    maxInputVal(tb->maxInputValue()), publicInStream(ins),
+    privateInStream(wit), stack(1)
+{
+  this->stack[0].setStats(&this->wireStats, &this->skipListStats);
+  if(!Policy_T::checks) { this->enableTrusted(); }
+}
 
-template<typename Number_T, typename Wire_T>
-Scope<Wire_T>* LeadTypeInterpreter<Number_T, Wire_T>::top()
+template<typename Number_T, typename Wire_T, typename Policy_T>
+Scope<Wire_T>* LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::top()
 {
   return &this->stack.back();
 }
 
-template<typename Number_T, typename Wire_T>
-void LeadTypeInterpreter<Number_T, Wire_T>::push()
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::enableTrusted()
+{
+  this->trusted = true;
+
+  for(size_t i = 0; i < this->stack.size(); i++)
+  {
+    this->stack[i].trusted = true;
+  }
+}
+
+#ifdef WTK_NAILS_ENABLE_TRACES
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::enableTraceDetail(
+    type_idx const type, wtk::utils::Indent const* const indent)
+{
+  if(Policy_T::traces)
+  {
+    this->traceType = type;
+    this->traceIndent = indent;
+  }
+}
+#endif//WTK_NAILS_ENABLE_TRACES
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::push()
 {
   this->stack.emplace_back();
+  this->stack.back().trusted = this->trusted;
+  this->stack.back().setStats(&this->wireStats, &this->skipListStats);
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::mapOutput(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mapOutput(
     wire_idx first, wire_idx last)
 {
   log_assert(this->stack.size() > 1);
@@ -50,12 +81,16 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::mapOutput(
   }
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::checkOutput(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::checkOutput(
     wire_idx first, wire_idx last, wire_idx* place)
 {
   bool ret = true;
-  if(this->top()->active.hasAll(*place, *place + last - first))
+  if(this->unchecked())
+  {
+    this->stack[this->stack.size() - 2].active.insert(first, last);
+  }
+  else if(this->top()->active.hasAll(*place, *place + last - first))
   {
     this->stack[this->stack.size() - 2].assigned.insert(first, last);
     this->stack[this->stack.size() - 2].active.insert(first, last);
@@ -80,8 +115,8 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::checkOutput(
   return ret;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::mapInput(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mapInput(
     wire_idx first, wire_idx last)
 {
   log_assert(this->stack.size() > 1);
@@ -102,22 +137,32 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::mapInput(
   }
 }
 
-template<typename Number_T, typename Wire_T>
-void LeadTypeInterpreter<Number_T, Wire_T>::pop()
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::pop()
 {
   log_assert(this->stack.size() > 1);
 
   this->stack.pop_back();
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::addGate(wire_idx const out,
-    wire_idx const left, wire_idx const right)
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::addGate(
+    wire_idx const out, wire_idx const left, wire_idx const right)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @add(%" PRIu8 ": $%" PRIu64 ", $%"
+        PRIu64 ");", this->fileName, this->lineNum, this->traceIndent->get(),
+        out, this->traceType, left, right);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
-  if(UNLIKELY(UNLIKELY(out == left) || UNLIKELY(out == right)))
+  if(Policy_T::checks
+      && UNLIKELY(UNLIKELY(out == left) || UNLIKELY(out == right)))
   {
     log_error("%s:%zu: Cannot retrieve and assign wire $%" PRIu64
         " in the same directive", this->fileName, this->lineNum, out);
@@ -148,19 +193,29 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::addGate(wire_idx const out,
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->addGate(out_wire, left_wire, right_wire);
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::mulGate(wire_idx const out,
-    wire_idx const left, wire_idx const right)
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mulGate(
+    wire_idx const out, wire_idx const left, wire_idx const right)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @mul(%" PRIu8 ": $%" PRIu64 ", $%"
+        PRIu64 ");", this->fileName, this->lineNum, this->traceIndent->get(),
+        out, this->traceType, left, right);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
-  if(UNLIKELY(UNLIKELY(out == left) || UNLIKELY(out == right)))
+  if(Policy_T::checks
+      && UNLIKELY(UNLIKELY(out == left) || UNLIKELY(out == right)))
   {
     log_error("%s:%zu: Cannot retrieve and assign wire $%" PRIu64
         " in the same directive", this->fileName, this->lineNum, out);
@@ -191,19 +246,28 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::mulGate(wire_idx const out,
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->mulGate(out_wire, left_wire, right_wire);
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::addcGate(wire_idx const out,
-    wire_idx const left, Number_T&& right)
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::addcGate(
+    wire_idx const out, wire_idx const left, Number_T&& right)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @addc(%" PRIu8 ": $%" PRIu64
+        ", < %s >);", this->fileName, this->lineNum, this->traceIndent->get(),
+        out, this->traceType, left, wtk::utils::dec(right).c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
-  if(UNLIKELY(out == left))
+  if(Policy_T::checks && UNLIKELY(out == left))
   {
     log_error("%s:%zu: Cannot retrieve and assign wire $%" PRIu64
         " in the same directive", this->fileName, this->lineNum, out);
@@ -226,26 +290,35 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::addcGate(wire_idx const out,
     return false;
   }
 
-  if(UNLIKELY(this->maxVal <= right))
+  if(Policy_T::checks && UNLIKELY(this->maxVal <= right))
   {
     log_error("%s:%zu: (constant value %s) invalid field element.",
         this->fileName, this->lineNum, wtk::utils::dec(right).c_str());
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->addcGate(out_wire, left_wire, std::move(right));
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::mulcGate(wire_idx const out,
-    wire_idx const left, Number_T&& right)
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mulcGate(
+    wire_idx const out, wire_idx const left, Number_T&& right)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @mulc(%" PRIu8 ": $%" PRIu64
+        ", < %s >);", this->fileName, this->lineNum, this->traceIndent->get(),
+        out, this->traceType, left, wtk::utils::dec(right).c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
-  if(UNLIKELY(out == left))
+  if(Policy_T::checks && UNLIKELY(out == left))
   {
     log_error("%s:%zu: Cannot retrieve and assign wire $%" PRIu64
         " in the same directive", this->fileName, this->lineNum, out);
@@ -268,26 +341,35 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::mulcGate(wire_idx const out,
     return false;
   }
 
-  if(UNLIKELY(this->maxVal <= right))
+  if(Policy_T::checks && UNLIKELY(this->maxVal <= right))
   {
     log_error("%s:%zu: (constant value %s) invalid field element.",
         this->fileName, this->lineNum, wtk::utils::dec(right).c_str());
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->mulcGate(out_wire, left_wire, std::move(right));
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::copy(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::copy(
     wire_idx const out, wire_idx const left)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- %" PRIu8 ": $%" PRIu64 ";",
+        this->fileName, this->lineNum, this->traceIndent->get(), out,
+        this->traceType, left);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
-  if(UNLIKELY(out == left))
+  if(Policy_T::checks && UNLIKELY(out == left))
   {
     log_error("%s:%zu: Cannot retrieve and assign wire $%" PRIu64
         " in the same directive", this->fileName, this->lineNum, out);
@@ -310,15 +392,44 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::copy(
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->copy(out_wire, left_wire);
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::copyMulti(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::copyMulti(
     wtk::circuit::CopyMulti const* const copy)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    std::string s = "$";
+    s += wtk::utils::dec(copy->outputs.first);
+
+    if(copy->outputs.first != copy->outputs.last)
+    {
+      s += " ... $" + wtk::utils::dec(copy->outputs.last);
+    }
+
+    s += " <- " + wtk::utils::dec(copy->type) + ": ";
+
+    std::string comma = "";
+    for(size_t i = 0; i < copy->inputs.size(); i++)
+    {
+      s += comma + "$" + wtk::utils::dec(copy->inputs[i].first);
+      comma = ", ";
+      if(copy->inputs[i].first != copy->inputs[i].last)
+      {
+        s += " ... $" + wtk::utils::dec(copy->inputs[i].last);
+      }
+    }
+
+    log_info("    %s:%zu: %s%s;", this->fileName, this->lineNum,
+        this->traceIndent->get(), s.c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
@@ -361,7 +472,7 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::copyMulti(
   }
 
   wire_idx out_place = 0;
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
 
   for(size_t i = 0; i < copy->inputs.size(); i++)
   {
@@ -382,8 +493,11 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::copyMulti(
       this->backend->copy(outs + out_place + i, ins + i);
     }
 
-    scope->assigned.insert(copy->outputs.first + out_place,
-        copy->outputs.first + out_place + in_count - 1);
+    if(!this->unchecked())
+    {
+      scope->assigned.insert(copy->outputs.first + out_place,
+          copy->outputs.first + out_place + in_count - 1);
+    }
     scope->active.insert(copy->outputs.first + out_place,
         copy->outputs.first + out_place + in_count - 1);
     out_place += in_count;
@@ -392,14 +506,23 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::copyMulti(
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::assign(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::assign(
     wire_idx const out, Number_T&& right)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- %" PRIu8 ": < %s >);",
+        this->fileName, this->lineNum, this->traceIndent->get(), out,
+        this->traceType, wtk::utils::dec(right).c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
-  if(UNLIKELY(this->maxVal <= right))
+  if(Policy_T::checks && UNLIKELY(this->maxVal <= right))
   {
     log_error("%s:%zu: (constant value %s) invalid field element.",
         this->fileName, this->lineNum, wtk::utils::dec(right).c_str());
@@ -414,15 +537,24 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::assign(
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->assign(out_wire, std::move(right));
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::assertZero(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::assertZero(
     wire_idx const left)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s@assert_zero(%" PRIu8 ": $%" PRIu64 ");",
+        this->fileName, this->lineNum, this->traceIndent->get(),
+        this->traceType, left);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
@@ -434,15 +566,24 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::assertZero(
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->assertZero(left_wire);
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::publicIn(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::publicIn(
     wire_idx const out)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @public(%" PRIu8 ");",
+        this->fileName, this->lineNum, this->traceIndent->get(), out,
+        this->traceType);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
@@ -461,7 +602,7 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::publicIn(
     {
     case wtk::StreamStatus::success:
     {
-      if(UNLIKELY(this->maxVal <= val))
+      if(UNLIKELY(this->maxInputVal <= val))
       {
         log_error("%s:%zu: invalid field element (stream line %zu, value %s)",
             this->fileName, this->lineNum, this->publicInStream->lineNum(),
@@ -483,15 +624,33 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::publicIn(
     }
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->publicIn(out_wire, std::move(val));
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::publicInMulti(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::publicInMulti(
     wtk::circuit::Range const* const outs)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    if(outs->first == outs->last)
+    {
+      log_info("    %s:%zu: %s$%" PRIu64 " <- @public(%" PRIu8 ");",
+          this->fileName, this->lineNum, this->traceIndent->get(), outs->first,
+          this->traceType);
+    }
+    else
+    {
+      log_info("    %s:%zu: %s$%" PRIu64 " ... $%" PRIu64 "<- @public(%" PRIu8
+          ");", this->fileName, this->lineNum, this->traceIndent->get(),
+          outs->first, outs->last, this->traceType);
+    }
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
@@ -511,7 +670,7 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::publicInMulti(
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   bool success = true;
   wire_idx i;
   for(i = 0; i < 1 + outs->last - outs->first; i++)
@@ -523,7 +682,7 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::publicInMulti(
       {
       case wtk::StreamStatus::success:
       {
-        if(UNLIKELY(this->maxVal <= val))
+        if(UNLIKELY(this->maxInputVal <= val))
         {
           log_error(
               "%s:%zu: invalid field element (stream line %zu, value %s)",
@@ -549,19 +708,36 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::publicInMulti(
       }
     }
 
-    if(success) { this->backend->publicIn(out_wires + i, std::move(val)); }
+    if(success)
+    {
+      new(out_wires + i) Wire_T();
+      this->backend->publicIn(out_wires + i, std::move(val));
+    }
+    else { break; }
   }
 
-  scope->assigned.insert(outs->first, outs->first + i - 1);
+  if(!this->unchecked())
+  {
+    scope->assigned.insert(outs->first, outs->first + i - 1);
+  }
   scope->active.insert(outs->first, outs->first + i - 1);
 
   return success;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::privateIn(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::privateIn(
     wire_idx const out)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @private(%" PRIu8 ");",
+        this->fileName, this->lineNum, this->traceIndent->get(), out,
+        this->traceType);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
@@ -580,7 +756,7 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::privateIn(
     {
     case wtk::StreamStatus::success:
     {
-      if(UNLIKELY(this->maxVal <= val))
+      if(UNLIKELY(this->maxInputVal <= val))
       {
         log_error("%s:%zu: invalid field element (stream line %zu, value %s)",
             this->fileName, this->lineNum, this->privateInStream->lineNum(),
@@ -602,15 +778,33 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::privateIn(
     }
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   this->backend->privateIn(out_wire, std::move(val));
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::privateInMulti(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::privateInMulti(
     wtk::circuit::Range const* const outs)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    if(outs->first == outs->last)
+    {
+      log_info("    %s:%zu: %s$%" PRIu64 " <- @private(%" PRIu8 ");",
+          this->fileName, this->lineNum, this->traceIndent->get(), outs->first,
+          this->traceType);
+    }
+    else
+    {
+      log_info("    %s:%zu: %s$%" PRIu64 " ... $%" PRIu64 "<- @private(%" PRIu8
+          ");", this->fileName, this->lineNum, this->traceIndent->get(),
+          outs->first, outs->last, this->traceType);
+    }
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
@@ -630,7 +824,7 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::privateInMulti(
     return false;
   }
 
-  this->backend->lineNum = this->lineNum;
+  this->setBackendLine();
   bool success = true;
   wire_idx i;
   for(i = 0; i < 1 + outs->last - outs->first; i++)
@@ -642,7 +836,7 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::privateInMulti(
       {
       case wtk::StreamStatus::success:
       {
-        if(UNLIKELY(this->maxVal <= val))
+        if(UNLIKELY(this->maxInputVal <= val))
         {
           log_error(
               "%s:%zu: invalid field element (stream line %zu, value %s)",
@@ -676,16 +870,28 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::privateInMulti(
     else { break; }
   }
 
-  scope->assigned.insert(outs->first, outs->first + i - 1);
+  if(!this->unchecked())
+  {
+    scope->assigned.insert(outs->first, outs->first + i - 1);
+  }
   scope->active.insert(outs->first, outs->first + i - 1);
 
   return success;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::newRange(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::newRange(
     wire_idx const first, wire_idx const last)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s@new(%" PRIu8 ": $%" PRIu64 " ... $%" PRIu64 ");",
+        this->fileName, this->lineNum, this->traceIndent->get(),
+        this->traceType, first, last);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
   ScopeError err;
 
@@ -700,10 +906,19 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::newRange(
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::deleteRange(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::deleteRange(
     wire_idx const first, wire_idx const last)
 {
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s@delete(%" PRIu8 ": $%" PRIu64 " ... $%" PRIu64
+        ");", this->fileName, this->lineNum, this->traceIndent->get(),
+        this->traceType, first, last);
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
   Scope<Wire_T>* const scope = this->top();
 
   ScopeError err = scope->deleteRange(first, last);
@@ -717,21 +932,23 @@ bool LeadTypeInterpreter<Number_T, Wire_T>::deleteRange(
   return true;
 }
 
-template<typename Number_T, typename Wire_T>
-bool LeadTypeInterpreter<Number_T, Wire_T>::checkNumber(Number_T const& value)
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::checkNumber(
+    Number_T const& value)
 {
   return this->maxVal > value;
 }
 
-template<typename Number_T, typename Wire_T>
+template<typename Number_T, typename Wire_T, typename Policy_T>
 wtk::plugins::WiresRefEraser
-LeadTypeInterpreter<Number_T, Wire_T>::pluginOutput(
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::pluginOutput(
     type_idx const type, wire_idx const first, wire_idx const last)
 {
   ScopeError err = ScopeError::success;
   Wire_T* wires = this->top()->findOutputs(first, last, &err);
   log_assert(wires != nullptr);
-  bool success = this->top()->assigned.insert(first, last);
+  bool success =
+    this->unchecked() || this->top()->assigned.insert(first, last);
   success = this->top()->active.insert(first, last) && success;
   log_assert(success);
 
@@ -745,9 +962,9 @@ LeadTypeInterpreter<Number_T, Wire_T>::pluginOutput(
   return wtk::plugins::WiresRef<Wire_T>(size, wires, type);
 }
 
-template<typename Number_T, typename Wire_T>
+template<typename Number_T, typename Wire_T, typename Policy_T>
 wtk::plugins::WiresRefEraser
-LeadTypeInterpreter<Number_T, Wire_T>::pluginInput(
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::pluginInput(
     type_idx const type, wire_idx const first, wire_idx const last)
 {
   ScopeError err = ScopeError::success;
@@ -757,8 +974,54 @@ LeadTypeInterpreter<Number_T, Wire_T>::pluginInput(
       (size_t) last - first + 1, wires, type);
 }
 
-template<typename Number_T, typename Wire_T>
-void LeadTypeInterpreter<Number_T, Wire_T>::iterPluginHack(
+template<typename Number_T, typename Wire_T, typename Policy_T>
+wtk::plugins::WiresRefEraser
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::pluginOutputRange(
+    type_idx const type, size_t const idx,
+    wire_idx const first, wire_idx const last)
+{
+  Scope<Wire_T>* const scope = this->top();
+  log_assert(idx < scope->ranges.size());
+  log_assert(scope->ranges[idx].remapped);
+  log_assert(scope->offsets[idx] == first);
+
+  bool success = this->unchecked() || scope->assigned.insert(first, last);
+  success = scope->active.insert(first, last) && success;
+  log_assert(success);
+
+  size_t const size = (size_t) last - first + 1;
+  Wire_T* const wires = scope->ranges[idx].wires;
+
+  for(size_t i = 0; i < size; i++)
+  {
+    new(wires + i) Wire_T();
+  }
+
+  return wtk::plugins::WiresRef<Wire_T>(size, wires, type);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+wtk::plugins::WiresRefEraser
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::pluginInputRange(
+    type_idx const type, size_t const idx,
+    wire_idx const first, wire_idx const last)
+{
+  log_assert(idx < this->top()->ranges.size());
+  log_assert(this->top()->ranges[idx].remapped);
+  log_assert(this->top()->offsets[idx] == first);
+
+  return wtk::plugins::WiresRef<Wire_T>(
+      (size_t) last - first + 1, this->top()->ranges[idx].wires, type);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void* LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::topScope()
+{
+  return this->top();
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::iterPluginHack(
     wire_idx const first, wire_idx const last)
 {
   ScopeError err;
@@ -774,10 +1037,741 @@ void LeadTypeInterpreter<Number_T, Wire_T>::iterPluginHack(
   this->top()->active.remove(first, last);
 }
 
-template<typename Number_T, typename Wire_T>
-Number_T LeadTypeInterpreter<Number_T, Wire_T>::getMaxValForIterPlugin()
+template<typename Number_T, typename Wire_T, typename Policy_T>
+Number_T
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::getMaxValForIterPlugin()
 {
   return this->maxVal;
 }
 
+template<typename Number_T, typename Wire_T, typename Policy_T>
+std::unique_ptr<TypeInterpreter<Number_T>>
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::fork()
+{
+  Scope<Wire_T> const* const scope = this->top();
+
+  if(!this->backend->threadSafe()) { return nullptr; }
+
+  for(size_t i = 0; i < scope->ranges.size(); i++)
+  {
+    if(!scope->ranges[i].remapped) { return nullptr; }
+  }
+
+  // Inputs aren't read by forks.
+  LeadTypeInterpreter<Number_T, Wire_T, Policy_T>* const ret =
+    new LeadTypeInterpreter<Number_T, Wire_T, Policy_T>(
+        this->fileName, this->backend, nullptr, nullptr);
+  ret->lineNum = this->lineNum;
+  ret->forked = true;
+  if(this->trusted) { ret->enableTrusted(); }
+
+  Scope<Wire_T>* const bottom = ret->top();
+  for(size_t i = 0; i < scope->ranges.size(); i++)
+  {
+    bottom->mapOutputs(scope->ranges[i].length, scope->ranges[i].wires);
+  }
+
+  bottom->assigned = scope->assigned;
+  bottom->active = scope->active;
+
+  return std::unique_ptr<TypeInterpreter<Number_T>>(ret);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::join(
+    TypeInterpreter<Number_T>* const forked,
+    wire_idx const first, wire_idx const last)
+{
+  Scope<Wire_T> const* const bottom = &static_cast<
+    LeadTypeInterpreter<Number_T, Wire_T, Policy_T>*>(forked)->stack[0];
+  Scope<Wire_T>* const scope = this->top();
+
+  bottom->active.forEach([first, last, scope](wire_idx f, wire_idx l)
+      {
+        if(l < first || f > last) { return; }
+        if(f < first) { f = first; }
+        if(l > last) { l = last; }
+
+        if(!scope->trusted) { scope->assigned.insert(f, l); }
+        scope->active.insert(f, l);
+      });
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::memoizable()
+{
+  return this->backend->supportsMemoization();
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::memoKey(
+    wire_idx const first, wire_idx const last, std::string* const key)
+{
+  Scope<Wire_T> const* const scope = this->top();
+  ScopeError err = ScopeError::success;
+
+  for(wire_idx i = first; i <= last; i++)
+  {
+    Wire_T const* const wire = scope->retrieve(i, &err);
+    if(wire == nullptr) { return false; }
+
+    this->backend->memoKey(wire, key);
+    if(i == last) { break; }
+  }
+
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::memoRead(
+    wire_idx const first, wire_idx const last,
+    std::vector<Number_T>* const values)
+{
+  Scope<Wire_T> const* const scope = this->top();
+  ScopeError err = ScopeError::success;
+
+  for(wire_idx i = first; i <= last; i++)
+  {
+    Wire_T const* const wire = scope->retrieve(i, &err);
+    log_assert(wire != nullptr);
+
+    values->push_back(this->backend->getExtendedWitness(wire));
+    if(i == last) { break; }
+  }
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::memoAssign(
+    wire_idx const first, wire_idx const last, Number_T const* const values)
+{
+  Scope<Wire_T>* const scope = this->top();
+  ScopeError err = ScopeError::success;
+
+  for(wire_idx i = first; i <= last; i++)
+  {
+    Wire_T* const wire = scope->assign(i, &err);
+    if(UNLIKELY(wire == nullptr))
+    {
+      log_error("%s:%zu: (output wire $%" PRIu64 ") %s",
+          this->fileName, this->lineNum, i, scopeErrorString(err));
+      return false;
+    }
+
+    this->backend->memoAssign(wire, values[(size_t) (i - first)]);
+    if(i == last) { break; }
+  }
+
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+std::unique_ptr<wtk::MemoRecord>
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::beginMemo()
+{
+  return this->backend->beginMemo();
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::endMemo(
+    wtk::MemoRecord* const record)
+{
+  this->backend->endMemo(record);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::replayMemo(
+    wtk::MemoRecord const* const record)
+{
+  this->backend->replayMemo(record);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+Wire_T* LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameWire(
+    void* const* frame, wire_idx const slot)
+{
+  return static_cast<Wire_T*>(frame[(size_t) (slot >> FRAME_SEGMENT_SHIFT)])
+    + (size_t) (slot & FRAME_OFFSET_MASK);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::nextInput(
+    InputStream<Number_T>* const stream, char const* const name,
+    Number_T* const val)
+{
+  if(stream == nullptr) { return true; }
+
+  switch(stream->next(val))
+  {
+  case wtk::StreamStatus::success:
+  {
+    if(UNLIKELY(this->maxInputVal <= *val))
+    {
+      log_error("%s:%zu: invalid field element (stream line %zu, value %s)",
+          this->fileName, this->lineNum, stream->lineNum(),
+          wtk::utils::dec(*val).c_str());
+      return false;
+    }
+    return true;
+  }
+  case wtk::StreamStatus::end:
+  {
+    log_error("%s:%zu: %s input stream has reached end (stream line %zu)",
+        this->fileName, this->lineNum, name, stream->lineNum());
+    return false;
+  }
+  case wtk::StreamStatus::error:
+  {
+    return false;
+  }
+  }
+
+  return false;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void* LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::prepareConstant(
+    Number_T const& value)
+{
+  return this->backend->prepareConstant(value);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::releaseConstant(
+    void* constant)
+{
+  this->backend->releaseConstant(constant);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+wtk::TypeBackendEraser<Number_T>*
+LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::erasedBackend() const
+{
+  return this->backend;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::addcPrepared(
+    wire_idx const out, wire_idx const left, void const* right,
+    Number_T const& value)
+{
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @addc(%" PRIu8 ": $%" PRIu64
+        ", < %s >);", this->fileName, this->lineNum, this->traceIndent->get(),
+        out, this->traceType, left, wtk::utils::dec(value).c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+  Scope<Wire_T>* const scope = this->top();
+  ScopeError err;
+
+  if(Policy_T::checks && UNLIKELY(out == left))
+  {
+    log_error("%s:%zu: Cannot retrieve and assign wire $%" PRIu64
+        " in the same directive", this->fileName, this->lineNum, out);
+    return false;
+  }
+
+  Wire_T* const out_wire = scope->assign(out, &err);
+  if(UNLIKELY(out_wire == nullptr))
+  {
+    log_error("%s:%zu: (output wire %" PRIu64 ") %s",
+        this->fileName, this->lineNum, out, scopeErrorString(err));
+    return false;
+  }
+
+  Wire_T const* const left_wire = scope->retrieve(left, &err);
+  if(UNLIKELY(left_wire == nullptr))
+  {
+    log_error("%s:%zu: (input wire %" PRIu64 ") %s",
+        this->fileName, this->lineNum, left, scopeErrorString(err));
+    return false;
+  }
+
+  this->setBackendLine();
+  this->backend->addcPrepared(out_wire, left_wire, right);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mulcPrepared(
+    wire_idx const out, wire_idx const left, void const* right,
+    Number_T const& value)
+{
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- @mulc(%" PRIu8 ": $%" PRIu64
+        ", < %s >);", this->fileName, this->lineNum, this->traceIndent->get(),
+        out, this->traceType, left, wtk::utils::dec(value).c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+  Scope<Wire_T>* const scope = this->top();
+  ScopeError err;
+
+  if(Policy_T::checks && UNLIKELY(out == left))
+  {
+    log_error("%s:%zu: Cannot retrieve and assign wire $%" PRIu64
+        " in the same directive", this->fileName, this->lineNum, out);
+    return false;
+  }
+
+  Wire_T* const out_wire = scope->assign(out, &err);
+  if(UNLIKELY(out_wire == nullptr))
+  {
+    log_error("%s:%zu: (output wire %" PRIu64 ") %s",
+        this->fileName, this->lineNum, out, scopeErrorString(err));
+    return false;
+  }
+
+  Wire_T const* const left_wire = scope->retrieve(left, &err);
+  if(UNLIKELY(left_wire == nullptr))
+  {
+    log_error("%s:%zu: (input wire %" PRIu64 ") %s",
+        this->fileName, this->lineNum, left, scopeErrorString(err));
+    return false;
+  }
+
+  this->setBackendLine();
+  this->backend->mulcPrepared(out_wire, left_wire, right);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::assignPrepared(
+    wire_idx const out, void const* right, Number_T const& value)
+{
+#ifdef WTK_NAILS_ENABLE_TRACES
+  if(this->tracing())
+  {
+    log_info("    %s:%zu: %s$%" PRIu64 " <- %" PRIu8 ": < %s >);",
+        this->fileName, this->lineNum, this->traceIndent->get(), out,
+        this->traceType, wtk::utils::dec(value).c_str());
+  }
+#endif//WTK_NAILS_ENABLE_TRACES
+
+  Scope<Wire_T>* const scope = this->top();
+  ScopeError err;
+
+  Wire_T* const out_wire = scope->assign(out, &err);
+  if(UNLIKELY(out_wire == nullptr))
+  {
+    log_error("%s:%zu: (output wire %" PRIu64 ") %s",
+        this->fileName, this->lineNum, out, scopeErrorString(err));
+    return false;
+  }
+
+  this->setBackendLine();
+  this->backend->assignPrepared(out_wire, right);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::scopeBatch(
+    Gate const* gates, size_t const n, bool const outputs, bool const rights)
+{
+  Scope<Wire_T>* const scope = this->top();
+  ScopeError err;
+
+  if(outputs)
+  {
+    // Assigning may grow (and move) a range, so the outputs are retrieved
+    // only once all of them are assigned.
+    for(size_t i = 0; i < n; i++)
+    {
+      if(UNLIKELY(scope->assign(gates[i].out, &err) == nullptr))
+      {
+        log_error("%s:%zu: (output wire %" PRIu64 ") %s",
+            this->fileName, this->lineNum, gates[i].out,
+            scopeErrorString(err));
+        return false;
+      }
+    }
+
+    this->batchOuts.resize(n);
+    for(size_t i = 0; i < n; i++)
+    {
+      this->batchOuts[i] =
+        const_cast<Wire_T*>(scope->retrieve(gates[i].out, &err));
+      log_assert(this->batchOuts[i] != nullptr);
+    }
+  }
+
+  this->batchLefts.resize(n);
+  if(rights) { this->batchRights.resize(n); }
+
+  for(size_t i = 0; i < n; i++)
+  {
+    this->batchLefts[i] = scope->retrieve(gates[i].left, &err);
+    if(UNLIKELY(this->batchLefts[i] == nullptr))
+    {
+      log_error("%s:%zu: (input wire %" PRIu64 ") %s",
+          this->fileName, this->lineNum, gates[i].left,
+          scopeErrorString(err));
+      return false;
+    }
+
+    if(rights)
+    {
+      this->batchRights[i] = scope->retrieve(gates[i].right, &err);
+      if(UNLIKELY(this->batchRights[i] == nullptr))
+      {
+        log_error("%s:%zu: (input wire %" PRIu64 ") %s",
+            this->fileName, this->lineNum, gates[i].right,
+            scopeErrorString(err));
+        return false;
+      }
+    }
+  }
+
+  this->setBackendLine();
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::batchPrepared(
+    Gate const* gates, size_t const n, void* const* constants)
+{
+  this->batchConstants.resize(n);
+  for(size_t i = 0; i < n; i++)
+  {
+    this->batchConstants[i] = constants[(size_t) gates[i].right];
+  }
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::addGates(
+    Gate const* gates, size_t const n)
+{
+  if(UNLIKELY(!this->scopeBatch(gates, n, true, true))) { return false; }
+
+  this->backend->addGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchRights.data(), n);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mulGates(
+    Gate const* gates, size_t const n)
+{
+  if(UNLIKELY(!this->scopeBatch(gates, n, true, true))) { return false; }
+
+  this->backend->mulGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchRights.data(), n);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::addcGates(
+    Gate const* gates, size_t const n, void* const* constants)
+{
+  if(UNLIKELY(!this->scopeBatch(gates, n, true, false))) { return false; }
+
+  this->batchPrepared(gates, n, constants);
+  this->backend->addcGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchConstants.data(), n);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mulcGates(
+    Gate const* gates, size_t const n, void* const* constants)
+{
+  if(UNLIKELY(!this->scopeBatch(gates, n, true, false))) { return false; }
+
+  this->batchPrepared(gates, n, constants);
+  this->backend->mulcGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchConstants.data(), n);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::assertZeros(
+    Gate const* gates, size_t const n)
+{
+  if(UNLIKELY(!this->scopeBatch(gates, n, false, false))) { return false; }
+
+  this->backend->assertZeros(this->batchLefts.data(), n);
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void* LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::allocateFrame(
+    size_t const length)
+{
+  return malloc(sizeof(Wire_T) * length);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void* LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameParameter(
+    size_t const idx)
+{
+  log_assert(idx < this->top()->ranges.size());
+  log_assert(this->top()->ranges[idx].remapped);
+
+  return this->top()->ranges[idx].wires;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAssigned(
+    wire_idx const length)
+{
+  if(length == 0) { return; }
+
+  if(!this->unchecked()) { this->top()->assigned.insert(0, length - 1); }
+  this->top()->active.insert(0, length - 1);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void* LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameWires(
+    void* const* frame, wire_idx const slot)
+{
+  return this->frameWire(frame, slot);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameDestroy(
+    void* const* frame, wire_idx const slot, wire_idx const length)
+{
+  Wire_T* const wires = this->frameWire(frame, slot);
+  for(size_t i = 0; i < (size_t) length; i++)
+  {
+    wires[i].~Wire_T();
+  }
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAddGate(
+    void* const* frame,
+    wire_idx const out, wire_idx const left, wire_idx const right)
+{
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->addGate(out_wire,
+      this->frameWire(frame, left), this->frameWire(frame, right));
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameMulGate(
+    void* const* frame,
+    wire_idx const out, wire_idx const left, wire_idx const right)
+{
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->mulGate(out_wire,
+      this->frameWire(frame, left), this->frameWire(frame, right));
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAddcGate(
+    void* const* frame,
+    wire_idx const out, wire_idx const left, void const* right)
+{
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->addcPrepared(out_wire, this->frameWire(frame, left), right);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameMulcGate(
+    void* const* frame,
+    wire_idx const out, wire_idx const left, void const* right)
+{
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->mulcPrepared(out_wire, this->frameWire(frame, left), right);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameCopy(
+    void* const* frame, wire_idx const out, wire_idx const left)
+{
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->copy(out_wire, this->frameWire(frame, left));
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAssign(
+    void* const* frame, wire_idx const out, void const* right)
+{
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->assignPrepared(out_wire, right);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAssertZero(
+    void* const* frame, wire_idx const left)
+{
+  this->setBackendLine();
+  this->backend->assertZero(this->frameWire(frame, left));
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameBatch(
+    void* const* frame,
+    Gate const* gates, size_t const n, bool const outputs, bool const rights)
+{
+  if(outputs) { this->batchOuts.resize(n); }
+  this->batchLefts.resize(n);
+  if(rights) { this->batchRights.resize(n); }
+
+  for(size_t i = 0; i < n; i++)
+  {
+    if(outputs)
+    {
+      this->batchOuts[i] = new(this->frameWire(frame, gates[i].out)) Wire_T();
+    }
+
+    this->batchLefts[i] = this->frameWire(frame, gates[i].left);
+
+    if(rights)
+    {
+      this->batchRights[i] = this->frameWire(frame, gates[i].right);
+    }
+  }
+
+  this->setBackendLine();
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAddGates(
+    void* const* frame, Gate const* gates, size_t const n)
+{
+  this->frameBatch(frame, gates, n, true, true);
+  this->backend->addGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchRights.data(), n);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameMulGates(
+    void* const* frame, Gate const* gates, size_t const n)
+{
+  this->frameBatch(frame, gates, n, true, true);
+  this->backend->mulGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchRights.data(), n);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAddcGates(
+    void* const* frame,
+    Gate const* gates, size_t const n, void* const* constants)
+{
+  this->frameBatch(frame, gates, n, true, false);
+  this->batchPrepared(gates, n, constants);
+  this->backend->addcGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchConstants.data(), n);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameMulcGates(
+    void* const* frame,
+    Gate const* gates, size_t const n, void* const* constants)
+{
+  this->frameBatch(frame, gates, n, true, false);
+  this->batchPrepared(gates, n, constants);
+  this->backend->mulcGates(this->batchOuts.data(),
+      this->batchLefts.data(), this->batchConstants.data(), n);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::frameAssertZeros(
+    void* const* frame, Gate const* gates, size_t const n)
+{
+  this->frameBatch(frame, gates, n, false, false);
+  this->backend->assertZeros(this->batchLefts.data(), n);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::framePublicIn(
+    void* const* frame, wire_idx const out)
+{
+  Number_T val = 0;
+  if(UNLIKELY(!this->nextInput(this->publicInStream, "Public", &val)))
+  {
+    return false;
+  }
+
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->publicIn(out_wire, std::move(val));
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::framePrivateIn(
+    void* const* frame, wire_idx const out)
+{
+  Number_T val = 0;
+  if(UNLIKELY(!this->nextInput(this->privateInStream, "Private", &val)))
+  {
+    return false;
+  }
+
+  Wire_T* const out_wire = new(this->frameWire(frame, out)) Wire_T();
+
+  this->setBackendLine();
+  this->backend->privateIn(out_wire, std::move(val));
+  return true;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mapFrameOutput(
+    void* const wires, size_t const length)
+{
+  this->top()->mapOutputs(length, static_cast<Wire_T*>(wires));
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::mapFrameInput(
+    void* const wires, size_t const length)
+{
+  this->top()->mapInputs(length, static_cast<Wire_T*>(wires));
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+bool LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::checkFrameOutput(
+    size_t const length, wire_idx* place)
+{
+  bool const ret = this->unchecked()
+    || this->top()->active.hasAll(*place, *place + length - 1);
+  if(UNLIKELY(!ret))
+  {
+    log_error("%s:%zu: Failed to assign output range $%" PRIu64
+        " ... $%" PRIu64 " of the called function", this->fileName,
+        this->lineNum, *place, *place + length - 1);
+  }
+
+  *place = *place + length;
+  return ret;
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::resetFrame(
+    wire_idx const inputs_first)
+{
+  log_assert(this->stack.size() > 1);
+  this->top()->reset(inputs_first);
+}
+
+template<typename Number_T, typename Wire_T, typename Policy_T>
+void LeadTypeInterpreter<Number_T, Wire_T, Policy_T>::advanceFrame(
+    size_t const idx, wire_idx const stride)
+{
+  log_assert(idx < this->top()->ranges.size());
+  log_assert(this->top()->ranges[idx].remapped);
+
+  this->top()->ranges[idx].wires += stride;
+}
+
 } } // namespace wtk::nails
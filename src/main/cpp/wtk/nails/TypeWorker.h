@@ -0,0 +1,186 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_NAILS_TYPE_WORKER_H_
+#define WTK_NAILS_TYPE_WORKER_H_
+
+#include <cstddef>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <wtk/indexes.h>
+#include <wtk/circuit/Data.h>
+
+#include <wtk/nails/Functions.h>
+#include <wtk/nails/TypeInterpreter.h>
+
+namespace wtk {
+namespace nails {
+
+/**
+ * The TypeWorker evaluates the gates of a single type on its own thread, for
+ * the Interpreter's parallel mode (see Interpreter::enableParallel()).
+ *
+ * Gates are recorded (using the GatesFunction's GateTag and Gate encoding)
+ * into chunks, which are handed to the worker thread when full. The worker
+ * replays each chunk on its TypeInterpreter, which must not be used by any
+ * other thread until synchronize() is called. Calls to functions which use
+ * only this type may be queued as well, and are evaluated by the worker
+ * with an Interpreter of its own (see Interpreter::invoke()).
+ *
+ * Gates are not checked as they are queued. Instead the first failure is
+ * logged by the worker thread, after which its remaining gates are skipped,
+ * and reported by the next call to synchronize() or failed().
+ */
+template<typename Number_T>
+class TypeWorker
+{
+  // A chunk of recorded gates.
+  struct Chunk
+  {
+    std::vector<GateTag> tags;
+    std::vector<Gate> gates;
+    std::vector<size_t> lineNums;
+
+    // Side tables, indexed from the Gate records.
+    std::vector<Number_T> constants;
+    std::vector<wtk::circuit::CopyMulti> copyMultis;
+
+    // A function call, and the Interpreter to evaluate it with.
+    struct Call
+    {
+      wtk::circuit::FunctionCall call;
+      Function<Number_T>* function;
+      Interpreter<Number_T>* interpreter;
+
+      Call(wtk::circuit::FunctionCall const& c,
+          Function<Number_T>* const f, Interpreter<Number_T>* const i)
+        : call(c), function(f), interpreter(i) { }
+    };
+
+    std::vector<Call> calls;
+
+    void clear();
+  };
+
+  // Number of gates in each chunk.
+  static constexpr size_t CHUNK_SIZE = 4096;
+
+  // Number of chunks which may be queued before the producer waits.
+  static constexpr size_t MAX_PENDING = 16;
+
+  TypeInterpreter<Number_T>* const interpreter;
+
+  // The chunk being filled by the producer.
+  std::unique_ptr<Chunk> filling;
+
+  // Fields shared with the worker thread, guarded by the mutex.
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+  std::deque<std::unique_ptr<Chunk>> pending;
+  std::vector<std::unique_ptr<Chunk>> spares;
+  size_t outstanding = 0;
+  bool stop = false;
+
+  std::atomic<bool> failure;
+
+  std::thread thread;
+
+  void record(GateTag::Operation const op, wire_idx const out,
+      wire_idx const left, wire_idx const right, size_t const line_num);
+
+  // Hand the filling chunk off to the worker thread.
+  void flush();
+
+  // Replay a chunk, returning false on failure.
+  bool replay(Chunk* const chunk);
+
+  // The worker thread's loop.
+  void run();
+
+public:
+  TypeWorker(TypeInterpreter<Number_T>* const interp);
+
+  // Queue gates. Each returns false if a prior gate has failed.
+  bool addGate(wire_idx const out,
+      wire_idx const left, wire_idx const right, size_t const line_num);
+
+  bool mulGate(wire_idx const out,
+      wire_idx const left, wire_idx const right, size_t const line_num);
+
+  bool addcGate(wire_idx const out,
+      wire_idx const left, Number_T&& right, size_t const line_num);
+
+  bool mulcGate(wire_idx const out,
+      wire_idx const left, Number_T&& right, size_t const line_num);
+
+  bool copy(wire_idx const out, wire_idx const left, size_t const line_num);
+
+  bool copyMulti(
+      wtk::circuit::CopyMulti const* const multi, size_t const line_num);
+
+  bool assign(wire_idx const out, Number_T&& right, size_t const line_num);
+
+  bool assertZero(wire_idx const left, size_t const line_num);
+
+  bool publicIn(wire_idx const out, size_t const line_num);
+
+  bool publicInMulti(
+      wtk::circuit::Range const* const outs, size_t const line_num);
+
+  bool privateIn(wire_idx const out, size_t const line_num);
+
+  bool privateInMulti(
+      wtk::circuit::Range const* const outs, size_t const line_num);
+
+  bool newRange(
+      wire_idx const first, wire_idx const last, size_t const line_num);
+
+  bool deleteRange(
+      wire_idx const first, wire_idx const last, size_t const line_num);
+
+  /**
+   * Queue a call to a function which uses only this type. The call is
+   * copied, and evaluated by the worker with the given Interpreter, which
+   * must not be used by any other thread.
+   */
+  bool call(wtk::circuit::FunctionCall const* const call,
+      Function<Number_T>* const function,
+      Interpreter<Number_T>* const interpreter, size_t const line_num);
+
+  /**
+   * Wait for all queued gates to be evaluated, after which the
+   * TypeInterpreter may be used by the caller's thread. Returns false if
+   * any gate failed.
+   */
+  bool synchronize();
+
+  /**
+   * Indicates if a gate has failed (without waiting).
+   */
+  bool failed() const { return this->failure.load(std::memory_order_relaxed); }
+
+  TypeWorker(TypeWorker const&) = delete;
+  TypeWorker& operator=(TypeWorker const&) = delete;
+
+  ~TypeWorker();
+};
+
+} } // namespace wtk::nails
+
+#define LOG_IDENTIFIER "wtk::nails"
+#include <stealth_logging.h>
+
+#include <wtk/nails/TypeWorker.t.h>
+
+#define LOG_UNINCLUDE
+#include <stealth_logging.h>
+
+#endif//WTK_NAILS_TYPE_WORKER_H_
@@ -0,0 +1,360 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+namespace wtk {
+namespace nails {
+
+template<typename Number_T>
+void TypeWorker<Number_T>::Chunk::clear()
+{
+  this->tags.clear();
+  this->gates.clear();
+  this->lineNums.clear();
+  this->constants.clear();
+  this->copyMultis.clear();
+  this->calls.clear();
+}
+
+template<typename Number_T>
+TypeWorker<Number_T>::TypeWorker(TypeInterpreter<Number_T>* const interp)
+  : interpreter(interp), filling(new Chunk()), failure(false)
+{
+  this->thread = std::thread(&TypeWorker<Number_T>::run, this);
+}
+
+template<typename Number_T>
+void TypeWorker<Number_T>::record(GateTag::Operation const op,
+    wire_idx const out, wire_idx const left, wire_idx const right,
+    size_t const line_num)
+{
+  this->filling->tags.emplace_back(op, 0);
+  this->filling->gates.emplace_back(out, left, right);
+  this->filling->lineNums.push_back(line_num);
+
+  if(UNLIKELY(this->filling->gates.size() >= CHUNK_SIZE)) { this->flush(); }
+}
+
+template<typename Number_T>
+void TypeWorker<Number_T>::flush()
+{
+  if(this->filling->gates.empty()) { return; }
+
+  std::unique_lock<std::mutex> lock(this->mutex);
+
+  // Wait for the worker to catch up, rather than queuing without bound.
+  this->done.wait(lock,
+      [this]() { return this->pending.size() < MAX_PENDING; });
+
+  this->pending.emplace_back(std::move(this->filling));
+  this->outstanding++;
+
+  if(this->spares.empty())
+  {
+    this->filling = std::unique_ptr<Chunk>(new Chunk());
+  }
+  else
+  {
+    this->filling = std::move(this->spares.back());
+    this->spares.pop_back();
+  }
+
+  lock.unlock();
+  this->wake.notify_one();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::synchronize()
+{
+  this->flush();
+
+  std::unique_lock<std::mutex> lock(this->mutex);
+  this->done.wait(lock, [this]() { return this->outstanding == 0; });
+
+  return !this->failed();
+}
+
+template<typename Number_T>
+void TypeWorker<Number_T>::run()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+
+  while(true)
+  {
+    this->wake.wait(lock,
+        [this]() { return this->stop || !this->pending.empty(); });
+
+    if(this->stop) { break; }
+
+    std::unique_ptr<Chunk> chunk = std::move(this->pending.front());
+    this->pending.pop_front();
+    lock.unlock();
+
+    // After a failure, remaining gates are discarded.
+    if(!this->failed() && UNLIKELY(!this->replay(chunk.get())))
+    {
+      this->failure.store(true, std::memory_order_relaxed);
+    }
+
+    chunk->clear();
+
+    lock.lock();
+    this->spares.emplace_back(std::move(chunk));
+    this->outstanding--;
+    this->done.notify_all();
+  }
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::replay(Chunk* const chunk)
+{
+  TypeInterpreter<Number_T>* const interp = this->interpreter;
+
+  for(size_t i = 0; i < chunk->gates.size(); i++)
+  {
+    Gate const* const gate = &chunk->gates[i];
+    interp->lineNum = chunk->lineNums[i];
+
+    bool success = true;
+    switch(chunk->tags[i].operation)
+    {
+    case GateTag::add:
+    {
+      success = interp->addGate(gate->out, gate->left, gate->right);
+      break;
+    }
+    case GateTag::mul:
+    {
+      success = interp->mulGate(gate->out, gate->left, gate->right);
+      break;
+    }
+    case GateTag::addc:
+    {
+      success = interp->addcGate(gate->out, gate->left,
+          std::move(chunk->constants[(size_t) gate->right]));
+      break;
+    }
+    case GateTag::mulc:
+    {
+      success = interp->mulcGate(gate->out, gate->left,
+          std::move(chunk->constants[(size_t) gate->right]));
+      break;
+    }
+    case GateTag::copy:
+    {
+      success = interp->copy(gate->out, gate->left);
+      break;
+    }
+    case GateTag::copyMulti:
+    {
+      success = interp->copyMulti(&chunk->copyMultis[(size_t) gate->right]);
+      break;
+    }
+    case GateTag::assign:
+    {
+      success = interp->assign(
+          gate->out, std::move(chunk->constants[(size_t) gate->right]));
+      break;
+    }
+    case GateTag::assertZero:
+    {
+      success = interp->assertZero(gate->left);
+      break;
+    }
+    case GateTag::publicIn:
+    {
+      success = interp->publicIn(gate->out);
+      break;
+    }
+    case GateTag::publicInMulti:
+    {
+      wtk::circuit::Range const range(gate->out, gate->left);
+      success = interp->publicInMulti(&range);
+      break;
+    }
+    case GateTag::privateIn:
+    {
+      success = interp->privateIn(gate->out);
+      break;
+    }
+    case GateTag::privateInMulti:
+    {
+      wtk::circuit::Range const range(gate->out, gate->left);
+      success = interp->privateInMulti(&range);
+      break;
+    }
+    case GateTag::newRange:
+    {
+      success = interp->newRange(gate->out, gate->left);
+      break;
+    }
+    case GateTag::deleteRange:
+    {
+      success = interp->deleteRange(gate->out, gate->left);
+      break;
+    }
+    case GateTag::call_:
+    {
+      typename Chunk::Call* const call = &chunk->calls[(size_t) gate->right];
+      call->interpreter->lineNum = chunk->lineNums[i];
+      success = call->interpreter->invoke(&call->call, call->function);
+      break;
+    }
+    default:
+    {
+      log_assert(false, "unexpected gate in type worker");
+      break;
+    }
+    }
+
+    if(UNLIKELY(!success)) { return false; }
+  }
+
+  return true;
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::addGate(wire_idx const out,
+    wire_idx const left, wire_idx const right, size_t const line_num)
+{
+  this->record(GateTag::add, out, left, right, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::mulGate(wire_idx const out,
+    wire_idx const left, wire_idx const right, size_t const line_num)
+{
+  this->record(GateTag::mul, out, left, right, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::addcGate(wire_idx const out,
+    wire_idx const left, Number_T&& right, size_t const line_num)
+{
+  wire_idx const idx = (wire_idx) this->filling->constants.size();
+  this->filling->constants.emplace_back(std::move(right));
+  this->record(GateTag::addc, out, left, idx, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::mulcGate(wire_idx const out,
+    wire_idx const left, Number_T&& right, size_t const line_num)
+{
+  wire_idx const idx = (wire_idx) this->filling->constants.size();
+  this->filling->constants.emplace_back(std::move(right));
+  this->record(GateTag::mulc, out, left, idx, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::copy(
+    wire_idx const out, wire_idx const left, size_t const line_num)
+{
+  this->record(GateTag::copy, out, left, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::copyMulti(
+    wtk::circuit::CopyMulti const* const multi, size_t const line_num)
+{
+  wire_idx const idx = (wire_idx) this->filling->copyMultis.size();
+  this->filling->copyMultis.emplace_back(*multi);
+  this->record(GateTag::copyMulti, 0, 0, idx, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::assign(
+    wire_idx const out, Number_T&& right, size_t const line_num)
+{
+  wire_idx const idx = (wire_idx) this->filling->constants.size();
+  this->filling->constants.emplace_back(std::move(right));
+  this->record(GateTag::assign, out, 0, idx, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::assertZero(
+    wire_idx const left, size_t const line_num)
+{
+  this->record(GateTag::assertZero, 0, left, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::publicIn(wire_idx const out, size_t const line_num)
+{
+  this->record(GateTag::publicIn, out, 0, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::publicInMulti(
+    wtk::circuit::Range const* const outs, size_t const line_num)
+{
+  this->record(GateTag::publicInMulti, outs->first, outs->last, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::privateIn(wire_idx const out, size_t const line_num)
+{
+  this->record(GateTag::privateIn, out, 0, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::privateInMulti(
+    wtk::circuit::Range const* const outs, size_t const line_num)
+{
+  this->record(GateTag::privateInMulti, outs->first, outs->last, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::newRange(
+    wire_idx const first, wire_idx const last, size_t const line_num)
+{
+  this->record(GateTag::newRange, first, last, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::deleteRange(
+    wire_idx const first, wire_idx const last, size_t const line_num)
+{
+  this->record(GateTag::deleteRange, first, last, 0, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+bool TypeWorker<Number_T>::call(wtk::circuit::FunctionCall const* const call,
+    Function<Number_T>* const function,
+    Interpreter<Number_T>* const interpreter, size_t const line_num)
+{
+  wire_idx const idx = (wire_idx) this->filling->calls.size();
+  this->filling->calls.emplace_back(*call, function, interpreter);
+  this->record(GateTag::call_, 0, 0, idx, line_num);
+  return !this->failed();
+}
+
+template<typename Number_T>
+TypeWorker<Number_T>::~TypeWorker()
+{
+  // Gates which weren't synchronized are discarded, as the backend may
+  // already be gone.
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stop = true;
+    this->pending.clear();
+  }
+
+  this->wake.notify_one();
+  this->thread.join();
+}
+
+} } // namespace wtk::nails
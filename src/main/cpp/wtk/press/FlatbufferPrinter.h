@@ -205,6 +205,23 @@ public:
     return true;
   }
 
+  bool printExtFieldType(type_idx const base_field,
+      size_t const degree, Number_T const& modulus) override
+  {
+    // The schema limits the reduction polynomial to 64 bits.
+    if(modulus > Number_T(UINT64_MAX))
+    {
+      log_error("extension field's reduction polynomial %s exceeds 64 bits",
+          wtk::utils::dec(modulus).c_str());
+      return false;
+    }
+
+    this->types.push_back(CreateType(this->builder, TypeU_ExtField,
+          CreateExtField(this->builder, base_field, degree,
+            static_cast<uint64_t>(modulus)).Union()));
+    return true;
+  }
+
   bool printPluginType(
       wtk::circuit::PluginBinding<Number_T> const* const plugin) override
   {
@@ -58,6 +58,15 @@ public:
     return true;
   }
 
+  bool printExtFieldType(type_idx const base_field,
+      size_t const degree, Number_T const& modulus) override
+  {
+    (void) base_field;
+    (void) degree;
+    (void) modulus;
+    return true;
+  }
+
   bool printPluginType(
       wtk::circuit::PluginBinding<Number_T> const* const plugin) override
   {
@@ -37,6 +37,9 @@ public:
 
   virtual bool printRingType(size_t const bit_width) = 0;
 
+  virtual bool printExtFieldType(type_idx const base_field,
+      size_t const degree, Number_T const& modulus) = 0;
+
   virtual bool printPluginType(
       wtk::circuit::PluginBinding<Number_T> const* const plugin) = 0;
 
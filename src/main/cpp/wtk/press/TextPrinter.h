@@ -110,6 +110,16 @@ public:
     return true;
   }
 
+  bool printExtFieldType(type_idx const base_field,
+      size_t const degree, Number_T const& modulus) override
+  {
+    PRINTLN("@type ext_field %s %s %s;",
+        wtk::utils::short_str((size_t) base_field).c_str(),
+        wtk::utils::short_str(degree).c_str(),
+        wtk::utils::short_str(modulus).c_str());
+    return true;
+  }
+
   bool printPluginBinding(
       wtk::circuit::PluginBinding<Number_T> const* const plugin)
   {
@@ -227,6 +227,15 @@ int doCircuit(
       if(!printer->printRingType(parser->types[i].bitWidth)) { return 1; }
       break;
     }
+    case wtk::circuit::TypeSpec<sst::bignum>::extField:
+    {
+      if(!printer->printExtFieldType(parser->types[i].baseField,
+            parser->types[i].degree, parser->types[i].modulus))
+      {
+        return 1;
+      }
+      break;
+    }
     case wtk::circuit::TypeSpec<sst::bignum>::plugin:
     {
       if(!printer->printPluginType(&parser->types[i].binding)) { return 1; }
@@ -264,6 +273,15 @@ int doStream(
   {
     if(!printer->printRingType(stream->type->bitWidth)) { return 1; }
   }
+  else if(stream->type->variety
+      == wtk::circuit::TypeSpec<sst::bignum>::extField)
+  {
+    if(!printer->printExtFieldType(stream->type->baseField,
+          stream->type->degree, stream->type->modulus))
+    {
+      return 1;
+    }
+  }
 
   if(!printer->printBeginKw()) { return 1; }
 
@@ -0,0 +1,175 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <openssl/evp.h>
+
+#include <wtk/versions.h>
+#include <wtk/utils/Certificate.h>
+
+#define LOG_IDENTIFIER "wtk::utils"
+#include <stealth_logging.h>
+
+namespace wtk {
+namespace utils {
+
+namespace {
+
+std::string versionString()
+{
+  char buf[64];
+  if(wtk::WTK_VERSION_EXTRA == nullptr || wtk::WTK_VERSION_EXTRA[0] == '\0')
+  {
+    snprintf(buf, sizeof(buf), "%zu.%zu.%zu", wtk::WTK_VERSION_MAJOR,
+        wtk::WTK_VERSION_MINOR, wtk::WTK_VERSION_PATCH);
+  }
+  else
+  {
+    snprintf(buf, sizeof(buf), "%zu.%zu.%zu-%s", wtk::WTK_VERSION_MAJOR,
+        wtk::WTK_VERSION_MINOR, wtk::WTK_VERSION_PATCH,
+        wtk::WTK_VERSION_EXTRA);
+  }
+
+  return std::string(buf);
+}
+
+// Read one line (without its newline) from the file.
+bool readLine(FILE* const file, std::string* const line)
+{
+  line->clear();
+  int c = fgetc(file);
+  if(c == EOF) { return false; }
+
+  while(c != EOF && c != '\n')
+  {
+    line->push_back((char) c);
+    c = fgetc(file);
+  }
+
+  return true;
+}
+
+} // namespace
+
+bool hashFile(char const* const file_name, std::string* const digest)
+{
+  FILE* const file = fopen(file_name, "rb");
+  if(file == nullptr)
+  {
+    log_error("Could not open file \'%s\' for hashing", file_name);
+    return false;
+  }
+
+  EVP_MD_CTX* const ctx = EVP_MD_CTX_new();
+  bool ret = ctx != nullptr
+    && 1 == EVP_DigestInit_ex(ctx, EVP_sha256(), nullptr);
+
+  uint8_t buf[4096];
+  size_t len;
+  while(ret && 0 != (len = fread(buf, 1, sizeof(buf), file)))
+  {
+    ret = 1 == EVP_DigestUpdate(ctx, buf, len);
+  }
+
+  ret = ret && 0 == ferror(file);
+  fclose(file);
+
+  unsigned char hash[EVP_MAX_MD_SIZE];
+  unsigned int hash_len = 0;
+  ret = ret && 1 == EVP_DigestFinal_ex(ctx, hash, &hash_len);
+  EVP_MD_CTX_free(ctx);
+
+  if(!ret)
+  {
+    log_error("Could not read file \'%s\' for hashing", file_name);
+    return false;
+  }
+
+  char const* const hex = "0123456789abcdef";
+  digest->clear();
+  for(unsigned int i = 0; i < hash_len; i++)
+  {
+    digest->push_back(hex[hash[i] >> 4]);
+    digest->push_back(hex[hash[i] & 0x0f]);
+  }
+
+  return true;
+}
+
+bool writeCertificate(
+    char const* const cert_name, char const* const relation_name)
+{
+  std::string digest;
+  if(!hashFile(relation_name, &digest)) { return false; }
+
+  FILE* const file = fopen(cert_name, "w");
+  if(file == nullptr)
+  {
+    log_error("Could not open certificate \'%s\' for writing", cert_name);
+    return false;
+  }
+
+  int const written = fprintf(file, "wtk-certificate\nversion: %s\n"
+      "relation: %s\n", versionString().c_str(), digest.c_str());
+
+  if(0 != fclose(file) || written < 0)
+  {
+    log_error("Could not write certificate \'%s\'", cert_name);
+    return false;
+  }
+
+  return true;
+}
+
+bool checkCertificate(
+    char const* const cert_name, char const* const relation_name)
+{
+  FILE* const file = fopen(cert_name, "r");
+  if(file == nullptr)
+  {
+    log_error("Could not open certificate \'%s\'", cert_name);
+    return false;
+  }
+
+  std::string magic;
+  std::string version;
+  std::string relation;
+  bool const read = readLine(file, &magic)
+    && readLine(file, &version) && readLine(file, &relation);
+  fclose(file);
+
+  if(!read || magic != "wtk-certificate"
+      || 0 != version.compare(0, 9, "version: ")
+      || 0 != relation.compare(0, 10, "relation: "))
+  {
+    log_error("Certificate \'%s\' is malformed", cert_name);
+    return false;
+  }
+
+  if(version.substr(9) != versionString())
+  {
+    log_error("Certificate \'%s\' is from WizToolKit version %s, not %s",
+        cert_name, version.c_str() + 9, versionString().c_str());
+    return false;
+  }
+
+  std::string digest;
+  if(!hashFile(relation_name, &digest)) { return false; }
+
+  if(relation.substr(10) != digest)
+  {
+    log_error("Certificate \'%s\' does not match relation \'%s\'",
+        cert_name, relation_name);
+    return false;
+  }
+
+  return true;
+}
+
+} } // namespace wtk::utils
@@ -0,0 +1,46 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_UTILS_CERTIFICATE_H_
+#define WTK_UTILS_CERTIFICATE_H_
+
+#include <string>
+
+namespace wtk {
+namespace utils {
+
+/**
+ * Hash a file with SHA-256 (by OpenSSL), returning its lowercase hexadecimal
+ * digest, or false if it cannot be read.
+ */
+bool hashFile(char const* const file_name, std::string* const digest);
+
+/**
+ * A validation certificate records that a relation was checked by
+ * wtk-firealarm, so that later evaluations of the same relation may run in
+ * NAILS' trusted mode (see wtk::nails::Interpreter::enableTrusted()).
+ *
+ * The certificate is a short text file which holds the WizToolKit version and
+ * the SHA-256 of the relation file, as follows.
+ *
+ *   wtk-certificate
+ *   version: 2.1.0
+ *   relation: <sha256 hex digest>
+ *
+ * A certificate is only valid for the same relation file and the same
+ * version of WizToolKit which wrote it.
+ */
+bool writeCertificate(
+    char const* const cert_name, char const* const relation_name);
+
+/**
+ * Check a certificate, returning true if it matches the relation and the
+ * current WizToolKit version. Mismatches are logged as errors.
+ */
+bool checkCertificate(
+    char const* const cert_name, char const* const relation_name);
+
+} } // namespace wtk::utils
+
+#endif//WTK_UTILS_CERTIFICATE_H_
@@ -0,0 +1,191 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_UTILS_EXTENSION_H_
+#define WTK_UTILS_EXTENSION_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <wtk/utils/Modulus.h>
+
+namespace wtk {
+namespace utils {
+
+/**
+ * An element of an extension field, as a polynomial of degree less than N
+ * with coefficients in a base field of at most 64 bits. Coefficients are
+ * stored least significant first, and those at or above the extension's
+ * degree are zero. It is trivially copyable, so it may be stored in a Scope
+ * without allocation.
+ */
+template<size_t N>
+struct ExtElement
+{
+  uint64_t coeffs[N];
+
+  ExtElement()
+  {
+    for(size_t i = 0; i < N; i++) { this->coeffs[i] = 0; }
+  }
+
+  // The constant polynomial c.
+  explicit ExtElement(uint64_t const c) : ExtElement()
+  {
+    this->coeffs[0] = c;
+  }
+
+  friend bool operator==(ExtElement const& a, ExtElement const& b)
+  {
+    for(size_t i = 0; i < N; i++)
+    {
+      if(a.coeffs[i] != b.coeffs[i]) { return false; }
+    }
+
+    return true;
+  }
+
+  friend bool operator!=(ExtElement const& a, ExtElement const& b)
+  {
+    return !(a == b);
+  }
+
+  // Indicates if the element is zero.
+  bool isZero() const
+  {
+    uint64_t any = 0;
+    for(size_t i = 0; i < N; i++) { any |= this->coeffs[i]; }
+    return any == 0;
+  }
+};
+
+/**
+ * Karatsuba multiplication of two polynomials of N coefficients (N a power
+ * of two), producing 2 N - 1 coefficients. Each level splits the operands
+ * in half and uses three half-size products, rather than four.
+ */
+template<size_t N>
+struct Karatsuba
+{
+  static_assert((N & (N - 1)) == 0, "Karatsuba requires a power of two");
+
+  static void mul(Modulus<uint64_t> const& base,
+      uint64_t const* const a, uint64_t const* const b, uint64_t* const out)
+  {
+    constexpr size_t H = N / 2;
+
+    uint64_t low[2 * H - 1];
+    uint64_t high[2 * H - 1];
+    Karatsuba<H>::mul(base, a, b, low);
+    Karatsuba<H>::mul(base, a + H, b + H, high);
+
+    // (a_low + a_high) (b_low + b_high) - low - high is the middle term.
+    uint64_t a_sum[H];
+    uint64_t b_sum[H];
+    for(size_t i = 0; i < H; i++)
+    {
+      a_sum[i] = base.add(a[i], a[i + H]);
+      b_sum[i] = base.add(b[i], b[i + H]);
+    }
+
+    uint64_t mid[2 * H - 1];
+    Karatsuba<H>::mul(base, a_sum, b_sum, mid);
+
+    for(size_t i = 0; i < 2 * N - 1; i++) { out[i] = 0; }
+    for(size_t i = 0; i < 2 * H - 1; i++)
+    {
+      uint64_t const m = subtract(base, subtract(base, mid[i], low[i]),
+          high[i]);
+      out[i] = base.add(out[i], low[i]);
+      out[i + H] = base.add(out[i + H], m);
+      out[i + 2 * H] = base.add(out[i + 2 * H], high[i]);
+    }
+  }
+
+  static uint64_t subtract(Modulus<uint64_t> const& base,
+      uint64_t const a, uint64_t const b)
+  {
+    return b == 0 ? a : base.add(a, base.prime - b);
+  }
+};
+
+template<>
+struct Karatsuba<1>
+{
+  static void mul(Modulus<uint64_t> const& base,
+      uint64_t const* const a, uint64_t const* const b, uint64_t* const out)
+  {
+    out[0] = base.mul(a[0], b[0]);
+  }
+};
+
+/**
+ * Arithmetic in an extension field of the given degree (at most N) over a
+ * prime field, modulo a monic reduction polynomial. The base field's
+ * arithmetic is by Modulus<uint64_t>, so without
+ * WTK_UTILS_MODULUS_WIDE_64 its prime must be less than 2^32.
+ *
+ * Products are by Karatsuba multiplication, and then reduced from the top
+ * coefficient down, using x^degree = -(m_(d-1) x^(d-1) + ... + m_0), which
+ * is precomputed.
+ */
+template<size_t N>
+struct Extension
+{
+  Modulus<uint64_t> const base;
+  size_t const degree;
+
+  // Coefficients of x^degree after reduction.
+  uint64_t reduction[N];
+
+  // The modulus gives the reduction polynomial's coefficients, excluding
+  // its leading 1, least significant first.
+  Extension(uint64_t const prime, size_t const d,
+      uint64_t const* const modulus)
+    : base(prime), degree(d)
+  {
+    for(size_t i = 0; i < N; i++)
+    {
+      this->reduction[i] = (i >= d || modulus[i] == 0) ? 0 : prime - modulus[i];
+    }
+  }
+
+  ExtElement<N> add(ExtElement<N> const& a, ExtElement<N> const& b) const
+  {
+    ExtElement<N> sum;
+    for(size_t i = 0; i < this->degree; i++)
+    {
+      sum.coeffs[i] = this->base.add(a.coeffs[i], b.coeffs[i]);
+    }
+
+    return sum;
+  }
+
+  ExtElement<N> mul(ExtElement<N> const& a, ExtElement<N> const& b) const
+  {
+    uint64_t product[2 * N - 1];
+    Karatsuba<N>::mul(this->base, a.coeffs, b.coeffs, product);
+
+    for(size_t i = 2 * this->degree - 1; i > this->degree; i--)
+    {
+      uint64_t const top = product[i - 1];
+      if(top == 0) { continue; }
+
+      size_t const shift = i - 1 - this->degree;
+      for(size_t j = 0; j < this->degree; j++)
+      {
+        product[shift + j] = this->base.add(product[shift + j],
+            this->base.mul(top, this->reduction[j]));
+      }
+    }
+
+    ExtElement<N> ret;
+    for(size_t i = 0; i < this->degree; i++) { ret.coeffs[i] = product[i]; }
+    return ret;
+  }
+};
+
+} } // namespace wtk::utils
+
+#endif//WTK_UTILS_EXTENSION_H_
@@ -0,0 +1,153 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_UTILS_FIXED_UINT_H_
+#define WTK_UTILS_FIXED_UINT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <wtk/utils/NumUtils.h>
+
+namespace wtk {
+namespace utils {
+
+/**
+ * An unsigned integer of N 64-bit limbs, for wire values of fields too
+ * large for uint64_t (see Modulus<FixedUint<N>>). It is trivially copyable,
+ * so it may be stored in a Scope without allocation.
+ *
+ * It only has the operations needed to move values in and out of a
+ * FieldBackend: conversion to and from integers and the Number_T, and
+ * comparison.
+ */
+template<size_t N>
+struct FixedUint
+{
+  static_assert(N > 0, "FixedUint requires at least one limb");
+
+  // Limbs, least significant first.
+  uint64_t limbs[N];
+
+  FixedUint(uint64_t const value = 0)
+  {
+    this->limbs[0] = value;
+    for(size_t i = 1; i < N; i++) { this->limbs[i] = 0; }
+  }
+
+  // Convert from a Number_T (e.g. sst::bignum), truncating to N limbs.
+  template<typename Number_T, typename std::enable_if<
+    !std::is_integral<Number_T>::value, int>::type = 0>
+  explicit FixedUint(Number_T const& value)
+  {
+    for(size_t i = 0; i < N; i++)
+    {
+      this->limbs[i] =
+        static_cast<uint64_t>((value >> (64 * i)) & UINT64_MAX);
+    }
+  }
+
+  // Convert to an integer, saturating at its maximum (e.g. so that a RAM
+  // index which is too large remains too large).
+  template<typename Int_T, typename std::enable_if<
+    std::is_integral<Int_T>::value, int>::type = 0>
+  explicit operator Int_T() const
+  {
+    uint64_t const max = (uint64_t) std::numeric_limits<Int_T>::max();
+    for(size_t i = 1; i < N; i++)
+    {
+      if(this->limbs[i] != 0) { return static_cast<Int_T>(max); }
+    }
+
+    return static_cast<Int_T>(this->limbs[0] > max ? max : this->limbs[0]);
+  }
+
+  // Convert to a Number_T (e.g. sst::bignum).
+  template<typename Number_T, typename std::enable_if<
+    !std::is_integral<Number_T>::value, int>::type = 0>
+  explicit operator Number_T() const
+  {
+    Number_T ret(this->limbs[N - 1]);
+    for(size_t i = N - 1; i > 0; i--)
+    {
+      ret = Number_T(ret << 64);
+      ret = Number_T(ret + Number_T(this->limbs[i - 1]));
+    }
+
+    return ret;
+  }
+
+  friend bool operator==(FixedUint const& a, FixedUint const& b)
+  {
+    for(size_t i = 0; i < N; i++)
+    {
+      if(a.limbs[i] != b.limbs[i]) { return false; }
+    }
+
+    return true;
+  }
+
+  friend bool operator!=(FixedUint const& a, FixedUint const& b)
+  {
+    return !(a == b);
+  }
+
+  friend bool operator<(FixedUint const& a, FixedUint const& b)
+  {
+    for(size_t i = N; i > 0; i--)
+    {
+      if(a.limbs[i - 1] != b.limbs[i - 1])
+      {
+        return a.limbs[i - 1] < b.limbs[i - 1];
+      }
+    }
+
+    return false;
+  }
+};
+
+// Decimal string of a FixedUint, by division into 9-digit chunks.
+template<size_t N>
+std::string dec(FixedUint<N> const& num)
+{
+  constexpr uint64_t CHUNK = 1000000000;
+
+  FixedUint<N> quotient = num;
+  std::string ret;
+  do
+  {
+    // Long division of the quotient by CHUNK, a half-limb at a time, so
+    // that each partial dividend fits in 64 bits.
+    uint64_t remainder = 0;
+    for(size_t i = N; i > 0; i--)
+    {
+      uint64_t const high = (remainder << 32) | (quotient.limbs[i - 1] >> 32);
+      remainder = high % CHUNK;
+      uint64_t const low =
+        (remainder << 32) | (quotient.limbs[i - 1] & UINT32_MAX);
+      remainder = low % CHUNK;
+      quotient.limbs[i - 1] = ((high / CHUNK) << 32) | (low / CHUNK);
+    }
+
+    bool const last = quotient == FixedUint<N>(0);
+    for(size_t i = 0; i < 9 && (!last || remainder != 0); i++)
+    {
+      ret.push_back((char) ('0' + remainder % 10));
+      remainder /= 10;
+    }
+  } while(quotient != FixedUint<N>(0));
+
+  if(ret.empty()) { ret.push_back('0'); }
+
+  std::reverse(ret.begin(), ret.end());
+  return ret;
+}
+
+} } // namespace wtk::utils
+
+#endif//WTK_UTILS_FIXED_UINT_H_
@@ -0,0 +1,53 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_UTILS_MEM_STATS_H_
+#define WTK_UTILS_MEM_STATS_H_
+
+#include <cstddef>
+
+namespace wtk {
+namespace utils {
+
+/**
+ * Memory accounting for one kind of storage (e.g. a type's wires or a
+ * Pool's items), in bytes. It is not synchronized, so each MemStats must
+ * only be updated by one thread at a time.
+ */
+struct MemStats
+{
+  // Total bytes allocated, including those since released.
+  size_t allocated = 0;
+
+  // Bytes currently allocated.
+  size_t live = 0;
+
+  // Maximum of live bytes.
+  size_t peak = 0;
+
+  void allocate(size_t const bytes)
+  {
+    this->allocated += bytes;
+    this->live += bytes;
+    if(this->live > this->peak) { this->peak = this->live; }
+  }
+
+  void release(size_t const bytes)
+  {
+    this->live -= bytes;
+  }
+
+  // Sum with other stats. The peak of a sum is the sum of peaks, which may
+  // exceed the true peak if the others peaked at different times.
+  void addTotal(MemStats const* const other)
+  {
+    this->allocated += other->allocated;
+    this->live += other->live;
+    this->peak += other->peak;
+  }
+};
+
+} } // namespace wtk::utils
+
+#endif//WTK_UTILS_MEM_STATS_H_
@@ -0,0 +1,529 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_UTILS_MODULUS_H_
+#define WTK_UTILS_MODULUS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <wtk/utils/hints.h>
+#include <wtk/utils/FixedUint.h>
+
+namespace wtk {
+namespace utils {
+
+/**
+ * The largest excess of an unreduced sum (see Modulus::sum()) whose bound
+ * fits in the spare bits above the prime: 2^spare_bits - 1, capped to fit
+ * in 8 bits. With one spare bit, every other sum would be reduced, which
+ * costs as much as reducing each sum, so sums are not deferred.
+ */
+inline uint8_t excessBound(size_t const spare_bits)
+{
+  if(spare_bits < 2) { return 0; }
+  return spare_bits >= 8
+    ? UINT8_MAX : static_cast<uint8_t>((1 << spare_bits) - 1);
+}
+
+/**
+ * Arithmetic on residues modulo a prime, stored as a Wire_T. Operands must
+ * be reduced (less than the prime), except by canonical().
+ *
+ * Sums may also be left unreduced, by sum(). A value with excess e is less
+ * than (e + 1) times the prime, so the sum of values with excess a and b has
+ * excess a + b + 1. The caller tracks the excess, keeping it at most
+ * maxExcess (so that the value fits in Wire_T), and reduces the value by
+ * canonical() before it is multiplied or read.
+ *
+ * The generic Modulus reduces products with the % operator, and sums by a
+ * conditional subtraction. Unsigned integers of 32 bits or less are widened
+ * to at least twice their width (so a uint32_t Wire_T may hold any prime
+ * below 2^32). Otherwise the sum and product of two residues must fit in
+ * Wire_T.
+ */
+template<typename Wire_T>
+struct Modulus
+{
+  Wire_T const prime;
+
+  uint8_t const maxExcess;
+
+  explicit Modulus(Wire_T const& p)
+    : prime(p),
+      maxExcess(excessOf(p, std::integral_constant<bool,
+            std::is_integral<Wire_T>::value>())) { }
+
+  // The sum of two residues is less than twice the prime, so it is reduced
+  // by at most one subtraction, rather than a division.
+  Wire_T add(Wire_T const& a, Wire_T const& b) const
+  {
+    Promote_T const sum = static_cast<Promote_T const&>(a) + b;
+    return static_cast<Wire_T>(sum < this->prime ? sum : sum - this->prime);
+  }
+
+  Wire_T mul(Wire_T const& a, Wire_T const& b) const
+  {
+    return static_cast<Wire_T>(
+        (static_cast<Promote_T const&>(a) * b) % this->prime);
+  }
+
+  Wire_T sum(Wire_T const& a, Wire_T const& b) const
+  {
+    return static_cast<Wire_T>(static_cast<Promote_T const&>(a) + b);
+  }
+
+  Wire_T canonical(Wire_T const& x, uint8_t const excess) const
+  {
+    if(excess == 0) { return x; }
+    return static_cast<Wire_T>(static_cast<Promote_T const&>(x) % this->prime);
+  }
+
+private:
+  // Integers are bounded by their width. Other types (e.g. bignums) are
+  // unbounded, but reducing them needs a division, which costs more than
+  // the conditional subtraction of each sum, so sums are not deferred.
+  static uint8_t excessOf(Wire_T const& p, std::true_type)
+  {
+    size_t const width = (size_t) std::numeric_limits<Wire_T>::digits;
+    size_t bits = 0;
+    while(bits < width && (p >> bits) != 0) { bits++; }
+    return excessBound(width - bits);
+  }
+
+  static uint8_t excessOf(Wire_T const&, std::false_type) { return 0; }
+
+  // Operands are cast by reference, so that a bignum isn't copied.
+  typedef typename std::conditional<(!std::is_integral<Wire_T>::value
+    || sizeof(Wire_T) > sizeof(uint32_t)), Wire_T,
+    typename std::conditional<(sizeof(Wire_T) > sizeof(uint16_t)),
+      uint64_t, uint32_t>::type>::type Promote_T;
+};
+
+#ifdef __SIZEOF_INT128__
+
+// Indicates that 64-bit residues may be multiplied without overflow, for
+// primes up to 2^64 (see Modulus<uint64_t>).
+#define WTK_UTILS_MODULUS_WIDE_64 1
+
+__extension__ typedef unsigned __int128 uint128_t;
+
+/**
+ * The offset c of a pseudo-Mersenne prime 2^bits - c, or 0 if c is too large
+ * for folding reduction (c must be less than 2^32, and c^2 + 2c at most
+ * 2^bits).
+ */
+inline uint64_t pseudoMersenneOffset(uint64_t const c, size_t const bits)
+{
+  if(c >= ((uint64_t) 1 << 32)) { return 0; }
+  if(bits < 64 && (uint128_t) c * c + 2 * c > (uint128_t) 1 << bits)
+  {
+    return 0;
+  }
+
+  return c;
+}
+
+/**
+ * 64-bit residues for primes up to 2^64. Mersenne primes (2^bits - 1, such
+ * as 2^61 - 1) add the high bits of each product to the low bits. Other
+ * primes below 2^32 use 64-bit products with the % operator. Larger primes
+ * use 128-bit products, reduced by Barrett's method with the reciprocal
+ * floor((2^128 - 1) / p), rather than the (much slower) 128-bit division.
+ *
+ * Pseudo-Mersenne primes (2^bits - c) are detected, but folding by c > 1
+ * needs two more multiplies, and is no faster than Barrett's method.
+ *
+ * Montgomery's method would save a multiply, but residues would be held in
+ * Montgomery form, and wire values are read directly by plugins, converters
+ * and RAM indexes. Unreduced sums accumulate in the bits above the prime
+ * (e.g. with an excess of up to 7 for 2^61 - 1), and canonical() subtracts
+ * the prime times each power of two up to the excess.
+ */
+template<>
+struct Modulus<uint64_t>
+{
+  uint64_t const prime;
+
+  // Indicates that the prime is 2^32 or more.
+  bool const wide;
+
+  // Barrett reciprocal, split into 64-bit halves.
+  uint64_t const reciprocalHigh;
+  uint64_t const reciprocalLow;
+
+  // Bit length of the prime, and its pseudo-Mersenne offset (or 0).
+  size_t const bits;
+  uint64_t const offset;
+
+  uint8_t const maxExcess;
+
+  explicit Modulus(uint64_t const p)
+    : prime(p), wide(p > UINT32_MAX),
+      reciprocalHigh((uint64_t) ((~(uint128_t) 0 / p) >> 64)),
+      reciprocalLow((uint64_t) (~(uint128_t) 0 / p)),
+      bits(bitLength(p)),
+      offset(pseudoMersenneOffset(this->bits < 64
+            ? ((uint64_t) 1 << this->bits) - p : 0 - p, this->bits)),
+      maxExcess(excessBound(64 - this->bits)) { }
+
+  uint64_t add(uint64_t const a, uint64_t const b) const
+  {
+    uint64_t const sum = a + b;
+    return (sum < a || sum >= this->prime) ? sum - this->prime : sum;
+  }
+
+  uint64_t sum(uint64_t const a, uint64_t const b) const { return a + b; }
+
+  // From the largest, each conditional subtraction of the prime times a
+  // power of two leaves x less than that multiple.
+  uint64_t canonical(uint64_t x, uint8_t const excess) const
+  {
+    for(size_t j = bitLength(excess); j > 0; j--)
+    {
+      uint64_t const multiple = this->prime << (j - 1);
+      if(x >= multiple) { x -= multiple; }
+    }
+
+    return x;
+  }
+
+  uint64_t mul(uint64_t const a, uint64_t const b) const
+  {
+    if(this->offset == 1) { return this->fold((uint128_t) a * b); }
+    if(LIKELY(!this->wide)) { return (a * b) % this->prime; }
+
+    return this->reduce((uint128_t) a * b);
+  }
+
+  /**
+   * Reduce a product of residues by a Mersenne prime. 2^bits is 1 modulo
+   * the prime, so x is congruent to the sum of its bits above and below
+   * 2^bits. Two folds leave a value of at most 2^bits, and the prime, being
+   * 2^bits - 1, is also the mask of the low bits.
+   */
+  uint64_t fold(uint128_t const x) const
+  {
+    uint64_t sum = ((uint64_t) x & this->prime) + (uint64_t) (x >> this->bits);
+    sum = (sum & this->prime) + (sum >> this->bits);
+    return sum >= this->prime ? sum - this->prime : sum;
+  }
+
+  /**
+   * Reduce a product of residues (less than prime^2). The quotient is the
+   * high 128 bits of x times the reciprocal, which is at most 2 less than
+   * floor(x / prime), and is less than 2^64.
+   */
+  uint64_t reduce(uint128_t const x) const
+  {
+    uint64_t const x_high = (uint64_t) (x >> 64);
+    uint64_t const x_low = (uint64_t) x;
+
+    uint128_t const low_low = (uint128_t) x_low * this->reciprocalLow;
+    uint128_t const low_high = (uint128_t) x_low * this->reciprocalHigh;
+    uint128_t const high_low = (uint128_t) x_high * this->reciprocalLow;
+    uint128_t const high_high = (uint128_t) x_high * this->reciprocalHigh;
+
+    uint128_t const middle = (low_low >> 64) + (uint64_t) low_high
+      + (uint64_t) high_low;
+    uint64_t const quotient = (uint64_t) (high_high + (low_high >> 64)
+        + (high_low >> 64) + (middle >> 64));
+
+    uint128_t remainder = x - (uint128_t) quotient * this->prime;
+    while(remainder >= this->prime) { remainder -= this->prime; }
+    return (uint64_t) remainder;
+  }
+
+private:
+  static size_t bitLength(uint64_t const p)
+  {
+    size_t ret = 0;
+    while(ret < 64 && (p >> ret) != 0) { ret++; }
+    return ret;
+  }
+};
+
+/**
+ * Multi-limb residues, for primes of 2^64 up to 2^(64 N). Sums subtract the
+ * prime on overflow. Products by pseudo-Mersenne primes (such as 2^127 - 1
+ * and 2^255 - 19) are folded, using about half the multiplies of the
+ * Montgomery multiplications (coarsely integrated operand scanning) used
+ * for other primes. Neither needs division.
+ *
+ * Residues are held in canonical form rather than Montgomery form, as with
+ * Modulus<uint64_t>, so each product is a second Montgomery multiplication
+ * by R^2 (where R is 2^(64 N)): (a b / R) R^2 / R is a b.
+ */
+template<size_t N>
+struct Modulus<FixedUint<N>>
+{
+  FixedUint<N> const prime;
+
+  // -1 / prime, modulo 2^64.
+  uint64_t const inverse;
+
+  // R^2 modulo the prime.
+  FixedUint<N> const rSquared;
+
+  // Bit length of the prime, and its pseudo-Mersenne offset (or 0).
+  size_t const bits;
+  uint64_t const offset;
+
+  uint8_t const maxExcess;
+
+  explicit Modulus(FixedUint<N> const& p)
+    : prime(p), inverse(negativeInverse(p.limbs[0])), rSquared(rSquare(p)),
+      bits(bitLength(p)), offset(mersenneOffset(p, this->bits)),
+      maxExcess(excessBound(64 * N - this->bits)) { }
+
+  FixedUint<N> add(FixedUint<N> const& a, FixedUint<N> const& b) const
+  {
+    FixedUint<N> sum;
+    uint64_t carry = 0;
+    for(size_t i = 0; i < N; i++)
+    {
+      uint128_t const s = (uint128_t) a.limbs[i] + b.limbs[i] + carry;
+      sum.limbs[i] = (uint64_t) s;
+      carry = (uint64_t) (s >> 64);
+    }
+
+    if(carry != 0 || !(sum < this->prime)) { subtract(&sum, this->prime); }
+    return sum;
+  }
+
+  // The excess bounds the sum below 2^(64 N), so there is no final carry.
+  FixedUint<N> sum(FixedUint<N> const& a, FixedUint<N> const& b) const
+  {
+    FixedUint<N> sum;
+    uint64_t carry = 0;
+    for(size_t i = 0; i < N; i++)
+    {
+      uint128_t const s = (uint128_t) a.limbs[i] + b.limbs[i] + carry;
+      sum.limbs[i] = (uint64_t) s;
+      carry = (uint64_t) (s >> 64);
+    }
+
+    return sum;
+  }
+
+  // As Modulus<uint64_t>::canonical(), subtracting shifted primes.
+  FixedUint<N> canonical(FixedUint<N> x, uint8_t const excess) const
+  {
+    for(size_t j = 8; j > 0; j--)
+    {
+      if((excess >> (j - 1)) == 0) { continue; }
+
+      FixedUint<N> multiple;
+      for(size_t i = 0; i < N; i++)
+      {
+        multiple.limbs[i] = this->prime.limbs[i] << (j - 1);
+        if(j > 1 && i > 0)
+        {
+          multiple.limbs[i] |= this->prime.limbs[i - 1] >> (65 - j);
+        }
+      }
+
+      if(!(x < multiple)) { subtract(&x, multiple); }
+    }
+
+    return x;
+  }
+
+  FixedUint<N> mul(FixedUint<N> const& a, FixedUint<N> const& b) const
+  {
+    if(this->offset != 0) { return this->fold(a, b); }
+
+    return this->montgomery(this->montgomery(a, b), this->rSquared);
+  }
+
+  /**
+   * a b modulo a pseudo-Mersenne prime, 2^bits - c. With the 2N limb
+   * product split at 2^bits into high and low parts, 2^bits is c modulo the
+   * prime, so it is congruent to high c + low. Two folds leave a value less
+   * than 2^bits + c^2, which is less than twice the prime.
+   */
+  FixedUint<N> fold(FixedUint<N> const& a, FixedUint<N> const& b) const
+  {
+    uint64_t x[2 * N] = { 0 };
+    for(size_t i = 0; i < N; i++)
+    {
+      uint64_t carry = 0;
+      for(size_t j = 0; j < N; j++)
+      {
+        uint128_t const s =
+          (uint128_t) a.limbs[j] * b.limbs[i] + x[i + j] + carry;
+        x[i + j] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+      }
+      x[i + N] = carry;
+    }
+
+    // The first fold leaves at most N + 1 limbs, and the second at most N
+    // with a carry.
+    uint64_t once[N + 1];
+    this->foldOnce(x, 2 * N, once);
+    uint64_t twice[N + 1];
+    this->foldOnce(once, N + 1, twice);
+
+    FixedUint<N> ret;
+    for(size_t i = 0; i < N; i++) { ret.limbs[i] = twice[i]; }
+
+    if(twice[N] != 0 || !(ret < this->prime)) { subtract(&ret, this->prime); }
+    return ret;
+  }
+
+  // a b / R, modulo the prime.
+  FixedUint<N> montgomery(FixedUint<N> const& a, FixedUint<N> const& b) const
+  {
+    uint64_t t[N + 2] = { 0 };
+
+    for(size_t i = 0; i < N; i++)
+    {
+      // t += a b_i
+      uint64_t carry = 0;
+      for(size_t j = 0; j < N; j++)
+      {
+        uint128_t const s =
+          (uint128_t) a.limbs[j] * b.limbs[i] + t[j] + carry;
+        t[j] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+      }
+
+      uint128_t s = (uint128_t) t[N] + carry;
+      t[N] = (uint64_t) s;
+      t[N + 1] = (uint64_t) (s >> 64);
+
+      // t = (t + m prime) / 2^64, where m clears the low limb.
+      uint64_t const m = t[0] * this->inverse;
+      s = (uint128_t) m * this->prime.limbs[0] + t[0];
+      carry = (uint64_t) (s >> 64);
+      for(size_t j = 1; j < N; j++)
+      {
+        s = (uint128_t) m * this->prime.limbs[j] + t[j] + carry;
+        t[j - 1] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+      }
+
+      s = (uint128_t) t[N] + carry;
+      t[N - 1] = (uint64_t) s;
+      t[N] = t[N + 1] + (uint64_t) (s >> 64);
+    }
+
+    FixedUint<N> ret;
+    for(size_t i = 0; i < N; i++) { ret.limbs[i] = t[i]; }
+
+    if(t[N] != 0 || !(ret < this->prime)) { subtract(&ret, this->prime); }
+    return ret;
+  }
+
+private:
+  // out = (x >> bits) c + (x mod 2^bits), where x >> bits fits in N limbs.
+  void foldOnce(uint64_t const* const x, size_t const len,
+      uint64_t* const out) const
+  {
+    size_t const shift = this->bits / 64;
+    size_t const rem = this->bits % 64;
+
+    uint64_t carry = 0;
+    for(size_t i = 0; i < N; i++)
+    {
+      uint64_t high = i + shift < len ? x[i + shift] >> rem : 0;
+      if(rem != 0 && i + shift + 1 < len)
+      {
+        high |= x[i + shift + 1] << (64 - rem);
+      }
+
+      uint64_t low = 0;
+      if(i < shift) { low = x[i]; }
+      else if(i == shift) { low = x[i] & (((uint64_t) 1 << rem) - 1); }
+
+      uint128_t const s = (uint128_t) high * this->offset + low + carry;
+      out[i] = (uint64_t) s;
+      carry = (uint64_t) (s >> 64);
+    }
+
+    out[N] = carry;
+  }
+
+  static size_t bitLength(FixedUint<N> const& p)
+  {
+    size_t ret = 64 * N;
+    while(ret > 0 && ((p.limbs[(ret - 1) / 64] >> ((ret - 1) % 64)) & 1) == 0)
+    {
+      ret--;
+    }
+
+    return ret;
+  }
+
+  // The offset c of 2^bits - c, if it is a single limb (see
+  // pseudoMersenneOffset()).
+  static uint64_t mersenneOffset(FixedUint<N> const& p, size_t const bits)
+  {
+    // 2^bits - p, computed as the two's complement of p within bits.
+    FixedUint<N> c;
+    uint64_t borrow = 0;
+    for(size_t i = 0; i < N; i++)
+    {
+      c.limbs[i] = 0 - p.limbs[i] - borrow;
+      borrow = (p.limbs[i] != 0 || borrow != 0) ? 1 : 0;
+    }
+
+    if(bits < 64 * N)
+    {
+      c.limbs[bits / 64] &= ((uint64_t) 1 << (bits % 64)) - 1;
+    }
+
+    for(size_t i = 1; i < N; i++)
+    {
+      if(c.limbs[i] != 0) { return 0; }
+    }
+
+    return pseudoMersenneOffset(c.limbs[0], bits);
+  }
+
+  // a -= b, ignoring the final borrow.
+  static void subtract(FixedUint<N>* const a, FixedUint<N> const& b)
+  {
+    uint64_t borrow = 0;
+    for(size_t i = 0; i < N; i++)
+    {
+      uint64_t const limb = a->limbs[i];
+      a->limbs[i] = limb - b.limbs[i] - borrow;
+      borrow = (limb < b.limbs[i] || (limb == b.limbs[i] && borrow != 0))
+        ? 1 : 0;
+    }
+  }
+
+  // Newton's iteration, doubling the correct low bits of an odd number's
+  // inverse (starting from 3 bits).
+  static uint64_t negativeInverse(uint64_t const odd)
+  {
+    uint64_t inv = odd;
+    for(size_t i = 0; i < 5; i++) { inv *= 2 - odd * inv; }
+    return 0 - inv;
+  }
+
+  // R^2 modulo p, by doubling 1 (2 * 64 N) times.
+  static FixedUint<N> rSquare(FixedUint<N> const& p)
+  {
+    Modulus<FixedUint<N>> const doubler(p, 0, FixedUint<N>(0));
+    FixedUint<N> ret(1);
+    for(size_t i = 0; i < 2 * 64 * N; i++) { ret = doubler.add(ret, ret); }
+    return ret;
+  }
+
+  // Construct without the Montgomery constants, for addition only.
+  Modulus(FixedUint<N> const& p, uint64_t const inv, FixedUint<N> const& r2)
+    : prime(p), inverse(inv), rSquared(r2), bits(0), offset(0),
+      maxExcess(0) { }
+};
+
+#endif//__SIZEOF_INT128__
+
+} } // namespace wtk::utils
+
+#endif//WTK_UTILS_MODULUS_H_
@@ -60,6 +60,13 @@ public:
    */
   bool open(char const* const fileName);
 
+  /**
+   * When set before organize(), multiple public or private input streams
+   * may be given for a type. The k-th stream of each type (in the order
+   * opened) is placed into the k-th input set of streamSets.
+   */
+  bool multipleStreamSets = false;
+
   /**
    * Once all the resources are opened, organize them and return the Setting
    * detected.
@@ -99,6 +106,27 @@ public:
 
   /** A list of input streams, co-ordered with circuitBodyParser.types */
   std::vector<InputStreamPair> circuitStreams;
+
+  /**
+   * All input sets, each co-ordered with circuitBodyParser.types. The first
+   * is circuitStreams, others exist only when multipleStreamSets is set.
+   */
+  std::vector<std::vector<InputStreamPair>> streamSets;
+
+  /**
+   * After organize(), open another set of input streams (for example one of
+   * many instance/witness pairs), co-ordered with circuitBodyParser.types.
+   * Their parsers are held by the owner, which must outlive the streams.
+   *
+   * This does not modify the ParserOrganizer, so it may be called by several
+   * threads at once. Returns the set's Setting, or else Setting::failure.
+   */
+  Setting openStreamSet(std::vector<char const*> const& names,
+      std::vector<Parser_T>* owner, std::vector<InputStreamPair>* set) const;
+
+private:
+  // Detects the Setting of a set of input streams
+  Setting detectSetting(std::vector<InputStreamPair> const& streams) const;
 };
 
 template<typename Number_T>
@@ -103,7 +103,9 @@ Setting ParserOrganizer<Parser_T, Number_T>::organize()
       return Setting::failure;
     }
 
-    this->circuitStreams.resize(this->circuitBodyParser->types.size());
+    size_t const n_types = this->circuitBodyParser->types.size();
+    this->streamSets.resize(1);
+    this->streamSets[0].resize(n_types);
 
     for(size_t i = 0; i < this->parsers.size(); i++)
     {
@@ -131,19 +133,31 @@ Setting ParserOrganizer<Parser_T, Number_T>::organize()
 
           if(*t == *s->type)
           {
-            if(this->circuitStreams[j].publicParser != nullptr)
+            size_t k = 0;
+            while(k < this->streamSets.size()
+                && this->streamSets[k][j].publicParser != nullptr)
+            {
+              k++;
+            }
+
+            if(k != 0 && !this->multipleStreamSets)
             {
               log_error(
                   "duplicate public input stream for type %s: %s and %s",
                   type_str(s->type.get()).c_str(),
-                  this->circuitStreams[j].publicName, this->fileNames[i]);
+                  this->streamSets[0][j].publicName, this->fileNames[i]);
               return Setting::failure;
             }
             else
             {
-              this->circuitStreams[j].publicParser = p;
-              this->circuitStreams[j].publicStream = s;
-              this->circuitStreams[j].publicName = this->fileNames[i];
+              if(k == this->streamSets.size())
+              {
+                this->streamSets.emplace_back(n_types);
+              }
+
+              this->streamSets[k][j].publicParser = p;
+              this->streamSets[k][j].publicStream = s;
+              this->streamSets[k][j].publicName = this->fileNames[i];
 
               log_assert(!this->parserUsed[i]);
               this->parserUsed[i] = true;
@@ -173,19 +187,31 @@ Setting ParserOrganizer<Parser_T, Number_T>::organize()
 
           if(*t == *s->type)
           {
-            if(this->circuitStreams[j].privateParser != nullptr)
+            size_t k = 0;
+            while(k < this->streamSets.size()
+                && this->streamSets[k][j].privateParser != nullptr)
+            {
+              k++;
+            }
+
+            if(k != 0 && !this->multipleStreamSets)
             {
               log_error(
                   "duplicate private input stream for type %s: %s and %s",
                   type_str(s->type.get()).c_str(),
-                  this->circuitStreams[j].privateName, this->fileNames[i]);
+                  this->streamSets[0][j].privateName, this->fileNames[i]);
               return Setting::failure;
             }
             else
             {
-              this->circuitStreams[j].privateParser = p;
-              this->circuitStreams[j].privateStream = s;
-              this->circuitStreams[j].privateName = this->fileNames[i];
+              if(k == this->streamSets.size())
+              {
+                this->streamSets.emplace_back(n_types);
+              }
+
+              this->streamSets[k][j].privateParser = p;
+              this->streamSets[k][j].privateStream = s;
+              this->streamSets[k][j].privateName = this->fileNames[i];
 
               log_assert(!this->parserUsed[i]);
               this->parserUsed[i] = true;
@@ -195,73 +221,198 @@ Setting ParserOrganizer<Parser_T, Number_T>::organize()
       }
     }
 
-    size_t i = 0;
-    ret = Setting::preprocess;
-    for(; i < this->circuitStreams.size(); i++)
+    for(size_t k = 1; k < this->streamSets.size(); k++)
     {
-      if(this->circuitStreams[i].publicParser != nullptr
-          && this->circuitStreams[i].privateParser == nullptr)
-      {
-        ret = Setting::verifier;
-        break;
-      }
-      else if(this->circuitStreams[i].publicParser != nullptr
-          && this->circuitStreams[i].privateParser != nullptr)
+      for(size_t j = 0; j < n_types; j++)
       {
-        ret = Setting::prover;
-        break;
-      }
-      else if(this->circuitStreams[i].publicParser == nullptr
-          && this->circuitStreams[i].privateParser != nullptr)
-      {
-        log_error("Cannot recognize setting with relation and public input "
-            "stream but without private input stream for type %zu", i);
-        return Setting::failure;
-      }
-      else if(this->circuitBodyParser->types[i].variety
-          == wtk::circuit::TypeSpec<Number_T>::field)
-      {
-        break;
+        if((this->streamSets[k][j].publicParser == nullptr)
+              != (this->streamSets[0][j].publicParser == nullptr)
+            || (this->streamSets[k][j].privateParser == nullptr)
+              != (this->streamSets[0][j].privateParser == nullptr))
+        {
+          log_error("Input set %zu does not have the same streams as the "
+              "first input set for type %zu (type %s)", k, j,
+              type_str(&this->circuitBodyParser->types[j]).c_str());
+          return Setting::failure;
+        }
       }
     }
 
-    for(; i < this->circuitStreams.size(); i++)
+    this->circuitStreams = this->streamSets[0];
+
+    ret = this->detectSetting(this->circuitStreams);
+    if(ret == Setting::failure) { return Setting::failure; }
+  }
+
+  for(size_t i = 0; i < this->parserUsed.size(); i++)
+  {
+    if(!this->parserUsed[i])
     {
-      if(this->circuitStreams[i].publicParser == nullptr
-          && this->circuitStreams[i].privateParser != nullptr)
-      {
-        log_error("Cannot recognize setting with relation and public input "
-            "stream but without private input stream for type %zu", i);
-        return Setting::failure;
-      }
+      log_error("unused resource: %s", this->fileNames[i]);
+      return Setting::failure;
+    }
+  }
 
-      if(this->circuitBodyParser->types[i].variety
-          != wtk::circuit::TypeSpec<Number_T>::plugin
-          && (ret == Setting::verifier || ret == Setting::prover)
-          && this->circuitStreams[i].publicParser == nullptr)
-      {
-        log_error("Missing public input stream for type %zu (type %s)",
-            i, type_str(&this->circuitBodyParser->types[i]).c_str());
-        return Setting::failure;
-      }
+  return ret;
+}
+
+template<typename Parser_T, typename Number_T>
+Setting ParserOrganizer<Parser_T, Number_T>::openStreamSet(
+    std::vector<char const*> const& names,
+    std::vector<Parser_T>* const owner,
+    std::vector<InputStreamPair>* const set) const
+{
+  log_assert(this->circuitBodyParser != nullptr);
+
+  set->clear();
+  set->resize(this->circuitBodyParser->types.size());
+
+  // Reserve up front, as the streams point into the parsers.
+  owner->clear();
+  owner->reserve(names.size());
+
+  for(size_t i = 0; i < names.size(); i++)
+  {
+    owner->emplace_back();
+    Parser_T* const p = &owner->back();
+    if(!p->open(names[i]) || !p->parseHeader())
+    {
+      return Setting::failure;
+    }
+
+    bool const is_public = p->type == wtk::ResourceType::public_in;
+    if(!is_public && p->type != wtk::ResourceType::private_in)
+    {
+      log_error("%s: expected a public or private input stream", names[i]);
+      return Setting::failure;
+    }
+
+    wtk::InputStream<Number_T>* s = is_public ? p->publicIn() : p->privateIn();
+    if(s == nullptr)
+    {
+      log_error("error initializing %s input stream %s",
+          is_public ? "public" : "private", names[i]);
+      return Setting::failure;
+    }
 
-      if(this->circuitBodyParser->types[i].variety
-          != wtk::circuit::TypeSpec<Number_T>::plugin
-          && ret == Setting::prover
-          && this->circuitStreams[i].privateParser == nullptr)
+    if(!s->parseStreamHeader())
+    {
+      return Setting::failure;
+    }
+
+    bool used = false;
+    for(size_t j = 0; j < this->circuitBodyParser->types.size(); j++)
+    {
+      if(this->circuitBodyParser->types[j] == *s->type)
       {
-        log_error("Missing private input stream for type %zu (type %s)",
-            i, type_str(&this->circuitBodyParser->types[i]).c_str());
-        return Setting::failure;
+        InputStreamPair* const pair = &(*set)[j];
+        char const* const prior =
+          is_public ? pair->publicName : pair->privateName;
+        if(prior != nullptr)
+        {
+          log_error("duplicate %s input stream for type %s: %s and %s",
+              is_public ? "public" : "private",
+              type_str(s->type.get()).c_str(), prior, names[i]);
+          return Setting::failure;
+        }
+        else if(is_public)
+        {
+          pair->publicParser = p;
+          pair->publicStream = s;
+          pair->publicName = names[i];
+        }
+        else
+        {
+          pair->privateParser = p;
+          pair->privateStream = s;
+          pair->privateName = names[i];
+        }
+
+        used = true;
       }
     }
+
+    if(!used)
+    {
+      log_error("unused resource: %s", names[i]);
+      return Setting::failure;
+    }
   }
 
-  for(size_t i = 0; i < this->parserUsed.size(); i++)
+  return this->detectSetting(*set);
+}
+
+template<typename Parser_T, typename Number_T>
+Setting ParserOrganizer<Parser_T, Number_T>::detectSetting(
+    std::vector<InputStreamPair> const& streams) const
+{
+  Setting ret = Setting::preprocess;
+  size_t i = 0;
+  for(; i < streams.size(); i++)
   {
-    if(!this->parserUsed[i])
+    if(streams[i].publicParser != nullptr
+        && streams[i].privateParser == nullptr)
     {
-      log_error("unused resource: %s", this->fileNames[i]);
+      ret = Setting::verifier;
+      break;
+    }
+    else if(streams[i].publicParser != nullptr
+        && streams[i].privateParser != nullptr)
+    {
+      ret = Setting::prover;
+      break;
+    }
+    else if(streams[i].publicParser == nullptr
+        && streams[i].privateParser != nullptr)
+    {
+      log_error("Cannot recognize setting with relation and public input "
+          "stream but without private input stream for type %zu", i);
+      return Setting::failure;
+    }
+    else if(this->circuitBodyParser->types[i].variety
+        != wtk::circuit::TypeSpec<Number_T>::plugin)
+    {
+      break;
+    }
+  }
+
+  size_t const first = i;
+  for(; i < streams.size(); i++)
+  {
+    if(streams[i].publicParser == nullptr
+        && streams[i].privateParser != nullptr)
+    {
+      log_error("Cannot recognize setting with relation and public input "
+          "stream but without private input stream for type %zu", i);
+      return Setting::failure;
+    }
+
+    if(ret == Setting::preprocess && (streams[i].publicParser != nullptr
+          || streams[i].privateParser != nullptr))
+    {
+      log_error("Unexpected input stream for type %zu (type %s) without "
+          "input streams for type %zu", i,
+          type_str(&this->circuitBodyParser->types[i]).c_str(), first);
+      return Setting::failure;
+    }
+
+    if(this->circuitBodyParser->types[i].variety
+        != wtk::circuit::TypeSpec<Number_T>::plugin
+        && (ret == Setting::verifier || ret == Setting::prover)
+        && streams[i].publicParser == nullptr)
+    {
+      log_error("Missing public input stream for type %zu (type %s)",
+          i, type_str(&this->circuitBodyParser->types[i]).c_str());
+      return Setting::failure;
+    }
+
+    if(this->circuitBodyParser->types[i].variety
+        != wtk::circuit::TypeSpec<Number_T>::plugin
+        && ret == Setting::prover
+        && streams[i].privateParser == nullptr)
+    {
+      log_error("Missing private input stream for type %zu (type %s)",
+          i, type_str(&this->circuitBodyParser->types[i]).c_str());
       return Setting::failure;
     }
   }
@@ -286,6 +437,13 @@ std::string type_str(wtk::circuit::TypeSpec<Number_T> const* const type)
     ret = std::string("ring ") + wtk::utils::dec(type->bitWidth);
     break;
   }
+  case wtk::circuit::TypeSpec<Number_T>::extField:
+  {
+    ret = std::string("ext_field ")
+      + wtk::utils::dec((size_t) type->baseField) + " "
+      + wtk::utils::dec(type->degree) + " " + wtk::utils::dec(type->modulus);
+    break;
+  }
   case wtk::circuit::TypeSpec<Number_T>::plugin:
   {
     ret = std::string("@plugin(") + type->binding.name + ", "
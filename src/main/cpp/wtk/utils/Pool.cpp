@@ -0,0 +1,41 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cstddef>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif//__linux__
+
+#include <wtk/utils/Pool.h>
+
+namespace wtk {
+namespace utils {
+
+void* poolAllocate(size_t const bytes)
+{
+  if(bytes >= POOL_HUGE_PAGE_SIZE / 2)
+  {
+    size_t const rounded =
+      (bytes + POOL_HUGE_PAGE_SIZE - 1) & ~(POOL_HUGE_PAGE_SIZE - 1);
+
+    void* ptr = nullptr;
+    if(0 != posix_memalign(&ptr, POOL_HUGE_PAGE_SIZE, rounded))
+    {
+      return nullptr;
+    }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // Advisory only, so failure is ignored.
+    (void) madvise(ptr, rounded, MADV_HUGEPAGE);
+#endif
+
+    return ptr;
+  }
+
+  return malloc(bytes);
+}
+
+} } // namespace wtk::utils
@@ -6,15 +6,29 @@
 #define WTK_UTILS_POOL_H_
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <vector>
 #include <utility>
 
 #include <wtk/utils/hints.h>
+#include <wtk/utils/MemStats.h>
 
 namespace wtk {
 namespace utils {
 
+/**
+ * Size of a large memory page, to which Pool batches are aligned.
+ */
+constexpr size_t POOL_HUGE_PAGE_SIZE = 2 << 20;
+
+/**
+ * Allocate memory for a Pool batch. Allocations of at least half a large page
+ * are rounded up and aligned to POOL_HUGE_PAGE_SIZE, and (on Linux) advised
+ * to use transparent huge pages. The memory may be released with free().
+ */
+void* poolAllocate(size_t const bytes);
+
 /**
  * The pool encapsulates a batch allocation scheme, where a bunch of
  * objects are allocated in array simultaneously, and pointers to these
@@ -22,33 +36,72 @@ namespace utils {
  * simultaneously. This reduces time spent in the allocator and memory
  * management overhead.
  *
- * Default batch size will fill a 2MB large memory page.
+ * Default batch size will fill a 2MB large memory page. Requests for more
+ * than batch_size items are served from a dedicated block. A request which
+ * does not fit in the rest of the current batch starts a new batch, leaving
+ * the remainder unused (Pools of single items never waste any).
  */
 template<typename T, size_t batch_size = (2 << 20) / sizeof(T)>
 class Pool
 {
-  // each element is a pointer to batch-size many items, and 
-  std::vector<std::pair<T*, size_t>> spaces;
+  struct Space
+  {
+    T* items;
+    size_t used;
+
+    Space(T* const i, size_t const u) : items(i), used(u) { }
+  };
+
+  // each element is a block of items, either a batch or a dedicated block.
+  std::vector<Space> spaces;
+
+  // index of the batch which is currently being filled.
+  size_t current = SIZE_MAX;
+
+  // Bytes of items handed out, and bytes held from the system allocator.
+  MemStats usage;
+  size_t reservedBytes = 0;
 
   T* makeSpace(size_t n);
 
 public:
   /**
    * Return a pointer to n many items. Each will be default intialized.
-   * N must be less than the batch_size.
    */
   T* allocate(size_t n = 1);
 
   /**
    * Return a pointer to n many items. Each will be initialized with args.
-   * N must be less than the batch_size.
    */
   template<typename... Args>
   T* allocate(size_t n, Args&&... args);
 
+  /**
+   * Accounting of items allocated, in bytes.
+   */
+  MemStats const& stats() const { return this->usage; }
+
+  /**
+   * Bytes held from the system allocator, including unused items.
+   */
+  size_t reserved() const { return this->reservedBytes; }
+
+  Pool() = default;
+
+  // No copying
+  Pool(Pool const&) = delete;
+  Pool& operator=(Pool const&) = delete;
+
   ~Pool();
 };
 
+/**
+ * A Pool for each thread, for use by multithreaded paths without locking.
+ * Items are destroyed when their thread exits.
+ */
+template<typename T, size_t batch_size = (2 << 20) / sizeof(T)>
+Pool<T, batch_size>& threadLocalPool();
+
 } } // namespace wtk::utils
 
 #include <wtk/utils/Pool.t.h>
@@ -8,24 +8,34 @@ namespace utils {
 template<typename T, size_t batch_size>
 T* Pool<T, batch_size>::makeSpace(size_t n)
 {
-  // TODO handle n > batch_size, also potential wast when n>1
+  // Large requests get a dedicated block, leaving the current batch be.
+  if(UNLIKELY(n > batch_size))
+  {
+    T* const items = (T*) poolAllocate(n * sizeof(T));
+    this->spaces.emplace_back(items, n);
+    this->reservedBytes += n * sizeof(T);
+    return items;
+  }
 
-  if(UNLIKELY(
-       this->spaces.size() == 0
-    || this->spaces.back().second + n >= batch_size))
+  if(UNLIKELY(this->current == SIZE_MAX
+        || this->spaces[this->current].used + n > batch_size))
   {
-    this->spaces.emplace_back((T*) malloc(batch_size * sizeof(T)), 0);
+    this->spaces.emplace_back((T*) poolAllocate(batch_size * sizeof(T)), 0);
+    this->current = this->spaces.size() - 1;
+    this->reservedBytes += batch_size * sizeof(T);
   }
 
-  size_t rplace = this->spaces.back().second;
-  this->spaces.back().second += n;
-  return this->spaces.back().first + rplace;
+  Space* const space = &this->spaces[this->current];
+  size_t rplace = space->used;
+  space->used += n;
+  return space->items + rplace;
 }
 
 template<typename T, size_t batch_size>
 T* Pool<T, batch_size>::allocate(size_t n)
 {
   T* space = this->makeSpace(n);
+  this->usage.allocate(n * sizeof(T));
 
   for(size_t i = 0; i < n; i++)
   {
@@ -40,6 +50,7 @@ template<typename... Args>
 T* Pool<T, batch_size>::allocate(size_t n, Args&&... args)
 {
   T* space = this->makeSpace(n);
+  this->usage.allocate(n * sizeof(T));
 
   for(size_t i = 0; i < n; i++)
   {
@@ -54,12 +65,19 @@ Pool<T, batch_size>::~Pool()
 {
   for(size_t i = 0; i < this->spaces.size(); i++)
   {
-    for(size_t j = 0; j < this->spaces[i].second; j++)
+    for(size_t j = 0; j < this->spaces[i].used; j++)
     {
-      (this->spaces[i].first + j)->~T();
+      (this->spaces[i].items + j)->~T();
     }
-    free(this->spaces[i].first);
+    free(this->spaces[i].items);
   }
 }
 
+template<typename T, size_t batch_size>
+Pool<T, batch_size>& threadLocalPool()
+{
+  thread_local Pool<T, batch_size> pool;
+  return pool;
+}
+
 } } // namespace wtk::utils
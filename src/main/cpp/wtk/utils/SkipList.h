@@ -11,6 +11,7 @@
 #include <string>
 
 #include <wtk/utils/NumUtils.h>
+#include <wtk/utils/MemStats.h>
 
 namespace wtk {
 namespace utils {
@@ -28,16 +29,38 @@ class SkipList
   std::unique_ptr<Range<Number_T>> list =
     std::unique_ptr<Range<Number_T>>(nullptr);
 
+  // Number of ranges in the list.
+  size_t nodes = 0;
+
+  // Optional accounting for the list's ranges (see setStats()).
+  MemStats* stats = nullptr;
+
+  void added();
+  void removed();
+
 public:
   SkipList() = default;
 
+  // A copy is not accounted, unless it is given its own stats.
   SkipList(SkipList const& copy);
   SkipList& operator=(SkipList const& copy);
 
-  SkipList(SkipList&&) = default;
-  SkipList& operator=(SkipList&&) = default;
+  // Moving carries the ranges' accounting with them.
+  SkipList(SkipList&& move);
+  SkipList& operator=(SkipList&& move);
 
-  ~SkipList() = default;
+  ~SkipList();
+
+  /**
+   * Account for the list's ranges, including those already inserted, in
+   * the given stats (or stop accounting, if it is nullptr).
+   */
+  void setStats(MemStats* const s);
+
+  /**
+   * Returns the number of bytes used by the list's ranges.
+   */
+  size_t bytes() const;
 
   /**
    * Checks the integrity of the skip list. There are two checks here.
@@ -36,6 +36,7 @@ SkipList<Number_T>::SkipList(SkipList<Number_T> const& copy)
     Range<Number_T>* copy_range = copy.list.get();
     this->list = std::unique_ptr<Range<Number_T>>(
         new Range<Number_T>(copy_range->last, copy_range->first));
+    this->added();
 
     Range<Number_T>* new_range = this->list.get();
     copy_range = copy_range->next.get();
@@ -43,6 +44,7 @@ SkipList<Number_T>::SkipList(SkipList<Number_T> const& copy)
     {
       new_range->next = std::unique_ptr<Range<Number_T>>(
           new Range<Number_T>(copy_range->last, copy_range->first));
+      this->added();
 
       new_range = new_range->next.get();
       copy_range = copy_range->next.get();
@@ -54,8 +56,72 @@ template<typename Number_T>
 SkipList<Number_T>& SkipList<Number_T>::operator=(
     SkipList<Number_T> const& copy)
 {
+  MemStats* const s = this->stats;
   this->~SkipList();
   new(this)SkipList<Number_T>(copy);
+  this->setStats(s);
+  return *this;
+}
+
+template<typename Number_T>
+SkipList<Number_T>::SkipList(SkipList<Number_T>&& move)
+  : list(std::move(move.list)), nodes(move.nodes), stats(move.stats)
+{
+  move.nodes = 0;
+  move.stats = nullptr;
+}
+
+template<typename Number_T>
+SkipList<Number_T>& SkipList<Number_T>::operator=(SkipList<Number_T>&& move)
+{
+  if(this != &move)
+  {
+    this->clear();
+    this->list = std::move(move.list);
+    this->nodes = move.nodes;
+    this->stats = move.stats;
+    move.nodes = 0;
+    move.stats = nullptr;
+  }
+
+  return *this;
+}
+
+template<typename Number_T>
+SkipList<Number_T>::~SkipList()
+{
+  if(this->stats != nullptr)
+  {
+    this->stats->release(this->nodes * sizeof(Range<Number_T>));
+  }
+}
+
+template<typename Number_T>
+void SkipList<Number_T>::added()
+{
+  this->nodes++;
+  if(this->stats != nullptr) { this->stats->allocate(sizeof(Range<Number_T>)); }
+}
+
+template<typename Number_T>
+void SkipList<Number_T>::removed()
+{
+  this->nodes--;
+  if(this->stats != nullptr) { this->stats->release(sizeof(Range<Number_T>)); }
+}
+
+template<typename Number_T>
+void SkipList<Number_T>::setStats(MemStats* const s)
+{
+  if(this->stats != nullptr) { this->stats->release(this->bytes()); }
+  this->stats = s;
+  if(this->stats != nullptr) { this->stats->allocate(this->bytes()); }
+}
+
+template<typename Number_T>
+size_t SkipList<Number_T>::bytes() const
+{
+  return this->nodes * sizeof(Range<Number_T>);
 }
 
 template<typename Number_T>
@@ -164,6 +230,7 @@ bool SkipList<Number_T>::insert(Number_T const n)
   if(this->list == nullptr) // its the first range
   {
     this->list = std::unique_ptr<Range<Number_T>>(new Range<Number_T>(n));
+    this->added();
     return true;
   }
   // its before the first range
@@ -172,6 +239,7 @@ bool SkipList<Number_T>::insert(Number_T const n)
     std::unique_ptr<Range<Number_T>> next = std::move(this->list);
     this->list = std::unique_ptr<Range<Number_T>>(new Range<Number_T>(n));
     this->list->next = std::move(next);
+    this->added();
     return true;
   }
   else // traverse the existing ranges
@@ -196,6 +264,7 @@ bool SkipList<Number_T>::insert(Number_T const n)
           place->first = place->next->first;
           std::unique_ptr<Range<Number_T>> next(std::move(place->next));
           place->next = std::move(next->next);
+          this->removed();
         }
         return true;
       }
@@ -206,6 +275,7 @@ bool SkipList<Number_T>::insert(Number_T const n)
         std::unique_ptr<Range<Number_T>> next(std::move(place->next));
         place->next = std::unique_ptr<Range<Number_T>>(new Range<Number_T>(n));
         place->next->next = std::move(next);
+        this->added();
         return true;
       }
       else if(n <= place->last && n >= place->first) // already inserted.
@@ -226,6 +296,7 @@ bool SkipList<Number_T>::insert(Number_T const n)
 
     // NOLINTNEXTLINE
     prev->next = std::unique_ptr<Range<Number_T>>(new Range<Number_T>(n));
+    this->added();
 
     return true;
   }
@@ -241,6 +312,7 @@ bool SkipList<Number_T>::insert(Number_T const first, Number_T const last)
   {
     this->list = std::unique_ptr<Range<Number_T>>(
         new Range<Number_T>(last, first));
+    this->added();
     return true;
   }
   // before the first range
@@ -250,6 +322,7 @@ bool SkipList<Number_T>::insert(Number_T const first, Number_T const last)
     this->list = std::unique_ptr<Range<Number_T>>(
         new Range<Number_T>(last, first));
     this->list->next = std::move(next);
+    this->added();
     return true;
   }
   else // traverse the existing ranges
@@ -277,6 +350,7 @@ bool SkipList<Number_T>::insert(Number_T const first, Number_T const last)
           place->first = place->next->first;
           std::unique_ptr<Range<Number_T>> next(std::move(place->next));
           place->next = std::move(next->next);
+          this->removed();
         }
         else // it just extends
         {
@@ -292,6 +366,7 @@ bool SkipList<Number_T>::insert(Number_T const first, Number_T const last)
         place->next = std::unique_ptr<Range<Number_T>>(
             new Range<Number_T>(last, first));
         place->next->next = std::move(next);
+        this->added();
         return true;
       }
       else if((place->last >= first && place->first <= first)
@@ -315,6 +390,7 @@ bool SkipList<Number_T>::insert(Number_T const first, Number_T const last)
     // NOLINTNEXTLINE
     prev->next = std::unique_ptr<Range<Number_T>>(
         new Range<Number_T>(last, first));
+    this->added();
 
     return true;
   }
@@ -344,6 +420,7 @@ bool SkipList<Number_T>::remove(Number_T const n)
       newRange->next = std::move(place->next);
       place->first = n + 1;
       place->next = std::move(newRange);
+      this->added();
       return true;
     }
     else if(n > place->last) { return false; }
@@ -367,6 +444,7 @@ bool SkipList<Number_T>::remove(Number_T const first, Number_T const last)
     if(last == place->last && first == place->first)
     {
       *prev = std::move(place->next);
+      this->removed();
       return true;
     }
     else if(last == place->last && first > place->first)
@@ -386,6 +464,7 @@ bool SkipList<Number_T>::remove(Number_T const first, Number_T const last)
       newRange->next = std::move(place->next);
       place->first = last + 1;
       place->next = std::move(newRange);
+      this->added();
       return true;
     }
     else if(first > place->last) { return false; }
@@ -493,6 +572,9 @@ void SkipList<Number_T>::clear()
 {
   // should recurse on the range's destructor until all are deleted.
   this->list = nullptr;
+
+  if(this->stats != nullptr) { this->stats->release(this->bytes()); }
+  this->nodes = 0;
 }
 
 } } // namespace wtk::utils
@@ -0,0 +1,104 @@
+/**
+ * Copyright (C) 2022, Stealth Software Technologies, Inc.
+ */
+
+#ifndef WTK_UTILS_WRAPAROUND_H_
+#define WTK_UTILS_WRAPAROUND_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <wtk/utils/FixedUint.h>
+#include <wtk/utils/Modulus.h>
+
+namespace wtk {
+namespace utils {
+
+/**
+ * Arithmetic on residues modulo 2^bitWidth (a ring), stored as a Wire_T of
+ * at least bitWidth bits. Operands must be reduced (less than 2^bitWidth).
+ *
+ * Sums and products wrap around at the width of Wire_T (unsigned integers
+ * narrower than unsigned int are promoted to unsigned int, rather than
+ * signed int) and are then masked to bitWidth. Neither needs division.
+ */
+template<typename Wire_T>
+struct Wraparound
+{
+  // 2^bitWidth - 1
+  Wire_T const mask;
+
+  explicit Wraparound(Wire_T const& m) : mask(m) { }
+
+  Wire_T add(Wire_T const& a, Wire_T const& b) const
+  {
+    return static_cast<Wire_T>(
+        static_cast<Wire_T>((Promote_T) a + (Promote_T) b) & this->mask);
+  }
+
+  Wire_T mul(Wire_T const& a, Wire_T const& b) const
+  {
+    return static_cast<Wire_T>(
+        static_cast<Wire_T>((Promote_T) a * (Promote_T) b) & this->mask);
+  }
+
+private:
+  typedef typename std::conditional<std::is_integral<Wire_T>::value
+    && sizeof(Wire_T) < sizeof(unsigned int), unsigned int, Wire_T>::type
+    Promote_T;
+};
+
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+
+/**
+ * Multi-limb residues, modulo 2^bitWidth for bitWidth up to 64 N. Sums carry
+ * between limbs, and products are schoolbook multiplications truncated to
+ * N limbs.
+ */
+template<size_t N>
+struct Wraparound<FixedUint<N>>
+{
+  FixedUint<N> const mask;
+
+  explicit Wraparound(FixedUint<N> const& m) : mask(m) { }
+
+  FixedUint<N> add(FixedUint<N> const& a, FixedUint<N> const& b) const
+  {
+    FixedUint<N> sum;
+    uint64_t carry = 0;
+    for(size_t i = 0; i < N; i++)
+    {
+      uint128_t const s = (uint128_t) a.limbs[i] + b.limbs[i] + carry;
+      sum.limbs[i] = (uint64_t) s & this->mask.limbs[i];
+      carry = (uint64_t) (s >> 64);
+    }
+
+    return sum;
+  }
+
+  FixedUint<N> mul(FixedUint<N> const& a, FixedUint<N> const& b) const
+  {
+    FixedUint<N> product;
+    for(size_t i = 0; i < N; i++)
+    {
+      uint64_t carry = 0;
+      for(size_t j = 0; i + j < N; j++)
+      {
+        uint128_t const s = (uint128_t) a.limbs[j] * b.limbs[i]
+          + product.limbs[i + j] + carry;
+        product.limbs[i + j] = (uint64_t) s;
+        carry = (uint64_t) (s >> 64);
+      }
+    }
+
+    for(size_t i = 0; i < N; i++) { product.limbs[i] &= this->mask.limbs[i]; }
+    return product;
+  }
+};
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
+
+} } // namespace wtk::utils
+
+#endif//WTK_UTILS_WRAPAROUND_H_
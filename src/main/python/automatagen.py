@@ -278,6 +278,7 @@ fieldOrRingOrPlugin = \
     DFA("fieldOrRingOrPluginKws", "FieldOrRingOrPlugin", "invalid")
 fieldOrRingOrPlugin.insertString("field", "field")
 fieldOrRingOrPlugin.insertString("ring", "ring")
+fieldOrRingOrPlugin.insertString("ext_field", "ext_field")
 fieldOrRingOrPlugin.insertString("@plugin", "plugin")
 fieldOrRingOrPlugin.optimize()
 ih.write(fieldOrRingOrPlugin.toCpp())
@@ -304,6 +305,7 @@ ih.write(typeKw.toCpp())
 fieldOrRingKws = DFA("fieldOrRingKws", "FieldOrRingKws", "invalid");
 fieldOrRingKws.insertString("field", "field");
 fieldOrRingKws.insertString("ring", "ring");
+fieldOrRingKws.insertString("ext_field", "ext_field");
 fieldOrRingKws.optimize()
 ih.write(fieldOrRingKws.toCpp())
 
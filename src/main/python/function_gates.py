@@ -0,0 +1,427 @@
+#! /usr/bin/python3
+
+# Copyright (C) 2023, Stealth Software Technologies, Inc.
+
+# This script will generate an IR statement which uses each kind of gate
+# within functions (a dot product, an affine map, an equality check and
+# inputs), along with instance and witness streams. The witness may be
+# made to fail, so that rejection is tested along with acceptance.
+
+import sys
+import random
+
+# ==== Types ====
+
+class Field:
+  def __init__(self, prime):
+    self.prime = prime
+
+  def decl(self, types):
+    return "@type field " + str(self.prime) + ";\n"
+
+  def size(self):
+    return self.prime
+
+  def add(self, a, b):
+    return (a + b) % self.prime
+
+  def mul(self, a, b):
+    return (a * b) % self.prime
+
+  def neg(self, a):
+    return (-a) % self.prime
+
+class Ring:
+  def __init__(self, bits):
+    self.bits = bits
+
+  def decl(self, types):
+    return "@type ring " + str(self.bits) + ";\n"
+
+  def size(self):
+    return 2**self.bits
+
+  def add(self, a, b):
+    return (a + b) % 2**self.bits
+
+  def mul(self, a, b):
+    return (a * b) % 2**self.bits
+
+  def neg(self, a):
+    return (-a) % 2**self.bits
+
+# An extension of the base field (which must be declared first) by a monic
+# polynomial, given by its non-leading coefficients, least significant
+# first. Elements are encoded as base-p digits, least significant first.
+class ExtField:
+  def __init__(self, base, prime, modulus):
+    self.base = base
+    self.prime = prime
+    self.degree = len(modulus)
+    self.modulus = modulus
+
+  def encode(self, coeffs):
+    ret = 0
+    for c in reversed(coeffs):
+      ret = ret * self.prime + c
+    return ret
+
+  def decode(self, x):
+    ret = []
+    for i in range(self.degree):
+      ret.append(x % self.prime)
+      x = x // self.prime
+    return ret
+
+  def decl(self, types):
+    return "@type ext_field " + str(self.base) + " " + str(self.degree) \
+        + " " + str(self.encode(self.modulus)) + ";\n"
+
+  def size(self):
+    return self.prime**self.degree
+
+  def add(self, a, b):
+    return self.encode([ (x + y) % self.prime \
+        for x, y in zip(self.decode(a), self.decode(b)) ])
+
+  def mul(self, a, b):
+    d = self.degree
+    x = self.decode(a)
+    y = self.decode(b)
+    product = [0] * (2 * d - 1)
+    for i in range(d):
+      for j in range(d):
+        product[i + j] = (product[i + j] + x[i] * y[j]) % self.prime
+    for i in range(2 * d - 2, d - 1, -1):
+      top = product[i]
+      product[i] = 0
+      for j in range(d):
+        product[i - d + j] = \
+            (product[i - d + j] - top * self.modulus[j]) % self.prime
+    return self.encode(product[:d])
+
+  def neg(self, a):
+    return self.encode([ (-x) % self.prime for x in self.decode(a) ])
+
+# ==== Relation ====
+
+# The relation's types and constants, which the streams must agree with.
+#  - types: list of Field, Ring or ExtField. Gates use the last of them (or
+#    the second last when there is a second field).
+#  - n: length of the dot product's vectors.
+#  - second: a Field type, to which a small value is converted, and which
+#    computes its own dot product.
+#  - use_map: compute the products by an iter_v0 map.
+#  - nested: compute the products by a map of maps (implies use_map).
+class Spec:
+  def __init__(self, types, n, second = None, use_map = False, nested = False):
+    self.types = list(types)
+    self.n = n
+    self.second = None
+    if second != None:
+      self.types.append(second)
+      self.second = len(self.types) - 1
+    self.main = len(self.types) - 1 if second == None else len(self.types) - 2
+    self.useMap = use_map or nested
+    self.nested = nested
+
+    t = self.types[self.main]
+    self.c1 = random.randrange(0, t.size())
+    self.c2 = random.randrange(0, t.size())
+    self.c3 = random.randrange(0, t.size())
+
+def functions(f, spec, t):
+  typ = spec.types[t]
+  n = spec.n
+  s = str(t)
+
+  # sum of n independent products, so that the muls are batched.
+  f.write("@function(dot_" + s + ", @out: " + s + ":1, @in: " + s + ":" \
+      + str(n) + ", " + s + ":" + str(n) + ")\n")
+  for i in range(n):
+    f.write("  $" + str(2 * n + 1 + i) + " <- @mul(" + s + ": $" \
+        + str(1 + i) + ", $" + str(1 + n + i) + ");\n")
+  acc = 2 * n + 1
+  for i in range(1, n):
+    out = 3 * n + i
+    f.write("  $" + str(out) + " <- @add(" + s + ": $" + str(acc) + ", $" \
+        + str(2 * n + 1 + i) + ");\n")
+    acc = out
+  f.write("  $0 <- " + s + ": $" + str(acc) + ";\n")
+  f.write("@end\n\n")
+
+  f.write("@function(check_eq_" + s + ", @in: " + s + ":1, " + s + ":1)\n")
+  f.write("  $2 <- @mulc(" + s + ": $1, <" + str(typ.neg(1)) + ">);\n")
+  f.write("  $3 <- @add(" + s + ": $0, $2);\n")
+  f.write("  @assert_zero(" + s + ": $3);\n")
+  f.write("@end\n\n")
+
+# The range $first ... $first+n-1, as its second half then its first half.
+def rotate(first, n):
+  h = n // 2
+  if h == 0:
+    return "$" + str(first) + " ... $" + str(first + n - 1)
+  return "$" + str(first + h) + " ... $" + str(first + n - 1) + ", $" \
+      + str(first) + " ... $" + str(first + h - 1)
+
+def relation(f, spec):
+  t = spec.main
+  s = str(t)
+  n = spec.n
+  typ = spec.types[t]
+
+  f.write("version 2.1.0;\n")
+  f.write("circuit;\n")
+  if spec.useMap:
+    f.write("@plugin iter_v0;\n")
+  for typ2 in spec.types:
+    f.write(typ2.decl(spec.types))
+  if spec.second != None:
+    f.write("@convert(@out: " + str(spec.second) + ":1, @in: " + s + ":1);\n")
+  f.write("@begin\n")
+
+  functions(f, spec, t)
+
+  f.write("@function(affine, @out: " + s + ":1, @in: " + s + ":1)\n")
+  f.write("  $2 <- @mulc(" + s + ": $1, <" + str(spec.c1) + ">);\n")
+  f.write("  $3 <- @addc(" + s + ": $2, <" + str(spec.c2) + ">);\n")
+  f.write("  $4 <- " + s + ": <" + str(spec.c3) + ">;\n")
+  f.write("  $5 <- @add(" + s + ": $3, $4);\n")
+  f.write("  $0 <- " + s + ": $5;\n")
+  f.write("@end\n\n")
+
+  f.write("@function(read_pair, @out: " + s + ":1, " + s + ":1)\n")
+  f.write("  $0 <- @public(" + s + ");\n")
+  f.write("  $1 <- @private(" + s + ");\n")
+  f.write("@end\n\n")
+
+  if spec.useMap:
+    f.write("@function(mul1, @out: " + s + ":1, @in: " + s + ":1, " + s \
+        + ":1)\n")
+    f.write("  $0 <- @mul(" + s + ": $1, $2);\n")
+    f.write("@end\n\n")
+    f.write("@function(mul_all, @out: " + s + ":" + str(n) + ", @in: " + s \
+        + ":" + str(n) + ", " + s + ":" + str(n) + ")\n")
+    f.write("  @plugin(iter_v0, map, mul1, 0, " + str(n) + ");\n\n")
+    if spec.nested:
+      f.write("@function(mul_rows, @out: " + s + ":" + str(2 * n) \
+          + ", @in: " + s + ":" + str(2 * n) + ", " + s + ":" + str(2 * n) \
+          + ")\n")
+      f.write("  @plugin(iter_v0, map, mul_all, 0, 2);\n\n")
+
+  if spec.second != None:
+    functions(f, spec, spec.second)
+
+  # Wires: a: $0 ... n-1, b: $n ... 2n-1, dot: $2n, expected: $2n+1,
+  # copy of a: $2n+2 ... 3n+1, then single wires and the map's products.
+  # Scratch ranges follow, as deleted wires may not be reused.
+  a = 0
+  b = n
+  dot = 2 * n
+  expected = 2 * n + 1
+  copy = 2 * n + 2
+  w = 3 * n + 2
+  count = 2 * n if spec.nested else n
+  products = w + 7
+  last = products + count - 1 if spec.useMap else w + 4
+  rotated = last + 1
+  rows = rotated + n
+  sums = rows + 4 * n
+  f.write("  @new(" + s + ": $0 ... $" + str(last) + ");\n")
+  f.write("  $" + str(a) + " ... $" + str(a + n - 1) + " <- @public(" + s \
+      + ");\n")
+  f.write("  $" + str(b) + " ... $" + str(b + n - 1) + " <- @private(" + s \
+      + ");\n")
+  f.write("  $" + str(dot) + " <- @call(dot_" + s + ", $" + str(a) + " ... $" \
+      + str(a + n - 1) + ", $" + str(b) + " ... $" + str(b + n - 1) + ");\n")
+  f.write("  $" + str(expected) + " <- @public(" + s + ");\n")
+  f.write("  @call(check_eq_" + s + ", $" + str(dot) + ", $" \
+      + str(expected) + ");\n")
+
+  # The copy is of a's second half then its first half, so it is summed
+  # against b rotated the same way.
+  f.write("  $" + str(copy) + " ... $" + str(copy + n - 1) + " <- " + s \
+      + ": " + rotate(a, n) + ";\n")
+  f.write("  @new(" + s + ": $" + str(rotated) + " ... $" \
+      + str(rotated + n - 1) + ");\n")
+  f.write("  $" + str(rotated) + " ... $" + str(rotated + n - 1) + " <- " \
+      + s + ": " + rotate(b, n) + ";\n")
+  f.write("  $" + str(w) + " <- @call(dot_" + s + ", $" + str(copy) \
+      + " ... $" + str(copy + n - 1) + ", $" + str(rotated) + " ... $" \
+      + str(rotated + n - 1) + ");\n")
+  f.write("  @call(check_eq_" + s + ", $" + str(w) + ", $" + str(expected) \
+      + ");\n")
+  f.write("  @delete(" + s + ": $" + str(rotated) + " ... $" \
+      + str(rotated + n - 1) + ");\n")
+
+  f.write("  $" + str(w + 1) + " <- @call(affine, $" + str(dot) + ");\n")
+  f.write("  $" + str(w + 2) + " <- @public(" + s + ");\n")
+  f.write("  @call(check_eq_" + s + ", $" + str(w + 1) + ", $" + str(w + 2) \
+      + ");\n")
+
+  f.write("  $" + str(w + 3) + ", $" + str(w + 4) + " <- @call(read_pair);\n")
+  f.write("  @call(check_eq_" + s + ", $" + str(w + 3) + ", $" + str(w + 4) \
+      + ");\n")
+
+  if spec.useMap:
+    if spec.nested:
+      # each row is a and b, so the products sum to twice the dot product.
+      f.write("  @new(" + s + ": $" + str(rows) + " ... $" \
+          + str(rows + 4 * n - 1) + ");\n")
+      f.write("  $" + str(rows) + " ... $" + str(rows + 2 * n - 1) + " <- " \
+          + s + ": $" + str(a) + " ... $" + str(a + n - 1) + ", $" + str(a) \
+          + " ... $" + str(a + n - 1) + ";\n")
+      f.write("  $" + str(rows + 2 * n) + " ... $" + str(rows + 4 * n - 1) \
+          + " <- " + s + ": $" + str(b) + " ... $" + str(b + n - 1) + ", $" \
+          + str(b) + " ... $" + str(b + n - 1) + ";\n")
+      f.write("  $" + str(products) + " ... $" + str(products + 2 * n - 1) \
+          + " <- @call(mul_rows, $" + str(rows) + " ... $" \
+          + str(rows + 2 * n - 1) + ", $" + str(rows + 2 * n) + " ... $" \
+          + str(rows + 4 * n - 1) + ");\n")
+      f.write("  @delete(" + s + ": $" + str(rows) + " ... $" \
+          + str(rows + 4 * n - 1) + ");\n")
+    else:
+      f.write("  $" + str(products) + " ... $" + str(products + n - 1) \
+          + " <- @call(mul_all, $" + str(a) + " ... $" + str(a + n - 1) \
+          + ", $" + str(b) + " ... $" + str(b + n - 1) + ");\n")
+
+    # Sum the products into $w+5, and compare to the expected sum in $w+6.
+    acc = products
+    if count > 1:
+      f.write("  @new(" + s + ": $" + str(sums + 1) + " ... $" \
+          + str(sums + count - 1) + ");\n")
+    for i in range(1, count):
+      f.write("  $" + str(sums + i) + " <- @add(" + s + ": $" + str(acc) \
+          + ", $" + str(products + i) + ");\n")
+      acc = sums + i
+    f.write("  $" + str(w + 5) + " <- " + s + ": $" + str(acc) + ";\n")
+    if count > 1:
+      f.write("  @delete(" + s + ": $" + str(sums + 1) + " ... $" \
+          + str(sums + count - 1) + ");\n")
+    if spec.nested:
+      f.write("  $" + str(w + 6) + " <- @add(" + s + ": $" + str(expected) \
+          + ", $" + str(expected) + ");\n")
+    else:
+      f.write("  $" + str(w + 6) + " <- " + s + ": $" + str(expected) + ";\n")
+    f.write("  @call(check_eq_" + s + ", $" + str(w + 5) + ", $" + str(w + 6) \
+        + ");\n")
+
+  f.write("  @delete(" + s + ": $0 ... $" + str(last) + ");\n")
+
+  if spec.second != None:
+    t2 = str(spec.second)
+    f.write("  @new(" + t2 + ": $0 ... $" + str(2 * n + 3) + ");\n")
+    f.write("  $0 ... $" + str(n - 1) + " <- @public(" + t2 + ");\n")
+    f.write("  $" + str(n) + " ... $" + str(2 * n - 1) + " <- @private(" + t2 \
+        + ");\n")
+    f.write("  $" + str(2 * n) + " <- @call(dot_" + t2 + ", $0 ... $" \
+        + str(n - 1) + ", $" + str(n) + " ... $" + str(2 * n - 1) + ");\n")
+    f.write("  $" + str(2 * n + 1) + " <- @public(" + t2 + ");\n")
+    f.write("  @call(check_eq_" + t2 + ", $" + str(2 * n) + ", $" \
+        + str(2 * n + 1) + ");\n")
+
+    # a small value of the main type, converted to the second type.
+    small = sums + count
+    f.write("  $" + str(small) + " <- @public(" + s + ");\n")
+    f.write("  " + t2 + ": $" + str(2 * n + 2) + " <- @convert(" + s \
+        + ": $" + str(small) + ");\n")
+    f.write("  $" + str(2 * n + 3) + " <- @public(" + t2 + ");\n")
+    f.write("  @call(check_eq_" + t2 + ", $" + str(2 * n + 2) + ", $" \
+        + str(2 * n + 3) + ");\n")
+    f.write("  @delete(" + t2 + ": $0 ... $" + str(2 * n + 3) + ");\n")
+
+  f.write("@end\n")
+
+  f.flush()
+  f.close()
+
+# ==== Streams ====
+
+def streamHeader(f, kind, spec, t):
+  f.write("version 2.1.0;\n")
+  f.write(kind + ";\n")
+  f.write(spec.types[t].decl(spec.types))
+  f.write("@begin\n")
+
+def streamValues(f, values):
+  for v in values:
+    f.write("< " + str(v) + " >;\n")
+  f.write("@end\n")
+  f.flush()
+  f.close()
+
+def dot(typ, xs, ys):
+  ret = 0
+  for x, y in zip(xs, ys):
+    ret = typ.add(ret, typ.mul(x, y))
+  return ret
+
+# Write one instance and witness for each of the relation's types, in
+# order (those before the gates' type, such as an extension's base field,
+# are empty). When bad, the witness fails the dot product's check.
+def streams(spec, ins_files, wit_files, bad = False):
+  t = spec.main
+  typ = spec.types[t]
+  n = spec.n
+
+  # a[0] is one, so that changing b[0] changes the dot product.
+  a = [ 1 ] + [ random.randrange(0, typ.size()) for i in range(n - 1) ]
+  b = [ random.randrange(0, typ.size()) for i in range(n) ]
+  d = dot(typ, a, b)
+  if bad:
+    b[0] = typ.add(b[0], 1)
+  y = typ.add(typ.add(typ.mul(d, spec.c1), spec.c2), spec.c3)
+  pair = random.randrange(0, typ.size())
+
+  publics = a + [ d, y, pair ]
+  privates = b + [ pair ]
+
+  ins_files = list(ins_files)
+  wit_files = list(wit_files)
+
+  if spec.second != None:
+    typ2 = spec.types[spec.second]
+    a2 = [ random.randrange(0, typ2.size()) for i in range(n) ]
+    b2 = [ random.randrange(0, typ2.size()) for i in range(n) ]
+    small = random.randrange(0, min(typ.size(), typ2.size()))
+    publics.append(small)
+
+    ins = ins_files.pop()
+    wit = wit_files.pop()
+    streamHeader(ins, "public_input", spec, spec.second)
+    streamHeader(wit, "private_input", spec, spec.second)
+    streamValues(ins, a2 + [ dot(typ2, a2, b2), small ])
+    streamValues(wit, b2)
+
+  ins = ins_files.pop()
+  wit = wit_files.pop()
+  streamHeader(ins, "public_input", spec, t)
+  streamHeader(wit, "private_input", spec, t)
+  streamValues(ins, publics)
+  streamValues(wit, privates)
+
+  while len(ins_files) != 0:
+    t = len(ins_files) - 1
+    ins = ins_files.pop()
+    wit = wit_files.pop()
+    streamHeader(ins, "public_input", spec, t)
+    streamHeader(wit, "private_input", spec, t)
+    streamValues(ins, [])
+    streamValues(wit, [])
+
+if __name__ == "__main__":
+  if len(sys.argv) != 4:
+    print("USAGE: function_gates <prime> <n> <output>\n")
+    print("Generate a test circuit using each gate within functions.")
+    print("  prime: the prime field.")
+    print("  n: the length of the dot product.")
+    print("  output: the basename for created files.")
+    sys.exit(1)
+
+  prime = int(sys.argv[1])
+  n = int(sys.argv[2])
+  output = str(sys.argv[3])
+
+  spec = Spec([ Field(prime) ], n)
+  relation(open(output + ".rel", "w"), spec)
+  streams(spec, [ open(output + ".ins", "w") ], [ open(output + ".wit", "w") ])
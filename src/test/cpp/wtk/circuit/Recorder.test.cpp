@@ -0,0 +1,321 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <wtk/indexes.h>
+#include <wtk/circuit/Data.h>
+#include <wtk/circuit/Handler.h>
+#include <wtk/circuit/Recorder.h>
+
+using wtk::wire_idx;
+using wtk::type_idx;
+using wtk::circuit::CopyMulti;
+using wtk::circuit::FunctionCall;
+using wtk::circuit::FunctionSignature;
+using wtk::circuit::PluginBinding;
+using wtk::circuit::Range;
+
+// Writes a line of text (or a few) for each callback, and fails on the
+// failOn operation.
+class Log : public wtk::circuit::Handler<uint64_t>
+{
+public:
+  std::vector<std::string> lines;
+  std::string failOn;
+
+  bool write(char const* const op, uint64_t const a = 0,
+      uint64_t const b = 0, uint64_t const c = 0, uint64_t const d = 0)
+  {
+    char buf[160];
+    snprintf(buf, sizeof(buf), "%zu: %s %" PRIu64 " %" PRIu64 " %" PRIu64
+        " %" PRIu64, this->lineNum, op, a, b, c, d);
+    this->lines.emplace_back(buf);
+    return this->failOn != op;
+  }
+
+  bool addGate(wire_idx const out,
+      wire_idx const left, wire_idx const right, type_idx const type) final
+  {
+    return this->write("add", out, left, right, type);
+  }
+
+  bool mulGate(wire_idx const out,
+      wire_idx const left, wire_idx const right, type_idx const type) final
+  {
+    return this->write("mul", out, left, right, type);
+  }
+
+  bool addcGate(wire_idx const out,
+      wire_idx const left, uint64_t&& right, type_idx const type) final
+  {
+    return this->write("addc", out, left, right, type);
+  }
+
+  bool mulcGate(wire_idx const out,
+      wire_idx const left, uint64_t&& right, type_idx const type) final
+  {
+    return this->write("mulc", out, left, right, type);
+  }
+
+  bool copy(
+      wire_idx const out, wire_idx const left, type_idx const type) final
+  {
+    return this->write("copy", out, left, type);
+  }
+
+  bool copyMulti(CopyMulti* copy_multi) final
+  {
+    bool ret = this->write("copyMulti", copy_multi->outputs.first,
+        copy_multi->outputs.last, copy_multi->type);
+    for(size_t i = 0; i < copy_multi->inputs.size(); i++)
+    {
+      ret = this->write("  input",
+          copy_multi->inputs[i].first, copy_multi->inputs[i].last) && ret;
+    }
+
+    return ret;
+  }
+
+  bool assign(
+      wire_idx const out, uint64_t&& left, type_idx const type) final
+  {
+    return this->write("assign", out, left, type);
+  }
+
+  bool assertZero(wire_idx const left, type_idx const type) final
+  {
+    return this->write("assertZero", left, type);
+  }
+
+  bool publicIn(wire_idx const out, type_idx const type) final
+  {
+    return this->write("publicIn", out, type);
+  }
+
+  bool publicInMulti(Range* outs, type_idx const type) final
+  {
+    return this->write("publicInMulti", outs->first, outs->last, type);
+  }
+
+  bool privateIn(wire_idx const out, type_idx const type) final
+  {
+    return this->write("privateIn", out, type);
+  }
+
+  bool privateInMulti(Range* outs, type_idx const type) final
+  {
+    return this->write("privateInMulti", outs->first, outs->last, type);
+  }
+
+  bool convert(
+      wire_idx const first_out, wire_idx const last_out,
+      type_idx const out_type,
+      wire_idx const first_in, wire_idx const last_in,
+      type_idx const in_type, bool modulus) final
+  {
+    this->write("convert", first_out, last_out, out_type, modulus);
+    return this->write("  input", first_in, last_in, in_type);
+  }
+
+  bool newRange(
+      wire_idx const first, wire_idx const last, type_idx const type) final
+  {
+    return this->write("newRange", first, last, type);
+  }
+
+  bool deleteRange(
+      wire_idx const first, wire_idx const last, type_idx const type) final
+  {
+    return this->write("deleteRange", first, last, type);
+  }
+
+  bool startFunction(FunctionSignature&& signature) final
+  {
+    this->write(signature.name.c_str(), signature.lineNum,
+        signature.outputs.size(), signature.inputs.size());
+    for(size_t i = 0; i < signature.outputs.size(); i++)
+    {
+      this->write("  output",
+          signature.outputs[i].type, signature.outputs[i].length);
+    }
+
+    for(size_t i = 0; i < signature.inputs.size(); i++)
+    {
+      this->write("  input",
+          signature.inputs[i].type, signature.inputs[i].length);
+    }
+
+    return true;
+  }
+
+  bool regularFunction() final { return this->write("regularFunction"); }
+
+  bool endFunction() final { return this->write("endFunction"); }
+
+  bool pluginFunction(PluginBinding<uint64_t>&& binding) final
+  {
+    std::string name = binding.name + "." + binding.operation;
+    for(size_t i = 0; i < binding.parameters.size(); i++)
+    {
+      name += binding.parameters[i].form
+          == PluginBinding<uint64_t>::Parameter::textual
+        ? " " + binding.parameters[i].text
+        : " " + std::to_string(binding.parameters[i].number);
+    }
+
+    return this->write(name.c_str(),
+        binding.publicInputCount.size(), binding.privateInputCount.size());
+  }
+
+  bool invoke(FunctionCall* const call) final
+  {
+    this->write(call->name.c_str(), call->lineNum,
+        call->outputs.size(), call->inputs.size());
+    for(size_t i = 0; i < call->outputs.size(); i++)
+    {
+      this->write("  output", call->outputs[i].first, call->outputs[i].last);
+    }
+
+    for(size_t i = 0; i < call->inputs.size(); i++)
+    {
+      this->write("  input", call->inputs[i].first, call->inputs[i].last);
+    }
+
+    return true;
+  }
+};
+
+// Give each of the callbacks, with line numbers, to the handler.
+static void relation(wtk::circuit::Handler<uint64_t>* const handler)
+{
+  size_t line = 10;
+  handler->lineNum = line++;
+
+  FunctionSignature signature;
+  signature.name = "f";
+  signature.lineNum = 10;
+  signature.outputs.emplace_back(0, 1);
+  signature.inputs.emplace_back(0, 2);
+  signature.inputs.emplace_back(1, 3);
+  EXPECT_TRUE(handler->startFunction(std::move(signature)));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->regularFunction());
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->mulGate(3, 1, 2, 0));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->addGate(0, 3, 1, 0));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->endFunction());
+
+  handler->lineNum = line++;
+  FunctionSignature plugin_signature;
+  plugin_signature.name = "g";
+  plugin_signature.lineNum = 15;
+  plugin_signature.outputs.emplace_back(1, 8);
+  EXPECT_TRUE(handler->startFunction(std::move(plugin_signature)));
+  PluginBinding<uint64_t> binding;
+  binding.name = "ram";
+  binding.operation = "init";
+  binding.parameters.emplace_back(std::string("arith"));
+  binding.parameters.emplace_back(uint64_t(18446744073709551557u));
+  binding.publicInputCount.push_back(1);
+  EXPECT_TRUE(handler->pluginFunction(std::move(binding)));
+
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->newRange(0, 99, 0));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->publicIn(0, 0));
+  handler->lineNum = line++;
+  Range publics(1, 4);
+  EXPECT_TRUE(handler->publicInMulti(&publics, 1));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->privateIn(5, 0));
+  handler->lineNum = line++;
+  Range privates(6, 8);
+  EXPECT_TRUE(handler->privateInMulti(&privates, 1));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->addcGate(9, 0, uint64_t(18446744073709551557u), 0));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->mulcGate(10, 9, 7, 0));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->assign(11, 42, 0));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->copy(12, 11, 0));
+  handler->lineNum = line++;
+  CopyMulti copy_multi(13, 16, 1);
+  copy_multi.inputs.emplace_back(1, 2);
+  copy_multi.inputs.emplace_back(6, 7);
+  EXPECT_TRUE(handler->copyMulti(&copy_multi));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->convert(17, 18, 1, 0, 0, 0, true));
+  handler->lineNum = line++;
+  FunctionCall call;
+  call.name = "f";
+  call.lineNum = 28;
+  call.outputs.emplace_back(19, 19);
+  call.inputs.emplace_back(0, 1);
+  call.inputs.emplace_back(13, 15);
+  EXPECT_TRUE(handler->invoke(&call));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->assertZero(19, 0));
+  handler->lineNum = line++;
+  EXPECT_TRUE(handler->deleteRange(0, 99, 0));
+}
+
+TEST(Recorder, roundTrip)
+{
+  Log direct;
+  relation(&direct);
+
+  wtk::circuit::Recorder<uint64_t> recorder;
+  relation(&recorder);
+  EXPECT_LT(0u, recorder.bytes());
+
+  // Replays are identical to the callbacks, and don't change the recording.
+  for(size_t i = 0; i < 2; i++)
+  {
+    Log replayed;
+    EXPECT_TRUE(recorder.replay(&replayed));
+    ASSERT_EQ(direct.lines.size(), replayed.lines.size());
+    for(size_t j = 0; j < direct.lines.size(); j++)
+    {
+      EXPECT_EQ(direct.lines[j], replayed.lines[j]);
+    }
+  }
+}
+
+TEST(Recorder, replayFailure)
+{
+  wtk::circuit::Recorder<uint64_t> recorder;
+  relation(&recorder);
+
+  Log complete;
+  EXPECT_TRUE(recorder.replay(&complete));
+
+  // Replay stops at the first failed callback.
+  char const* const ops[] =
+    { "regularFunction", "add", "privateIn", "mulc", "deleteRange" };
+  for(size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++)
+  {
+    Log failing;
+    failing.failOn = ops[i];
+    EXPECT_FALSE(recorder.replay(&failing));
+    ASSERT_LT(0u, failing.lines.size());
+    ASSERT_LE(failing.lines.size(), complete.lines.size());
+
+    std::string const& last = failing.lines.back();
+    EXPECT_EQ(complete.lines[failing.lines.size() - 1], last);
+    EXPECT_NE(std::string::npos,
+        last.find(std::string(": ") + ops[i] + " "));
+  }
+}
@@ -0,0 +1,179 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <sst/catalog/bignum.hpp>
+
+#include <wtk/Parser.h>
+#include <wtk/circuit/Data.h>
+#include <wtk/firealarm/Wire.h>
+#include <wtk/firealarm/Counters.h>
+#include <wtk/firealarm/BitslicedBackend.h>
+
+using wtk::firealarm::Wire;
+using wtk::firealarm::TypeCounter;
+
+TEST(BitslicedBackend, laneFailures)
+{
+  std::atomic<size_t> total_current(0);
+  std::atomic<size_t> total_maximum(0);
+  TypeCounter counter(&total_current, &total_maximum);
+
+  wtk::circuit::TypeSpec<sst::bignum> const type(sst::bignum(2));
+  wtk::firealarm::BitslicedBackend<sst::bignum>
+    backend(__FILE__, &type, &counter, false, 5);
+  EXPECT_EQ(UINT64_C(0x1f), backend.laneMask);
+  EXPECT_EQ(sst::bignum(32), backend.maxInputValue());
+
+  // Bits beyond the lanes in use are ignored.
+  Wire<uint64_t> wire;
+  wire.value = UINT64_C(0xffffffffffffffe0);
+  backend.lineNum = 3;
+  backend.assertZero(&wire);
+  EXPECT_TRUE(backend.check());
+  EXPECT_EQ(UINT64_C(0), backend.failures);
+
+  wire.value = UINT64_C(0x05);
+  backend.lineNum = 4;
+  backend.assertZero(&wire);
+
+  // Only a lane's first failure is recorded.
+  wire.value = UINT64_C(0x0c);
+  backend.lineNum = 5;
+  backend.assertZero(&wire);
+
+  EXPECT_FALSE(backend.check());
+  EXPECT_EQ(UINT64_C(0x0d), backend.failures);
+  EXPECT_EQ(3u, counter.assertZero);
+
+  size_t const lines[5] = { 4, 0, 4, 5, 0 };
+  for(size_t i = 0; i < 5; i++)
+  {
+    EXPECT_EQ(lines[i] == 0, backend.checkLane(i));
+    EXPECT_EQ(lines[i], backend.failureLines[i]);
+  }
+}
+
+TEST(BitslicedBackend, suppressedAsserts)
+{
+  std::atomic<size_t> total_current(0);
+  std::atomic<size_t> total_maximum(0);
+  TypeCounter counter(&total_current, &total_maximum);
+
+  wtk::circuit::TypeSpec<sst::bignum> const type(sst::bignum(2));
+  wtk::firealarm::BitslicedBackend<sst::bignum> backend(
+      __FILE__, &type, &counter, true, wtk::firealarm::BITSLICED_LANES);
+  EXPECT_EQ(UINT64_MAX, backend.laneMask);
+
+  Wire<uint64_t> wire;
+  wire.value = UINT64_MAX;
+  backend.assertZero(&wire);
+  EXPECT_TRUE(backend.check());
+  EXPECT_EQ(1u, counter.assertZero);
+}
+
+TEST(BitslicedBackend, broadcast)
+{
+  std::atomic<size_t> total_current(0);
+  std::atomic<size_t> total_maximum(0);
+  TypeCounter counter(&total_current, &total_maximum);
+
+  wtk::circuit::TypeSpec<sst::bignum> const type(sst::bignum(2));
+  wtk::firealarm::BitslicedBackend<sst::bignum>
+    backend(__FILE__, &type, &counter, false, 7);
+
+  // Constants are given to every lane.
+  Wire<uint64_t> one;
+  backend.assign(&one, sst::bignum(1));
+  EXPECT_EQ(UINT64_MAX, one.value);
+
+  Wire<uint64_t> lanes;
+  lanes.value = UINT64_C(0x55);
+
+  Wire<uint64_t> sum;
+  backend.addcGate(&sum, &lanes, sst::bignum(1));
+  EXPECT_EQ(~UINT64_C(0x55), sum.value);
+
+  Wire<uint64_t> product;
+  backend.mulcGate(&product, &lanes, sst::bignum(0));
+  EXPECT_EQ(UINT64_C(0), product.value);
+
+  uint64_t* const prepared =
+    static_cast<uint64_t*>(backend.prepareConstant(sst::bignum(1)));
+  EXPECT_EQ(UINT64_MAX, *prepared);
+  delete prepared;
+}
+
+// A stream of the given values, for one lane.
+class ListStream : public wtk::InputStream<sst::bignum>
+{
+  std::vector<uint64_t> const values;
+  size_t place = 0;
+
+public:
+  ListStream(std::vector<uint64_t>&& vs) : values(std::move(vs))
+  {
+    this->type.reset(new wtk::circuit::TypeSpec<sst::bignum>(
+          sst::bignum(2)));
+  }
+
+  bool parseStreamHeader() override { return true; }
+
+  wtk::StreamStatus next(sst::bignum* num) override
+  {
+    if(this->place == this->values.size()) { return wtk::StreamStatus::end; }
+
+    *num = sst::bignum(this->values[this->place++]);
+    return wtk::StreamStatus::success;
+  }
+
+  size_t lineNum() override { return this->place; }
+};
+
+TEST(LaneStream, packing)
+{
+  ListStream a({ 1, 0, 1 });
+  ListStream b({ 0, 0, 1 });
+  ListStream c({ 1, 1, 0 });
+
+  wtk::firealarm::LaneStream<sst::bignum> lanes(
+      { &a, &b, &c }, { "a", "b", "c" });
+
+  uint64_t const expected[3] = { 0x5, 0x4, 0x3 };
+  for(size_t i = 0; i < 3; i++)
+  {
+    sst::bignum num(0);
+    EXPECT_EQ(wtk::StreamStatus::success, lanes.next(&num));
+    EXPECT_EQ(sst::bignum(expected[i]), num);
+  }
+
+  sst::bignum num(0);
+  EXPECT_EQ(wtk::StreamStatus::end, lanes.next(&num));
+}
+
+TEST(LaneStream, errors)
+{
+  // Lanes of different lengths.
+  ListStream a({ 1, 0 });
+  ListStream b({ 0 });
+  wtk::firealarm::LaneStream<sst::bignum> lengths(
+      { &a, &b }, { "a", "b" });
+
+  sst::bignum num(0);
+  EXPECT_EQ(wtk::StreamStatus::success, lengths.next(&num));
+  EXPECT_EQ(wtk::StreamStatus::error, lengths.next(&num));
+
+  // Values outside of GF(2).
+  ListStream c({ 1 });
+  ListStream d({ 2 });
+  wtk::firealarm::LaneStream<sst::bignum> values(
+      { &c, &d }, { "c", "d" });
+  EXPECT_EQ(wtk::StreamStatus::error, values.next(&num));
+}
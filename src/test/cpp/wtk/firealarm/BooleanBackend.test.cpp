@@ -0,0 +1,131 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <sst/catalog/bignum.hpp>
+
+#include <wtk/circuit/Data.h>
+#include <wtk/firealarm/Wire.h>
+#include <wtk/firealarm/Counters.h>
+#include <wtk/firealarm/BooleanBackend.h>
+
+using wtk::firealarm::Wire;
+using wtk::firealarm::TypeCounter;
+
+constexpr size_t N = 37;
+
+// The batch callbacks must agree with the single gates, and count the same.
+template<typename Wire_T>
+static void checkBatches(uint64_t const mask)
+{
+  std::mt19937_64 rand(N);
+  std::atomic<size_t> total_current(0);
+  std::atomic<size_t> total_maximum(0);
+  TypeCounter single_counter(&total_current, &total_maximum);
+  TypeCounter batch_counter(&total_current, &total_maximum);
+
+  wtk::circuit::TypeSpec<sst::bignum> const type(sst::bignum(2));
+  wtk::firealarm::BooleanBackend<sst::bignum, Wire_T>
+    single(__FILE__, &type, &single_counter, false);
+  wtk::firealarm::BooleanBackend<sst::bignum, Wire_T>
+    batch(__FILE__, &type, &batch_counter, false);
+
+  Wire<Wire_T> lefts[N];
+  Wire<Wire_T> rights[N];
+  Wire_T constants[N];
+  Wire<Wire_T> const* left_ptrs[N];
+  Wire<Wire_T> const* right_ptrs[N];
+  void const* constant_ptrs[N];
+  for(size_t i = 0; i < N; i++)
+  {
+    lefts[i].value = static_cast<Wire_T>(rand() & mask);
+    rights[i].value = static_cast<Wire_T>(rand() & mask);
+    constants[i] = static_cast<Wire_T>(rand() & mask);
+    left_ptrs[i] = &lefts[i];
+    right_ptrs[i] = &rights[i];
+    constant_ptrs[i] = &constants[i];
+  }
+
+  for(size_t op = 0; op < 4; op++)
+  {
+    Wire<Wire_T> expected[N];
+    Wire<Wire_T> outs[N];
+    Wire<Wire_T>* out_ptrs[N];
+    for(size_t i = 0; i < N; i++) { out_ptrs[i] = &outs[i]; }
+
+    switch(op)
+    {
+    case 0:
+    {
+      for(size_t i = 0; i < N; i++)
+      {
+        single.addGate(&expected[i], &lefts[i], &rights[i]);
+        EXPECT_EQ(lefts[i].value ^ rights[i].value, expected[i].value);
+      }
+
+      batch.addGates(out_ptrs, left_ptrs, right_ptrs, N);
+      break;
+    }
+    case 1:
+    {
+      for(size_t i = 0; i < N; i++)
+      {
+        single.mulGate(&expected[i], &lefts[i], &rights[i]);
+        EXPECT_EQ(lefts[i].value & rights[i].value, expected[i].value);
+      }
+
+      batch.mulGates(out_ptrs, left_ptrs, right_ptrs, N);
+      break;
+    }
+    case 2:
+    {
+      for(size_t i = 0; i < N; i++)
+      {
+        single.addcPrepared(&expected[i], &lefts[i], &constants[i]);
+        EXPECT_EQ(lefts[i].value ^ constants[i], expected[i].value);
+      }
+
+      batch.addcGates(out_ptrs, left_ptrs, constant_ptrs, N);
+      break;
+    }
+    case 3:
+    {
+      for(size_t i = 0; i < N; i++)
+      {
+        single.mulcPrepared(&expected[i], &lefts[i], &constants[i]);
+        EXPECT_EQ(lefts[i].value & constants[i], expected[i].value);
+      }
+
+      batch.mulcGates(out_ptrs, left_ptrs, constant_ptrs, N);
+      break;
+    }
+    }
+
+    for(size_t i = 0; i < N; i++)
+    {
+      EXPECT_EQ(expected[i].value, outs[i].value);
+      EXPECT_EQ(&batch_counter, outs[i].counter.operator->());
+    }
+
+    EXPECT_EQ(single_counter.add, batch_counter.add);
+    EXPECT_EQ(single_counter.mul, batch_counter.mul);
+    EXPECT_EQ(single_counter.currentActive, batch_counter.currentActive);
+    EXPECT_EQ(single_counter.maximumActive, batch_counter.maximumActive);
+  }
+
+  EXPECT_EQ(N, batch_counter.add);
+  EXPECT_EQ(3 * N, batch_counter.mul);
+}
+
+TEST(BooleanBackend, batches)
+{
+  checkBatches<uint8_t>(1);
+  checkBatches<uint64_t>(UINT64_MAX);
+}
@@ -0,0 +1,68 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <wtk/utils/Certificate.h>
+
+#include <stealth_logging.h>
+
+std::string hashStr(std::string const& str)
+{
+  char const* const name = "certificate_test_relation.txt";
+  FILE* const file = fopen(name, "wb");
+  EXPECT_NE(nullptr, file);
+  fwrite(str.data(), 1, str.size(), file);
+  fclose(file);
+
+  std::string digest;
+  EXPECT_TRUE(wtk::utils::hashFile(name, &digest));
+  remove(name);
+  return digest;
+}
+
+TEST(Certificate, hashFile)
+{
+  EXPECT_EQ(hashStr(""),
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  EXPECT_EQ(hashStr("abc"),
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+
+  // Longer than the read buffer
+  std::string const a(10000, 'a');
+  EXPECT_EQ(hashStr(a),
+      "27dd1f61b867b6a0f6e9d8a41c43231de52107e53ae424de8f847b821db4b711");
+
+  std::string digest;
+  EXPECT_FALSE(wtk::utils::hashFile("no_such_relation.txt", &digest));
+}
+
+TEST(Certificate, check)
+{
+  char const* const relation = "certificate_test_check.rel";
+  char const* const cert = "certificate_test_check.cert";
+
+  FILE* file = fopen(relation, "wb");
+  ASSERT_NE(nullptr, file);
+  fputs("version 2.1.0;\n", file);
+  fclose(file);
+
+  EXPECT_TRUE(wtk::utils::writeCertificate(cert, relation));
+  EXPECT_TRUE(wtk::utils::checkCertificate(cert, relation));
+
+  // Changing the relation invalidates the certificate.
+  file = fopen(relation, "ab");
+  ASSERT_NE(nullptr, file);
+  fputs("circuit;\n", file);
+  fclose(file);
+
+  EXPECT_FALSE(wtk::utils::checkCertificate(cert, relation));
+
+  remove(relation);
+  remove(cert);
+}
@@ -0,0 +1,100 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <wtk/utils/Extension.h>
+
+// Schoolbook multiplication, reduced one coefficient at a time.
+template<size_t N>
+static wtk::utils::ExtElement<N> reference(uint64_t const prime,
+    size_t const degree, uint64_t const* const modulus,
+    wtk::utils::ExtElement<N> const& a, wtk::utils::ExtElement<N> const& b)
+{
+  wtk::utils::Modulus<uint64_t> const base(prime);
+  uint64_t product[2 * N] = { 0 };
+  for(size_t i = 0; i < degree; i++)
+  {
+    for(size_t j = 0; j < degree; j++)
+    {
+      product[i + j] = base.add(product[i + j],
+          base.mul(a.coeffs[i], b.coeffs[j]));
+    }
+  }
+
+  for(size_t i = 2 * degree - 1; i-- > degree;)
+  {
+    for(size_t j = 0; j < degree; j++)
+    {
+      uint64_t const t = base.mul(product[i], modulus[j]);
+      product[i - degree + j] = t == 0
+        ? product[i - degree + j]
+        : base.add(product[i - degree + j], prime - t);
+    }
+  }
+
+  wtk::utils::ExtElement<N> ret;
+  for(size_t i = 0; i < degree; i++) { ret.coeffs[i] = product[i]; }
+  return ret;
+}
+
+template<size_t N>
+static void check(uint64_t const prime, std::mt19937_64* const rand)
+{
+  for(size_t degree = 1; degree <= N; degree++)
+  {
+    uint64_t modulus[N] = { 0 };
+    for(size_t i = 0; i < degree; i++) { modulus[i] = (*rand)() % prime; }
+    wtk::utils::Extension<N> const ext(prime, degree, modulus);
+
+    for(size_t k = 0; k < 1000; k++)
+    {
+      wtk::utils::ExtElement<N> a;
+      wtk::utils::ExtElement<N> b;
+      for(size_t i = 0; i < degree; i++)
+      {
+        a.coeffs[i] = (*rand)() % prime;
+        b.coeffs[i] = (*rand)() % prime;
+      }
+
+      wtk::utils::ExtElement<N> sum;
+      for(size_t i = 0; i < degree; i++)
+      {
+        sum.coeffs[i] = (a.coeffs[i] + b.coeffs[i]) % prime;
+      }
+
+      EXPECT_EQ(sum, ext.add(a, b));
+      EXPECT_EQ(reference(prime, degree, modulus, a, b), ext.mul(a, b));
+    }
+  }
+}
+
+TEST(Extension, small)
+{
+  std::mt19937_64 rand(1);
+  uint64_t const primes[] = { 2, 3, 7, 251 };
+  for(uint64_t const prime : primes)
+  {
+    check<2>(prime, &rand);
+    check<4>(prime, &rand);
+    check<8>(prime, &rand);
+  }
+}
+
+TEST(Extension, large)
+{
+  std::mt19937_64 rand(2);
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+  uint64_t const prime = (UINT64_C(1) << 61) - 1;
+#else
+  uint64_t const prime = UINT64_C(4294967291);
+#endif
+  check<2>(prime, &rand);
+  check<4>(prime, &rand);
+  check<8>(prime, &rand);
+}
@@ -0,0 +1,279 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <wtk/utils/Modulus.h>
+
+// Narrow residues are widened, so their products don't overflow.
+template<typename Wire_T>
+void checkNarrow(uint64_t const prime)
+{
+  wtk::utils::Modulus<Wire_T> const modulus((Wire_T) prime);
+  std::mt19937_64 rand(3);
+
+  for(size_t i = 0; i < 10000; i++)
+  {
+    uint64_t const a = i == 0 ? prime - 1 : rand() % prime;
+    uint64_t const b = i == 0 ? prime - 1 : rand() % prime;
+    EXPECT_EQ((a + b) % prime, modulus.add((Wire_T) a, (Wire_T) b));
+    EXPECT_EQ((a * b) % prime, modulus.mul((Wire_T) a, (Wire_T) b));
+  }
+}
+
+TEST(Modulus, narrow)
+{
+  checkNarrow<uint8_t>(251);
+  checkNarrow<uint16_t>(257);
+  checkNarrow<uint16_t>(65521);
+  checkNarrow<uint32_t>(65537);
+  checkNarrow<uint32_t>(4294967291);
+}
+
+// Accumulate unreduced sums up to the maximum excess, comparing each to the
+// reduced sum. The first residue is the largest, prime - 1.
+template<typename Wire_T, typename Rand_T>
+void checkExcess(Wire_T const& prime, Rand_T next)
+{
+  wtk::utils::Modulus<Wire_T> const modulus(prime);
+
+  Wire_T const largest = (Wire_T) next(true);
+  Wire_T sum = largest;
+  Wire_T reduced = largest;
+  for(size_t i = 1; i <= modulus.maxExcess; i++)
+  {
+    Wire_T const residue = (Wire_T) next(i % 2 == 0);
+    sum = modulus.sum(sum, residue);
+    reduced = modulus.add(reduced, residue);
+    EXPECT_TRUE(reduced == modulus.canonical(sum, (uint8_t) i));
+  }
+}
+
+TEST(Modulus, excess)
+{
+  std::mt19937_64 rand(4);
+
+  uint64_t const narrow_primes[] = {
+    2, 7, 251, 257, 65521, 1073741789, 2147483647 };
+  for(uint64_t const prime : narrow_primes)
+  {
+    auto next = [&](bool const largest) {
+      return largest ? prime - 1 : rand() % prime;
+    };
+
+    if(prime < UINT8_MAX) { checkExcess<uint8_t>((uint8_t) prime, next); }
+    if(prime < UINT16_MAX) { checkExcess<uint16_t>((uint16_t) prime, next); }
+    checkExcess<uint32_t>((uint32_t) prime, next);
+  }
+
+  EXPECT_EQ(63u, wtk::utils::Modulus<uint8_t>(2).maxExcess);
+  EXPECT_EQ(0u, wtk::utils::Modulus<uint8_t>(251).maxExcess);
+  EXPECT_EQ(0u, wtk::utils::Modulus<uint16_t>(65521).maxExcess);
+  EXPECT_EQ(0u, wtk::utils::Modulus<uint32_t>(2147483647).maxExcess);
+  EXPECT_EQ(3u, wtk::utils::Modulus<uint32_t>(1073741789).maxExcess);
+  EXPECT_EQ(255u, wtk::utils::Modulus<uint32_t>(65521).maxExcess);
+}
+
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+
+// Compare to 128-bit division, for a prime near each width.
+TEST(Modulus, uint64)
+{
+  uint64_t const primes[] = {
+    251,
+    2147483647,
+    4294967291,
+    4294967311,
+    2305843009213693951,
+    18446744069414584321u,
+    18446744073709551557u
+  };
+
+  std::mt19937_64 rand(1);
+
+  for(uint64_t const prime : primes)
+  {
+    wtk::utils::Modulus<uint64_t> const modulus(prime);
+
+    uint64_t const edges[] = { 0, 1, 2, prime - 2, prime - 1 };
+    for(uint64_t const a : edges)
+    {
+      for(uint64_t const b : edges)
+      {
+        EXPECT_EQ((uint64_t) (((wtk::utils::uint128_t) a + b) % prime),
+            modulus.add(a, b));
+        EXPECT_EQ((uint64_t) (((wtk::utils::uint128_t) a * b) % prime),
+            modulus.mul(a, b));
+      }
+    }
+
+    for(size_t i = 0; i < 10000; i++)
+    {
+      uint64_t const a = rand() % prime;
+      uint64_t const b = rand() % prime;
+      EXPECT_EQ((uint64_t) (((wtk::utils::uint128_t) a + b) % prime),
+          modulus.add(a, b));
+      EXPECT_EQ((uint64_t) (((wtk::utils::uint128_t) a * b) % prime),
+          modulus.mul(a, b));
+    }
+  }
+
+  for(uint64_t const prime : primes)
+  {
+    checkExcess<uint64_t>(prime, [&](bool const largest) {
+      return largest ? prime - 1 : rand() % prime;
+    });
+  }
+
+  EXPECT_EQ(255u, wtk::utils::Modulus<uint64_t>(4294967311).maxExcess);
+  EXPECT_EQ(7u, wtk::utils::Modulus<uint64_t>(2305843009213693951).maxExcess);
+  EXPECT_EQ(0u,
+      wtk::utils::Modulus<uint64_t>(18446744073709551557u).maxExcess);
+
+  // Pseudo-Mersenne primes are detected, except when c is too large.
+  EXPECT_EQ(5u, wtk::utils::Modulus<uint64_t>(251).offset);
+  EXPECT_EQ(1u, wtk::utils::Modulus<uint64_t>(2305843009213693951).offset);
+  EXPECT_EQ(59u, wtk::utils::Modulus<uint64_t>(18446744073709551557u).offset);
+  EXPECT_EQ(4294967295u,
+      wtk::utils::Modulus<uint64_t>(18446744069414584321u).offset);
+  EXPECT_EQ(0u, wtk::utils::Modulus<uint64_t>(4294967311).offset);
+}
+
+template<size_t N>
+wtk::utils::FixedUint<N> randomResidue(
+    std::mt19937_64* const rand, wtk::utils::FixedUint<N> const& prime)
+{
+  wtk::utils::FixedUint<N> ret;
+  do
+  {
+    for(size_t i = 0; i < N; i++) { ret.limbs[i] = (*rand)(); }
+
+    // Clear the bits above the prime's top limb.
+    uint64_t mask = UINT64_MAX;
+    while((prime.limbs[N - 1] & ~(mask >> 1)) == 0) { mask >>= 1; }
+    ret.limbs[N - 1] &= mask;
+  } while(!(ret < prime));
+
+  return ret;
+}
+
+// Reference product, by doubling and adding.
+template<size_t N>
+wtk::utils::FixedUint<N> slowMul(wtk::utils::Modulus<wtk::utils::FixedUint<N>>
+    const& modulus, wtk::utils::FixedUint<N> const& a,
+    wtk::utils::FixedUint<N> const& b)
+{
+  wtk::utils::FixedUint<N> ret(0);
+  for(size_t i = 64 * N; i > 0; i--)
+  {
+    ret = modulus.add(ret, ret);
+    if(((b.limbs[(i - 1) / 64] >> ((i - 1) % 64)) & 1) != 0)
+    {
+      ret = modulus.add(ret, a);
+    }
+  }
+
+  return ret;
+}
+
+template<size_t N>
+void checkFixed(wtk::utils::FixedUint<N> const& prime)
+{
+  wtk::utils::Modulus<wtk::utils::FixedUint<N>> const modulus(prime);
+  std::mt19937_64 rand(2);
+
+  wtk::utils::FixedUint<N> minus_one = prime;
+  minus_one.limbs[0] -= 1;
+  EXPECT_TRUE(modulus.mul(minus_one, minus_one) == wtk::utils::FixedUint<N>(1));
+  EXPECT_TRUE(modulus.add(minus_one, wtk::utils::FixedUint<N>(1))
+      == wtk::utils::FixedUint<N>(0));
+
+  for(size_t i = 0; i < 1000; i++)
+  {
+    wtk::utils::FixedUint<N> const a = randomResidue(&rand, prime);
+    wtk::utils::FixedUint<N> const b = randomResidue(&rand, prime);
+    EXPECT_TRUE(modulus.mul(a, b) == slowMul(modulus, a, b));
+  }
+
+  checkExcess(prime, [&](bool const largest) {
+    return largest ? minus_one : randomResidue(&rand, prime);
+  });
+}
+
+TEST(Modulus, FixedUint2)
+{
+  // 2^127 - 1, whose sums are compared to 128-bit arithmetic.
+  wtk::utils::FixedUint<2> prime;
+  prime.limbs[0] = UINT64_MAX;
+  prime.limbs[1] = UINT64_MAX >> 1;
+  checkFixed(prime);
+  EXPECT_EQ(1u, wtk::utils::Modulus<wtk::utils::FixedUint<2>>(prime).offset);
+
+  wtk::utils::uint128_t const wide_prime =
+    ((wtk::utils::uint128_t) prime.limbs[1] << 64) | prime.limbs[0];
+  wtk::utils::Modulus<wtk::utils::FixedUint<2>> const modulus(prime);
+  std::mt19937_64 rand(3);
+  for(size_t i = 0; i < 1000; i++)
+  {
+    wtk::utils::FixedUint<2> const a = randomResidue(&rand, prime);
+    wtk::utils::FixedUint<2> const b = randomResidue(&rand, prime);
+    wtk::utils::uint128_t const sum =
+      ((((wtk::utils::uint128_t) a.limbs[1] << 64) | a.limbs[0])
+       + (((wtk::utils::uint128_t) b.limbs[1] << 64) | b.limbs[0]))
+      % wide_prime;
+
+    wtk::utils::FixedUint<2> const expected = modulus.add(a, b);
+    EXPECT_EQ((uint64_t) sum, expected.limbs[0]);
+    EXPECT_EQ((uint64_t) (sum >> 64), expected.limbs[1]);
+  }
+
+  // 2^128 - 159, filling both limbs.
+  prime.limbs[0] = UINT64_MAX - 158;
+  prime.limbs[1] = UINT64_MAX;
+  checkFixed(prime);
+  EXPECT_EQ(159u, wtk::utils::Modulus<wtk::utils::FixedUint<2>>(prime).offset);
+
+  // A prime just above 2^64, which is not pseudo-Mersenne.
+  prime.limbs[0] = 13;
+  prime.limbs[1] = 1;
+  checkFixed(prime);
+  EXPECT_EQ(0u, wtk::utils::Modulus<wtk::utils::FixedUint<2>>(prime).offset);
+  EXPECT_EQ(255u,
+      wtk::utils::Modulus<wtk::utils::FixedUint<2>>(prime).maxExcess);
+}
+
+TEST(Modulus, FixedUint4)
+{
+  // 2^255 - 19
+  wtk::utils::FixedUint<4> prime;
+  prime.limbs[0] = UINT64_MAX - 18;
+  prime.limbs[1] = UINT64_MAX;
+  prime.limbs[2] = UINT64_MAX;
+  prime.limbs[3] = UINT64_MAX >> 1;
+  checkFixed(prime);
+  EXPECT_EQ(19u, wtk::utils::Modulus<wtk::utils::FixedUint<4>>(prime).offset);
+
+  // 2^256 - 189
+  prime.limbs[0] = UINT64_MAX - 188;
+  prime.limbs[3] = UINT64_MAX;
+  checkFixed(prime);
+
+  // The BLS12-381 scalar field.
+  prime.limbs[0] = 0xffffffff00000001;
+  prime.limbs[1] = 0x53bda402fffe5bfe;
+  prime.limbs[2] = 0x3339d80809a1d805;
+  prime.limbs[3] = 0x73eda753299d7d48;
+  checkFixed(prime);
+  EXPECT_EQ(0u, wtk::utils::Modulus<wtk::utils::FixedUint<4>>(prime).offset);
+
+  EXPECT_EQ(std::string("524358751751261904794477405081859658376905525005276"
+        "37822603658699938581184513"), wtk::utils::dec(prime));
+}
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
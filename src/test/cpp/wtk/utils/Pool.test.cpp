@@ -0,0 +1,124 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <wtk/utils/Pool.h>
+
+#include <stealth_logging.h>
+#include <stealth_timer.h>
+
+struct Counted
+{
+  static size_t live;
+
+  size_t value;
+
+  Counted() : value(0) { live++; }
+  Counted(size_t v) : value(v) { live++; }
+  ~Counted() { live--; }
+};
+
+size_t Counted::live = 0;
+
+TEST(Pool, Allocate)
+{
+  {
+    wtk::utils::Pool<Counted, 16> pool;
+
+    Counted* a = pool.allocate(1, 1);
+    Counted* b = pool.allocate(10, 2);
+    Counted* c = pool.allocate(10, 3); // doesn't fit in the first batch
+    Counted* d = pool.allocate(100, 4); // dedicated block
+
+    EXPECT_EQ(a->value, 1);
+    for(size_t i = 0; i < 10; i++) { EXPECT_EQ(b[i].value, 2); }
+    for(size_t i = 0; i < 10; i++) { EXPECT_EQ(c[i].value, 3); }
+    for(size_t i = 0; i < 100; i++) { EXPECT_EQ(d[i].value, 4); }
+    EXPECT_EQ(Counted::live, 121);
+
+    // The remainder of the second batch (6 items) is still used.
+    Counted* e = pool.allocate(6, 5);
+    EXPECT_EQ(e, c + 10);
+    EXPECT_EQ(Counted::live, 127);
+  }
+
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(Pool, ThreadLocal)
+{
+  size_t* a = wtk::utils::threadLocalPool<size_t>().allocate(1, 7);
+  size_t* b = wtk::utils::threadLocalPool<size_t>().allocate(1, 8);
+  EXPECT_EQ(*a, 7);
+  EXPECT_EQ(b, a + 1);
+}
+
+TEST(Pool, Stats)
+{
+  wtk::utils::Pool<Counted, 16> pool;
+
+  pool.allocate(4, 1);
+  pool.allocate(100, 2); // dedicated block
+  EXPECT_EQ(pool.stats().live, 104 * sizeof(Counted));
+  EXPECT_EQ(pool.reserved(), 116 * sizeof(Counted));
+
+  pool.allocate(4, 3);
+  EXPECT_EQ(pool.stats().allocated, 108 * sizeof(Counted));
+  EXPECT_EQ(pool.reserved(), 116 * sizeof(Counted));
+}
+
+TEST(Pool, Performance)
+{
+  size_t const count = 1 << 20;
+  std::vector<uint64_t*> ptrs(count);
+
+  Timer malloc_timer;
+  malloc_timer.start();
+
+  for(size_t round = 0; round < 4; round++)
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      ptrs[i] = (uint64_t*) malloc(sizeof(uint64_t) * (1 + (i & 3)));
+      ptrs[i][0] = i;
+    }
+
+    for(size_t i = 0; i < count; i++)
+    {
+      EXPECT_TRUE(ptrs[i][0] == i);
+      free(ptrs[i]);
+    }
+  }
+
+  malloc_timer.stop();
+  log_info("malloc time: %lums", malloc_timer.milliseconds());
+
+  Timer pool_timer;
+  pool_timer.start();
+
+  for(size_t round = 0; round < 4; round++)
+  {
+    wtk::utils::Pool<uint64_t> pool;
+
+    for(size_t i = 0; i < count; i++)
+    {
+      ptrs[i] = pool.allocate(1 + (i & 3));
+      ptrs[i][0] = i;
+    }
+
+    for(size_t i = 0; i < count; i++)
+    {
+      EXPECT_TRUE(ptrs[i][0] == i);
+    }
+  }
+
+  pool_timer.stop();
+  log_info("pool time: %lums", pool_timer.milliseconds());
+}
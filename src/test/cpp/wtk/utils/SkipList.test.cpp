@@ -760,3 +760,38 @@ TEST(SkipList, overflow)
 
   list.clear();
 }
+
+TEST(SkipList, stats)
+{
+  wtk::utils::MemStats stats;
+  size_t three = 0;
+
+  {
+    wtk::utils::SkipList<size_t> list;
+    list.insert(1);
+    list.setStats(&stats);
+    EXPECT_EQ(stats.live, list.bytes());
+
+    list.insert(5, 7);
+    list.insert(10);
+    three = list.bytes();
+    EXPECT_EQ(stats.live, three);
+
+    list.insert(2, 4); // joins [1] and [5, 7]
+    list.insert(8, 9); // joins [1, 7] and [10]
+    EXPECT_EQ(stats.live, list.bytes());
+    EXPECT_EQ(3 * stats.live, three);
+
+    list.remove(5); // splits
+    EXPECT_EQ(stats.live, list.bytes());
+
+    wtk::utils::SkipList<size_t> moved(std::move(list));
+    EXPECT_EQ(stats.live, moved.bytes());
+
+    list = moved; // copies are not accounted.
+    EXPECT_EQ(stats.live, moved.bytes());
+  }
+
+  EXPECT_EQ(stats.live, 0);
+  EXPECT_EQ(stats.peak, three);
+}
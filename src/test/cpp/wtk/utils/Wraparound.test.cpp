@@ -0,0 +1,100 @@
+/**
+ * Copyright 2022, Stealth Software Technologies, Inc.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <wtk/utils/Wraparound.h>
+
+// Compare to arithmetic modulo 2^32, for each width up to 8.
+TEST(Wraparound, uint8)
+{
+  for(size_t bits = 1; bits <= 8; bits++)
+  {
+    uint32_t const mask = (UINT32_C(1) << bits) - 1;
+    wtk::utils::Wraparound<uint8_t> const ring((uint8_t) mask);
+
+    for(uint32_t a = 0; a <= mask; a++)
+    {
+      for(uint32_t b = 0; b <= mask; b++)
+      {
+        EXPECT_EQ((a + b) & mask, ring.add((uint8_t) a, (uint8_t) b));
+        EXPECT_EQ((a * b) & mask, ring.mul((uint8_t) a, (uint8_t) b));
+      }
+    }
+  }
+}
+
+TEST(Wraparound, uint64)
+{
+  std::mt19937_64 rand(1);
+
+  size_t const widths[] = { 9, 16, 32, 33, 63, 64 };
+  for(size_t const bits : widths)
+  {
+    uint64_t const mask = bits == 64 ? UINT64_MAX : (UINT64_C(1) << bits) - 1;
+    wtk::utils::Wraparound<uint64_t> const ring(mask);
+
+    EXPECT_EQ(0u, ring.add(mask, 1));
+    EXPECT_EQ(1u, ring.mul(mask, mask));
+
+    for(size_t i = 0; i < 10000; i++)
+    {
+      uint64_t const a = rand() & mask;
+      uint64_t const b = rand() & mask;
+      EXPECT_EQ((a + b) & mask, ring.add(a, b));
+      EXPECT_EQ((a * b) & mask, ring.mul(a, b));
+    }
+  }
+}
+
+#ifdef WTK_UTILS_MODULUS_WIDE_64
+
+// Compare to 128-bit arithmetic.
+TEST(Wraparound, FixedUint2)
+{
+  std::mt19937_64 rand(2);
+
+  size_t const widths[] = { 65, 100, 127, 128 };
+  for(size_t const bits : widths)
+  {
+    wtk::utils::uint128_t const wide_mask = bits == 128
+      ? ~(wtk::utils::uint128_t) 0
+      : ((wtk::utils::uint128_t) 1 << bits) - 1;
+    wtk::utils::FixedUint<2> mask;
+    mask.limbs[0] = (uint64_t) wide_mask;
+    mask.limbs[1] = (uint64_t) (wide_mask >> 64);
+    wtk::utils::Wraparound<wtk::utils::FixedUint<2>> const ring(mask);
+
+    for(size_t i = 0; i < 10000; i++)
+    {
+      wtk::utils::FixedUint<2> a;
+      wtk::utils::FixedUint<2> b;
+      a.limbs[0] = rand() & mask.limbs[0];
+      a.limbs[1] = rand() & mask.limbs[1];
+      b.limbs[0] = rand() & mask.limbs[0];
+      b.limbs[1] = rand() & mask.limbs[1];
+
+      wtk::utils::uint128_t const wide_a =
+        ((wtk::utils::uint128_t) a.limbs[1] << 64) | a.limbs[0];
+      wtk::utils::uint128_t const wide_b =
+        ((wtk::utils::uint128_t) b.limbs[1] << 64) | b.limbs[0];
+      wtk::utils::uint128_t const sum = (wide_a + wide_b) & wide_mask;
+      wtk::utils::uint128_t const product = (wide_a * wide_b) & wide_mask;
+
+      wtk::utils::FixedUint<2> const actual_sum = ring.add(a, b);
+      EXPECT_EQ((uint64_t) sum, actual_sum.limbs[0]);
+      EXPECT_EQ((uint64_t) (sum >> 64), actual_sum.limbs[1]);
+
+      wtk::utils::FixedUint<2> const actual_product = ring.mul(a, b);
+      EXPECT_EQ((uint64_t) product, actual_product.limbs[0]);
+      EXPECT_EQ((uint64_t) (product >> 64), actual_product.limbs[1]);
+    }
+  }
+}
+
+#endif//WTK_UTILS_MODULUS_WIDE_64
@@ -17,6 +17,7 @@ import memchk
 import memchk_bool
 import less_than_div_test as cmp_div
 import multi_input_copy
+import function_gates as gates
 
 CMD_DIR = "target/" if len(sys.argv) == 1 else sys.argv[1]
 FIREALARM_CMD = CMD_DIR + "wtk-firealarm"
@@ -42,16 +43,27 @@ class Test:
     self.valgrindRun = False
     self.valgrindSuccess = True
     self.flatbufferRun = False
-
-  def runHelper(self, use_valgrind, program, args):
+    # Options for FIREALARM, whether it should accept the test case, and
+    # lines which its output should contain.
+    self.flags = []
+    self.expectOk = True
+    self.expectLines = []
+
+  def hasLines(self, output, lines):
+    for line in lines:
+      if not line in output:
+        print(RED_COLOR + "Missing Output: " + DEFAULT_COLOR + line)
+        return False
+    return True
+
+  def runHelper(self, use_valgrind, program, args, expect_ok = True, \
+      expect_lines = []):
     if has_valgrind and use_valgrind:
       cmd_line = [ valgrind_cmd, "--leak-check=summary" ] + [ program ] + args
-      grep_cmd = [ "grep", "ERROR SUMMARY: 0 errors" ]
-      cmd_proc = sp.Popen(cmd_line, stdout=sp.PIPE, stderr=sp.STDOUT)
-      grep_proc = sp.run(grep_cmd, stdin=cmd_proc.stdout, stdout=sp.DEVNULL)
-      cmd_proc.wait()
-      cmd_ok = cmd_proc.returncode == 0
-      vg_ok = grep_proc.returncode == 0
+      cmd_proc = sp.run(cmd_line, stdout=sp.PIPE, stderr=sp.STDOUT, text=True)
+      cmd_ok = (cmd_proc.returncode == 0) == expect_ok \
+          and self.hasLines(cmd_proc.stdout, expect_lines)
+      vg_ok = "ERROR SUMMARY: 0 errors" in cmd_proc.stdout
       self.valgrindSuccess = self.valgrindSuccess and vg_ok
       self.valgrindRun = True
       if not(cmd_ok and vg_ok):
@@ -59,7 +71,13 @@ class Test:
       self.success = self.success and cmd_ok
     else:
       cmd = [ program ] + args
-      ok = 0 == sp.run(cmd, stdout=sp.DEVNULL, stderr=sp.DEVNULL).returncode
+      if expect_lines == []:
+        ok = (0 == sp.run(cmd, stdout=sp.DEVNULL, stderr=sp.DEVNULL) \
+            .returncode) == expect_ok
+      else:
+        cmd_proc = sp.run(cmd, stdout=sp.PIPE, stderr=sp.STDOUT, text=True)
+        ok = (cmd_proc.returncode == 0) == expect_ok \
+            and self.hasLines(cmd_proc.stdout, expect_lines)
       if not ok:
         print(RED_COLOR + "Failed Cmd: " + DEFAULT_COLOR + " ".join(cmd))
       self.success = self.success and ok
@@ -68,34 +86,41 @@ class Test:
     try:
       self.generateTestCase(basename)
     except Exception as e:
-      print(PURPLE_COLOR + "Skipping Test: " + DEFAULT_COLOR + self.name())
+      print(PURPLE_COLOR + "Skipping Test: " + DEFAULT_COLOR + self.fullName())
       print(e)
       self.skip = True
     else:
       use_valgrind = random.randint(0, 250) == 0
       test_files = self.testFiles()
       self.success = True
-      self.runHelper(use_valgrind, FIREALARM_CMD, test_files)
-      if random.randint(0, 8) > 2:
+      self.runHelper(use_valgrind, FIREALARM_CMD, self.flags + test_files, \
+          self.expectOk, self.expectLines)
+      if self.flags == [] and random.randint(0, 8) > 2:
         flatbuffer_files = []
         for f in test_files:
           self.runHelper(use_valgrind, PRESS_CMD, ["t2f", f, f + ".sieve"])
           flatbuffer_files.append(f + ".sieve")
-        self.runHelper(use_valgrind, FIREALARM_CMD, ["-f"] + flatbuffer_files)
+        self.runHelper(use_valgrind, FIREALARM_CMD, ["-f"] + flatbuffer_files, \
+            self.expectOk)
         retext_files = []
         for f in flatbuffer_files:
           self.runHelper(use_valgrind, PRESS_CMD, ["f2t", f, f + ".retxt"])
           retext_files.append(f + ".retxt")
-        self.runHelper(use_valgrind, FIREALARM_CMD, retext_files)
+        self.runHelper(use_valgrind, FIREALARM_CMD, retext_files, \
+            self.expectOk)
         self.flatbufferRun = True
 
+  def fullName(self):
+    return " ".join([ self.name() ] + self.flags)
+
   def report(self):
     if not self.skip:
       if not self.success:
-        print(RED_COLOR + "Failure: " + DEFAULT_COLOR + self.name())
+        print(RED_COLOR + "Failure: " + DEFAULT_COLOR + self.fullName())
       if self.valgrindRun:
         if not self.valgrindSuccess:
-          print(RED_COLOR + "Valgrind Failure: " + DEFAULT_COLOR + self.name())
+          print(RED_COLOR + "Valgrind Failure: " + DEFAULT_COLOR \
+              + self.fullName())
     return self.skip, self.success, self.valgrindRun, self.valgrindSuccess, self.flatbufferRun
 
 # list of tests (append to, then run them)
@@ -372,6 +397,316 @@ class MultiInputCopyTest(Test):
 for prime in primes[2:]:
   tests.append(MultiInputCopyTest(prime))
 
+# ==== Function Gates Tests ====
+
+# Each kind of gate, within functions, with a witness which should be
+# accepted, or (when bad) rejected by an assertion.
+class GatesTest(Test):
+  def __init__(self, types, n, bad = False, second = None, \
+      use_map = False, nested = False):
+    super().__init__()
+    self.types = types
+    self.n = n
+    self.bad = bad
+    self.second = second
+    self.useMap = use_map
+    self.nested = nested
+    self.expectOk = not bad
+    self.expectLines = [ "Assert zero failed" ] if bad else []
+    self.spec = None
+
+  def name(self):
+    types = self.types + ([] if self.second == None else [ self.second ])
+    decls = [ t.decl(types)[len("@type "):-len(";\n")] for t in types ]
+    return "gates(types:" + ", ".join(decls) + ", n:" + str(self.n) \
+        + (", map" if self.useMap else "") \
+        + (", nested" if self.nested else "") \
+        + (", bad" if self.bad else "") + ")"
+
+  def generateTestCase(self, basename):
+    self.basename = basename
+    self.spec = gates.Spec(self.types, self.n, self.second, self.useMap, \
+        self.nested)
+    names = self.testFiles()
+    gates.relation(open(names[0], "w"), self.spec)
+    self.streams(names[1:], self.bad)
+
+  # Write one instance and witness from the spec, to the given files (the
+  # instances of each type, then their witnesses).
+  def streams(self, names, bad):
+    k = len(self.spec.types)
+    gates.streams(self.spec, [ open(f, "w") for f in names[:k] ], \
+        [ open(f, "w") for f in names[k:] ], bad)
+
+  def streamFiles(self, suffix = ""):
+    k = len(self.types) + (0 if self.second == None else 1)
+    return [ self.basename + suffix + "." + str(t) + ".ins" \
+            for t in range(k) ] \
+        + [ self.basename + suffix + "." + str(t) + ".wit" \
+            for t in range(k) ]
+
+  def testFiles(self):
+    return [ self.basename + ".rel" ] + self.streamFiles()
+
+gates_sizes = [ 1, 2, 5, 16 ]
+
+for prime in primes:
+  for n in gates_sizes:
+    tests.append(GatesTest([ gates.Field(prime) ], n))
+    tests.append(GatesTest([ gates.Field(prime) ], n, True))
+
+# ==== Compiled Function Replay and Memoization Tests ====
+
+# Repeat a test with the given FIREALARM options.
+def withFlags(test, flags):
+  test.flags = flags
+  return test
+
+replay_flags = [ [ "--compiled" ], [ "--memoize", "16" ], \
+    [ "--compiled", "--memoize", "16" ] ]
+replay_matrix_irs = [ "dotprod_tb", "dotprod_pt", "plugin_pt", \
+    "dotprod_row_tb", "mem_dotprod_tb" ]
+
+for flags in replay_flags:
+  for prime in primes:
+    for ir in replay_matrix_irs:
+      tests.append(withFlags(MatrixTest(prime, ir, 4, 3, 5), flags))
+    for bad in [ False, True ]:
+      tests.append(withFlags(GatesTest([ gates.Field(prime) ], 5, bad), flags))
+    if 16 <= prime:
+      tests.append(withFlags(MemChkTest(16, prime), flags))
+      tests.append(withFlags(MemChkTest(16, prime, True), flags))
+
+# ==== Batched Gate Tests ====
+
+# Long runs of each gate, which are given to backends in batches, and again
+# with a trace, which evaluates them one at a time.
+batch_gates_sizes = [ 63, 64, 65, 200 ]
+
+for prime in primes:
+  for n in batch_gates_sizes:
+    for bad in [ False, True ]:
+      tests.append(GatesTest([ gates.Field(prime) ], n, bad))
+      tests.append(withFlags(GatesTest([ gates.Field(prime) ], n, bad), \
+          [ "-t" ]))
+  tests.append(withFlags(MatrixTest(prime, "flat_tb", 10, 10, 10), [ "-t" ]))
+
+# ==== Type-Parallel Tests ====
+
+# Relations with a second field, which is given a value by conversion, with
+# each type evaluated by its own thread.
+for fprime in primes[1:]:
+  for gprime in primes[1:]:
+    if fprime != gprime:
+      for bad in [ False, True ]:
+        tests.append(GatesTest([ gates.Field(fprime) ], 5, bad, \
+            gates.Field(gprime)))
+        tests.append(withFlags(GatesTest([ gates.Field(fprime) ], 5, bad, \
+            gates.Field(gprime)), [ "--parallel" ]))
+        tests.append(withFlags(GatesTest([ gates.Field(fprime) ], 5, bad, \
+            gates.Field(gprime)), [ "--parallel", "--compiled" ]))
+
+for fprime in primes:
+  for gprime in primes:
+    if 8 <= fprime and fprime != gprime:
+      tests.append(withFlags(Mux2Test(fprime, gprime, 8, 16), \
+          [ "--parallel" ]))
+
+# ==== Map Plugin Tests ====
+
+# Products computed by an iter_v0 map, with enough iterations to be split
+# among threads.
+map_sizes = [ 1, 5, 64, 200 ]
+
+for prime in primes:
+  for n in map_sizes:
+    for bad in [ False, True ]:
+      tests.append(GatesTest([ gates.Field(prime) ], n, bad, use_map = True))
+  for flags in [ [ "--parallel" ], [ "--compiled" ] ]:
+    for bad in [ False, True ]:
+      tests.append(withFlags(GatesTest([ gates.Field(prime) ], 64, bad, \
+          use_map = True), flags))
+
+# ==== Nested Plugin Tests ====
+
+# Products computed by a map of maps, so that plugin functions invoke other
+# plugin functions.
+for prime in primes:
+  for n in [ 1, 4, 33 ]:
+    for bad in [ False, True ]:
+      tests.append(GatesTest([ gates.Field(prime) ], n, bad, nested = True))
+      tests.append(withFlags(GatesTest([ gates.Field(prime) ], n, bad, \
+          nested = True), [ "--compiled" ]))
+
+# ==== GF(2) Tests ====
+
+# The Boolean backend, in each evaluation mode.
+for flags in [ [], [ "-t" ], [ "--compiled" ], [ "--memoize", "16" ] ]:
+  for n in [ 1, 3, 64, 129 ]:
+    for bad in [ False, True ]:
+      tests.append(withFlags(GatesTest([ gates.Field(2) ], n, bad), flags))
+      tests.append(withFlags(GatesTest([ gates.Field(2) ], n, bad, \
+          use_map = True), flags))
+
+# ==== Bitsliced GF(2) Tests ====
+
+# Many input sets for one GF(2) relation, some of which (bads) should be
+# rejected, each of which is reported on.
+class BitsliceTest(GatesTest):
+  def __init__(self, n, bads, use_map = False):
+    super().__init__([ gates.Field(2) ], n, use_map = use_map)
+    self.bads = bads
+    self.flags = [ "--bitslice" ]
+    self.expectOk = not True in self.bads
+
+  def name(self):
+    return "bitslice(n:" + str(self.n) + ", sets:" + str(len(self.bads)) \
+        + ", bad:" + str([ k for k in range(len(self.bads)) \
+          if self.bads[k] ]) \
+        + (", map" if self.useMap else "") + ")"
+
+  def generateTestCase(self, basename):
+    self.basename = basename
+    self.spec = gates.Spec(self.types, self.n, use_map = self.useMap)
+    gates.relation(open(basename + ".rel", "w"), self.spec)
+    self.expectLines = []
+    for k in range(len(self.bads)):
+      names = self.streamFiles("." + str(k))
+      self.streams(names, self.bads[k])
+      self.expectLines.append("input set " + str(k) + " (" + names[1] \
+          + "): " + ("assert zero failed" if self.bads[k] \
+            else "evaluated successfully"))
+
+  def testFiles(self):
+    names = [ self.basename + ".rel" ]
+    for k in range(len(self.bads)):
+      names += self.streamFiles("." + str(k))
+    return names
+
+bitslice_sets = [ [ False ], [ True ], [ False, True, False ], \
+    [ True ] + [ False ] * 62 + [ True ], [ False ] * 64, \
+    [ k % 5 == 3 for k in range(41) ] ]
+
+for n in [ 1, 5, 64 ]:
+  for bads in bitslice_sets:
+    tests.append(BitsliceTest(n, bads))
+    tests.append(BitsliceTest(n, bads, True))
+
+# ==== Batch Tests ====
+
+# Many instance/witness pairs for one relation, listed for --batch, some of
+# which (bads) should be rejected, each of which is reported on.
+class BatchTest(GatesTest):
+  def __init__(self, types, n, bads, second = None, use_map = False, \
+      jobs = 4, flags = []):
+    super().__init__(types, n, second = second, use_map = use_map)
+    self.bads = bads
+    self.jobs = jobs
+    self.extraFlags = flags
+    self.expectOk = not True in self.bads
+
+  def name(self):
+    return "batch " + super().name()[:-1] + ", pairs:" + str(len(self.bads)) \
+        + ", bad:" + str([ k for k in range(len(self.bads)) \
+          if self.bads[k] ]) \
+        + ", jobs:" + str(self.jobs) + ")"
+
+  def generateTestCase(self, basename):
+    self.basename = basename
+    self.spec = gates.Spec(self.types, self.n, self.second, self.useMap)
+    gates.relation(open(basename + ".rel", "w"), self.spec)
+    self.expectLines = []
+    batch_list = open(basename + ".list", "w")
+    for k in range(len(self.bads)):
+      names = self.streamFiles("." + str(k))
+      self.streams(names, self.bads[k])
+      batch_list.write(" ".join(names) + "\n")
+      self.expectLines.append("pair " + str(k) + " (" + " ".join(names) \
+          + "): " + ("failed" if self.bads[k] \
+            else "evaluated successfully"))
+    batch_list.close()
+    self.flags = [ "--batch", basename + ".list", "--jobs", str(self.jobs) ] \
+        + self.extraFlags
+
+  def testFiles(self):
+    return [ self.basename + ".rel" ]
+
+batch_pairs = [ [ False ], [ True ], [ False, True, False, False ], \
+    [ True, False, False, True ], [ False ] * 9, \
+    [ k % 4 == 1 for k in range(13) ] ]
+
+for bads in batch_pairs:
+  for jobs in [ 1, 4 ]:
+    for prime in [ 2, 2**61 - 1, 2**127 - 1 ]:
+      tests.append(BatchTest([ gates.Field(prime) ], 5, bads, jobs = jobs))
+    tests.append(BatchTest([ gates.Field(127) ], 5, bads, \
+        gates.Field(2**31 - 1), jobs = jobs))
+    tests.append(BatchTest([ gates.Field(127) ], 16, bads, \
+        use_map = True, jobs = jobs))
+  tests.append(BatchTest([ gates.Field(2**61 - 1) ], 5, bads, \
+      flags = [ "--compiled" ]))
+
+# ==== Ring Tests ====
+
+ring_bits = [ 8, 16, 32, 64, 128, 200 ]
+
+for bits in ring_bits:
+  for bad in [ False, True ]:
+    for n in [ 1, 5, 64 ]:
+      tests.append(GatesTest([ gates.Ring(bits) ], n, bad))
+    tests.append(GatesTest([ gates.Ring(bits) ], 5, bad, use_map = True))
+    for flags in [ [ "-t" ], [ "--compiled" ], [ "--memoize", "16" ] ]:
+      tests.append(withFlags(GatesTest([ gates.Ring(bits) ], 5, bad), flags))
+    for flags in [ [], [ "--parallel" ] ]:
+      tests.append(withFlags(GatesTest([ gates.Ring(bits) ], 5, bad, \
+          gates.Field(2**61 - 1)), flags))
+  tests.append(BatchTest([ gates.Ring(bits) ], 5, [ False, True, False ]))
+
+# ==== Extension Field Tests ====
+
+# Extension fields, by base prime and the non-leading coefficients of an
+# irreducible modulus (least significant first). Base primes may be up to
+# 64 bits where 128-bit integers are available.
+ext_fields = [ (2, [ 1, 1 ]), (2, [ 1, 1, 0, 1, 1, 0, 0, 0 ]), \
+    (7, [ 1, 1, 0 ]), (11, [ 9, 0, 0, 0, 0 ]), (13, [ 11, 0, 0, 0 ]), \
+    (2**31 - 1, [ 1, 0 ]), (2**61 - 1, [ 1, 0 ]) ]
+
+def extTypes(prime, modulus):
+  return [ gates.Field(prime), gates.ExtField(0, prime, modulus) ]
+
+# Prints each resource back to text with wtk-press, and evaluates the
+# printouts as well.
+class RetextTest(GatesTest):
+  def name(self):
+    return "retext " + super().name()
+
+  def run(self, basename):
+    super().run(basename)
+    if not self.skip:
+      retext_files = []
+      for f in self.testFiles():
+        self.runHelper(False, PRESS_CMD, [ "t2t", f, f + ".retxt" ])
+        retext_files.append(f + ".retxt")
+      self.runHelper(False, FIREALARM_CMD, self.flags + retext_files, \
+          self.expectOk)
+
+for prime, modulus in ext_fields:
+  for bad in [ False, True ]:
+    for n in [ 1, 5, 64 ]:
+      tests.append(GatesTest(extTypes(prime, modulus), n, bad))
+    tests.append(GatesTest(extTypes(prime, modulus), 5, bad, use_map = True))
+    for flags in [ [ "-t" ], [ "--compiled" ], [ "--memoize", "16" ] ]:
+      tests.append(withFlags(GatesTest(extTypes(prime, modulus), 5, bad), \
+          flags))
+    tests.append(RetextTest(extTypes(prime, modulus), 5, bad))
+  tests.append(BatchTest(extTypes(prime, modulus), 5, [ False, True, False ]))
+
+# Larger base fields are rejected.
+ext_too_large = GatesTest(extTypes(2**127 - 1, [ 1, 0 ]), 5)
+ext_too_large.expectOk = False
+ext_too_large.expectLines = [ "base field is too large" ]
+tests.append(ext_too_large)
+
 # ==== RUN THE TESTS ====
 
 Path("target/regression_tests").mkdir(parents=True, exist_ok=True)